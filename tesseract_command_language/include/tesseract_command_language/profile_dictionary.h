@@ -28,9 +28,12 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
 #include <unordered_map>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <string>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/profile.h>
@@ -38,9 +41,62 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+/**
+ * @brief A pre-hashed reference to a profile in the ProfileDictionary
+ * @details The hash of the (key, namespace, profile name) is computed once on construction, so it can be cached and
+ * reused to look up the same profile repeatedly without hashing any strings.
+ */
+class ProfileHandle
+{
+public:
+  ProfileHandle() = default;
+
+  /**
+   * @brief Construct a profile handle
+   * @param key The profile key
+   * @param ns The profile namespace
+   * @param profile_name The profile name
+   */
+  ProfileHandle(std::size_t key, std::string ns, std::string profile_name);
+
+  /** @brief Get the profile key */
+  std::size_t getKey() const;
+
+  /** @brief Get the profile namespace */
+  const std::string& getNamespace() const;
+
+  /** @brief Get the profile name */
+  const std::string& getName() const;
+
+  /** @brief Get the precomputed hash */
+  std::size_t getHash() const;
+
+  /**
+   * @brief Compute the hash for the provided profile key, namespace and name
+   * @details This does not allocate
+   */
+  static std::size_t hash(std::size_t key, const std::string& ns, const std::string& profile_name);
+
+  bool operator==(const ProfileHandle& rhs) const;
+  bool operator!=(const ProfileHandle& rhs) const;
+
+private:
+  std::size_t key_{ 0 };
+  std::string ns_;
+  std::string name_;
+  std::size_t hash_{ 0 };
+};
+
 /**
  * @brief This class is used to store profiles used by various tasks
- * @details This is a thread safe class
+ * @details This is a thread safe class. The profiles are stored in an immutable snapshot which is replaced on every
+ * modification (copy on write). Reads register themselves in an atomic reader count and use the current snapshot
+ * through a raw pointer, so they never take a lock and do not allocate. Replaced snapshots are released by the next
+ * modification which observes no active readers, or on destruction. Modifications are serialized and copy the
+ * snapshot, so prefer adding many profile names at once using the vector overload of addProfile.
+ *
+ * The lookups by key, namespace and profile name hash both strings on every call, so code which repeatedly looks up
+ * the same profile (e.g. per instruction) should use a ProfileHandle, which is hashed once on construction.
  */
 class ProfileDictionary
 {
@@ -48,6 +104,13 @@ public:
   using Ptr = std::shared_ptr<ProfileDictionary>;
   using ConstPtr = std::shared_ptr<const ProfileDictionary>;
 
+  ProfileDictionary();
+  ~ProfileDictionary();
+  ProfileDictionary(const ProfileDictionary&) = delete;
+  ProfileDictionary& operator=(const ProfileDictionary&) = delete;
+  ProfileDictionary(ProfileDictionary&&) = delete;
+  ProfileDictionary& operator=(ProfileDictionary&&) = delete;
+
   /**
    * @brief Add a profile
    * @details If the profile entry does not exist it will create one
@@ -72,7 +135,8 @@ public:
 
   /**
    * @brief Get a profile by name
-   * @details Check if the profile exist before calling this function, if missing an exception is thrown
+   * @details Check if the profile exist before calling this function, if missing an exception is thrown. This hashes
+   * the namespace and profile name, use the ProfileHandle overload for repeated lookups.
    * @param key The profile key
    * @param ns The profile namespace
    * @param profile_name The profile name
@@ -80,6 +144,39 @@ public:
    */
   Profile::ConstPtr getProfile(std::size_t key, const std::string& ns, const std::string& profile_name) const;
 
+  /**
+   * @brief Find a profile by name
+   * @details Unlike getProfile this does a single lookup and does not throw. This hashes the namespace and profile
+   * name, use the ProfileHandle overload for repeated lookups.
+   * @param key The profile key
+   * @param ns The profile namespace
+   * @param profile_name The profile name
+   * @return The profile, nullptr if it does not exist
+   */
+  Profile::ConstPtr findProfile(std::size_t key, const std::string& ns, const std::string& profile_name) const;
+
+  /**
+   * @brief Check if a profile exists using a pre-hashed handle
+   * @param handle The profile handle
+   * @return True if profile exists, otherwise false
+   */
+  bool hasProfile(const ProfileHandle& handle) const;
+
+  /**
+   * @brief Get a profile using a pre-hashed handle
+   * @details If missing an exception is thrown
+   * @param handle The profile handle
+   * @return The profile
+   */
+  Profile::ConstPtr getProfile(const ProfileHandle& handle) const;
+
+  /**
+   * @brief Find a profile using a pre-hashed handle
+   * @param handle The profile handle
+   * @return The profile, nullptr if it does not exist
+   */
+  Profile::ConstPtr findProfile(const ProfileHandle& handle) const;
+
   /**
    * @brief Remove a profile
    * @param key The profile key
@@ -115,11 +212,37 @@ public:
   void clear();
 
 protected:
-  mutable std::shared_mutex mutex_;
-  std::unordered_map<std::string, std::unordered_map<std::size_t, std::unordered_map<std::string, Profile::ConstPtr>>>
-      profiles_;
+  using ProfileEntry = std::unordered_map<std::string, Profile::ConstPtr>;
+  using ProfileMap = std::unordered_map<std::string, std::unordered_map<std::size_t, ProfileEntry>>;
+
+  struct Snapshot;
+  class ReadGuard;
+
+  /** @brief Serializes modifications, reads do not use it */
+  std::mutex mutex_;
+
+  /** @brief The current snapshot, it is owned by snapshots_ */
+  std::atomic<const Snapshot*> snapshot_{ nullptr };
+
+  /** @brief The number of reads in progress */
+  mutable std::atomic<std::size_t> readers_{ 0 };
+
+  /** @brief The current snapshot followed by the replaced snapshots which may still be in use, guarded by mutex_ */
+  std::vector<std::unique_ptr<const Snapshot>> snapshots_;
+
+  /** @brief Replace the current snapshot with one built from the provided profiles, the mutex must be locked */
+  void setProfiles(ProfileMap profiles);
+
+  /** @brief Get a copy of the current profiles, the mutex must be locked */
+  ProfileMap copyProfiles() const;
 
   friend class boost::serialization::access;
+  template <class Archive>
+  void save(Archive& ar, const unsigned int version) const;  // NOLINT
+
+  template <class Archive>
+  void load(Archive& ar, const unsigned int version);  // NOLINT
+
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
@@ -0,0 +1,105 @@
+/**
+ * @file program_codec.h
+ * @brief A compact, columnar binary format for programs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMAND_LANGUAGE_PROGRAM_CODEC_H
+#define TESSERACT_COMMAND_LANGUAGE_PROGRAM_CODEC_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+class CompositeInstruction;
+
+/**
+ * @brief Encode and decode programs in a compact, versioned, columnar binary format
+ * @details The Boost archives write every instruction and waypoint as a polymorphic object with its own class
+ * information and every waypoint repeats its joint names. This format instead stores:
+ *   - a pool of every distinct string, like descriptions, profiles and joint names
+ *   - a pool of every distinct UUID
+ *   - a table of every distinct list of joint names, referenced by the waypoints
+ *   - the tree of instructions as a flat stream of indices into the pools
+ *   - contiguous position, velocity, acceleration, effort and time arrays for all waypoints
+ *
+ * The move and composite instructions and the Cartesian, joint and state waypoints of this library are stored in
+ * columns. Any other instruction or waypoint type, along with the manipulator information, profile overrides and user
+ * data, is embedded as a Boost binary archive so it round trips as well.
+ *
+ * The data is written in the byte order of the machine and is rejected when decoded on a machine with a different one.
+ */
+struct ProgramCodec
+{
+  /** @brief The version of the format written, older versions can still be decoded */
+  static constexpr std::uint32_t VERSION{ 1 };
+
+  /**
+   * @brief Encode a program
+   * @param program The program
+   * @return The encoded data
+   */
+  static std::vector<std::uint8_t> encode(const CompositeInstruction& program);
+
+  /**
+   * @brief Decode a program
+   * @details Throws if the data is not a valid program or was written by a newer version
+   * @param data The encoded data
+   * @param size The size of the data in bytes
+   * @return The program
+   */
+  static CompositeInstruction decode(const std::uint8_t* data, std::size_t size);
+
+  /**
+   * @brief Decode a program
+   * @details Throws if the data is not a valid program or was written by a newer version
+   * @param data The encoded data
+   * @return The program
+   */
+  static CompositeInstruction decode(const std::vector<std::uint8_t>& data);
+
+  /**
+   * @brief Encode a program to a file
+   * @param program The program
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  static bool toFile(const CompositeInstruction& program, const std::string& file_path);
+
+  /**
+   * @brief Decode a program from a file
+   * @details The file is memory mapped where supported and decoded in place. Throws if the file can not be read or is
+   * not a valid program.
+   * @param file_path The file path
+   * @return The program
+   */
+  static CompositeInstruction fromFile(const std::string& file_path);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_COMMAND_LANGUAGE_PROGRAM_CODEC_H
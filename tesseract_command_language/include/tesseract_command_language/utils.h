@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
 #include <limits>
 #include <string>
 #include <vector>
@@ -44,7 +45,8 @@ class CompositeInstruction;
 
 /**
  * @brief Convert instruction to a joint trajectory
- * @details This searches for both move instructions. If it contains a Cartesian waypoint it is skipped.
+ * @details This searches for both move instructions. If it contains a Cartesian waypoint without a seed it is skipped.
+ * The velocity, acceleration and effort of state waypoints and seeds are copied along with the positions.
  * @param instruction The instruction to convert
  * @return A joint trajectory
  */
@@ -53,12 +55,50 @@ tesseract_common::JointTrajectory toJointTrajectory(const InstructionPoly& instr
 /**
  * @brief Convert composite instruction to a joint trajectory
  * @details This searches for both move and plan instruction to support converting both input and results to planning
- * requests. If it contains a Cartesian waypoint it is skipped.
+ * requests. If it contains a Cartesian waypoint without a seed it is skipped. The velocity, acceleration and effort of
+ * state waypoints and seeds are copied along with the positions.
  * @param composite_instructions The composite instruction to convert
  * @return A joint trajectory
  */
 tesseract_common::JointTrajectory toJointTrajectory(const CompositeInstruction& composite_instructions);
 
+/**
+ * @brief The joint state of a move instruction passed to a JointStateVisitorFn
+ * @details The members reference the data stored in the waypoint, so nothing is copied. They are only valid for the
+ * duration of the call.
+ */
+struct JointStateView
+{
+  /** @brief The joint names */
+  const std::vector<std::string>& joint_names;
+
+  /** @brief The joint positions */
+  const Eigen::VectorXd& position;
+
+  /** @brief The joint velocities, empty if not available */
+  const Eigen::VectorXd& velocity;
+
+  /** @brief The joint accelerations, empty if not available */
+  const Eigen::VectorXd& acceleration;
+
+  /** @brief The joint efforts, empty if not available */
+  const Eigen::VectorXd& effort;
+
+  /** @brief The time from start, accumulated the same way as toJointTrajectory */
+  double time;
+};
+
+using JointStateVisitorFn = std::function<void(const JointStateView&)>;
+
+/**
+ * @brief Visit the joint state of every move instruction in a composite instruction
+ * @details The composite instruction tree is walked in place instead of being flattened. Cartesian waypoints without a
+ * seed are skipped, the same as toJointTrajectory.
+ * @param composite_instructions The composite instruction to visit
+ * @param fn The function called for each joint state
+ */
+void visitJointStates(const CompositeInstruction& composite_instructions, const JointStateVisitorFn& fn);
+
 /**
  * @brief Gets joint position from waypoints that contain that information.
  *
@@ -223,6 +263,7 @@ bool clampToJointLimits(WaypointPoly&,
 
 /**
  * @brief Convert a CompositeInstruction to delimited formate file by extracting all MoveInstructions
+ * @details Throws if the program contains a Cartesian waypoint without a seed, since it has no joint positions
  * @param composite_instructions The CompositeInstruction to extract data from
  * @param file_path The location to save the file
  * @param separator The separator to use
@@ -232,6 +273,19 @@ bool toDelimitedFile(const CompositeInstruction& composite_instructions,
                      const std::string& file_path,
                      char separator = ',');
 
+/**
+ * @brief Convert a CompositeInstruction to a binary file by extracting all joint states
+ * @details The file starts with the characters "TJTB", a uint32 version and a uint32 number of joints followed by
+ * every joint name as a uint32 length and its characters. The rest of the file is one row of doubles per joint state:
+ * the time, the positions, the velocities and the accelerations. Values which are not available are written as NaN.
+ * Everything is written in the byte order of the machine. Cartesian waypoints without a seed are skipped, the same as
+ * toJointTrajectory. On failure the partial file is removed.
+ * @param composite_instructions The CompositeInstruction to extract data from
+ * @param file_path The location to save the file
+ * @return true if successful, false if the file could not be written or the number of joints is not consistent
+ */
+bool toBinaryFile(const CompositeInstruction& composite_instructions, const std::string& file_path);
+
 /**
  * @brief This loops over the instructions validates the structure
  *
@@ -27,15 +27,140 @@
 #include <tesseract_command_language/profile_dictionary.h>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/split_member.hpp>
 #include <boost/serialization/unordered_map.hpp>
 
 namespace tesseract_planning
 {
+namespace
+{
+void hashCombine(std::size_t& seed, std::size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); }
+}  // namespace
+
+ProfileHandle::ProfileHandle(std::size_t key, std::string ns, std::string profile_name)
+  : key_(key), ns_(std::move(ns)), name_(std::move(profile_name)), hash_(hash(key_, ns_, name_))
+{
+}
+
+std::size_t ProfileHandle::getKey() const { return key_; }
+
+const std::string& ProfileHandle::getNamespace() const { return ns_; }
+
+const std::string& ProfileHandle::getName() const { return name_; }
+
+std::size_t ProfileHandle::getHash() const { return hash_; }
+
+std::size_t ProfileHandle::hash(std::size_t key, const std::string& ns, const std::string& profile_name)
+{
+  std::size_t seed{ key };
+  hashCombine(seed, std::hash<std::string>()(ns));
+  hashCombine(seed, std::hash<std::string>()(profile_name));
+  return seed;
+}
+
+bool ProfileHandle::operator==(const ProfileHandle& rhs) const
+{
+  return (hash_ == rhs.hash_ && key_ == rhs.key_ && ns_ == rhs.ns_ && name_ == rhs.name_);
+}
+
+bool ProfileHandle::operator!=(const ProfileHandle& rhs) const { return !operator==(rhs); }
+
+/**
+ * @brief An immutable set of profiles
+ * @details In addition to the nested profile map a flat lookup keyed by the ProfileHandle hash is stored so a profile
+ * can be found with a single hash lookup.
+ */
+struct ProfileDictionary::Snapshot
+{
+  struct LookupEntry
+  {
+    std::size_t key;
+    const std::string* ns;
+    const std::string* name;
+    const Profile::ConstPtr* profile;
+  };
+
+  explicit Snapshot(ProfileMap profile_map) : profiles(std::move(profile_map))
+  {
+    for (const auto& ns : profiles)
+    {
+      for (const auto& entry : ns.second)
+      {
+        for (const auto& profile : entry.second)
+        {
+          std::size_t hash = ProfileHandle::hash(entry.first, ns.first, profile.first);
+          lookup[hash].push_back({ entry.first, &ns.first, &profile.first, &profile.second });
+        }
+      }
+    }
+  }
+  ~Snapshot() = default;
+  Snapshot(const Snapshot&) = delete;
+  Snapshot& operator=(const Snapshot&) = delete;
+  Snapshot(Snapshot&&) = delete;
+  Snapshot& operator=(Snapshot&&) = delete;
+
+  const Profile::ConstPtr* find(std::size_t hash,
+                                std::size_t key,
+                                const std::string& ns,
+                                const std::string& profile_name) const
+  {
+    auto it = lookup.find(hash);
+    if (it == lookup.end())
+      return nullptr;
+
+    for (const auto& entry : it->second)
+    {
+      if (entry.key == key && *entry.ns == ns && *entry.name == profile_name)
+        return entry.profile;
+    }
+    return nullptr;
+  }
+
+  ProfileMap profiles;
+  std::unordered_map<std::size_t, std::vector<LookupEntry>> lookup;
+};
+
+/**
+ * @brief Registers a read of the current snapshot
+ * @details The snapshot returned by get() remains valid until the guard is destroyed
+ */
+class ProfileDictionary::ReadGuard
+{
+public:
+  explicit ReadGuard(const ProfileDictionary& dictionary) : readers_(dictionary.readers_)
+  {
+    // The reader must be registered before the snapshot is loaded, see setProfiles
+    readers_.fetch_add(1);
+    snapshot_ = dictionary.snapshot_.load();
+  }
+  ~ReadGuard() { readers_.fetch_sub(1); }
+  ReadGuard(const ReadGuard&) = delete;
+  ReadGuard& operator=(const ReadGuard&) = delete;
+  ReadGuard(ReadGuard&&) = delete;
+  ReadGuard& operator=(ReadGuard&&) = delete;
+
+  const Snapshot& get() const { return *snapshot_; }
+
+private:
+  std::atomic<std::size_t>& readers_;
+  const Snapshot* snapshot_{ nullptr };
+};
+
+ProfileDictionary::ProfileDictionary()
+{
+  const std::unique_lock lock(mutex_);
+  setProfiles(ProfileMap());
+}
+
+ProfileDictionary::~ProfileDictionary() = default;
+
 bool ProfileDictionary::hasProfileEntry(std::size_t key, const std::string& ns) const
 {
-  const std::shared_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
+  const ReadGuard guard(*this);
+  const Snapshot& snapshot = guard.get();
+  auto it = snapshot.profiles.find(ns);
+  if (it == snapshot.profiles.end())
     return false;
 
   return (it->second.find(key) != it->second.end());
@@ -44,20 +169,22 @@ bool ProfileDictionary::hasProfileEntry(std::size_t key, const std::string& ns)
 void ProfileDictionary::removeProfileEntry(std::size_t key, const std::string& ns)
 {
   const std::unique_lock lock(mutex_);
-
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
+  ProfileMap profiles = copyProfiles();
+  auto it = profiles.find(ns);
+  if (it == profiles.end())
     return;
 
   it->second.erase(key);
+  setProfiles(std::move(profiles));
 }
 
 std::unordered_map<std::string, Profile::ConstPtr> ProfileDictionary::getProfileEntry(std::size_t key,
                                                                                       const std::string& ns) const
 {
-  const std::shared_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
+  const ReadGuard guard(*this);
+  const Snapshot& snapshot = guard.get();
+  auto it = snapshot.profiles.find(ns);
+  if (it == snapshot.profiles.end())
     throw std::runtime_error("Profile namespace does not exist for '" + ns + "'!");
 
   auto it2 = it->second.find(key);
@@ -82,27 +209,9 @@ void ProfileDictionary::addProfile(const std::string& ns,
     throw std::runtime_error("Adding profile that is a nullptr");
 
   const std::unique_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
-  {
-    std::unordered_map<std::string, Profile::ConstPtr> new_entry;
-    new_entry[profile_name] = profile;
-    profiles_[ns][profile->getKey()] = new_entry;
-  }
-  else
-  {
-    auto it2 = it->second.find(profile->getKey());
-    if (it2 != it->second.end())
-    {
-      it2->second[profile_name] = profile;
-    }
-    else
-    {
-      std::unordered_map<std::string, Profile::ConstPtr> new_entry;
-      new_entry[profile_name] = profile;
-      it->second[profile->getKey()] = new_entry;
-    }
-  }
+  ProfileMap profiles = copyProfiles();
+  profiles[ns][profile->getKey()][profile_name] = profile;
+  setProfiles(std::move(profiles));
 }
 
 void ProfileDictionary::addProfile(const std::string& ns,
@@ -118,96 +227,125 @@ void ProfileDictionary::addProfile(const std::string& ns,
   if (profile == nullptr)
     throw std::runtime_error("Adding profile that is a nullptr");
 
-  const std::unique_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
+  for (const auto& profile_name : profile_names)
   {
-    std::unordered_map<std::string, Profile::ConstPtr> new_entry;
-    for (const auto& profile_name : profile_names)
-    {
-      if (profile_name.empty())
-        throw std::runtime_error("Adding profile with an empty string as the key!");
-
-      new_entry[profile_name] = profile;
-    }
-    profiles_[ns][profile->getKey()] = new_entry;
+    if (profile_name.empty())
+      throw std::runtime_error("Adding profile with an empty string as the key!");
   }
-  else
-  {
-    auto it2 = it->second.find(profile->getKey());
-    if (it2 != it->second.end())
-    {
-      for (const auto& profile_name : profile_names)
-      {
-        if (profile_name.empty())
-          throw std::runtime_error("Adding profile with an empty string as the key!");
 
-        it2->second[profile_name] = profile;
-      }
-    }
-    else
-    {
-      std::unordered_map<std::string, Profile::ConstPtr> new_entry;
-      for (const auto& profile_name : profile_names)
-      {
-        if (profile_name.empty())
-          throw std::runtime_error("Adding profile with an empty string as the key!");
+  const std::unique_lock lock(mutex_);
+  ProfileMap profiles = copyProfiles();
+  auto& entry = profiles[ns][profile->getKey()];
+  for (const auto& profile_name : profile_names)
+    entry[profile_name] = profile;
 
-        new_entry[profile_name] = profile;
-      }
-      it->second[profile->getKey()] = new_entry;
-    }
-  }
+  setProfiles(std::move(profiles));
 }
 
 bool ProfileDictionary::hasProfile(std::size_t key, const std::string& ns, const std::string& profile_name) const
 {
-  const std::shared_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
-    return false;
-
-  auto it2 = it->second.find(key);
-  if (it2 != it->second.end())
-  {
-    auto it3 = it2->second.find(profile_name);
-    if (it3 != it2->second.end())
-      return true;
-  }
-  return false;
+  return (findProfile(key, ns, profile_name) != nullptr);
 }
 
 Profile::ConstPtr ProfileDictionary::getProfile(std::size_t key,
                                                 const std::string& ns,
                                                 const std::string& profile_name) const
 {
-  const std::shared_lock lock(mutex_);
-  return profiles_.at(ns).at(key).at(profile_name);
+  Profile::ConstPtr profile = findProfile(key, ns, profile_name);
+  if (profile == nullptr)
+    throw std::runtime_error("Profile '" + profile_name + "' does not exist for type name '" + std::to_string(key) +
+                             "' in namespace '" + ns + "'!");
+
+  return profile;
+}
+
+Profile::ConstPtr ProfileDictionary::findProfile(std::size_t key,
+                                                 const std::string& ns,
+                                                 const std::string& profile_name) const
+{
+  const ReadGuard guard(*this);
+  const Profile::ConstPtr* profile =
+      guard.get().find(ProfileHandle::hash(key, ns, profile_name), key, ns, profile_name);
+  return (profile == nullptr) ? nullptr : *profile;
+}
+
+bool ProfileDictionary::hasProfile(const ProfileHandle& handle) const { return (findProfile(handle) != nullptr); }
+
+Profile::ConstPtr ProfileDictionary::getProfile(const ProfileHandle& handle) const
+{
+  Profile::ConstPtr profile = findProfile(handle);
+  if (profile == nullptr)
+    throw std::runtime_error("Profile '" + handle.getName() + "' does not exist for type name '" +
+                             std::to_string(handle.getKey()) + "' in namespace '" + handle.getNamespace() + "'!");
+
+  return profile;
+}
+
+Profile::ConstPtr ProfileDictionary::findProfile(const ProfileHandle& handle) const
+{
+  const ReadGuard guard(*this);
+  const Profile::ConstPtr* profile =
+      guard.get().find(handle.getHash(), handle.getKey(), handle.getNamespace(), handle.getName());
+  return (profile == nullptr) ? nullptr : *profile;
 }
 
 void ProfileDictionary::removeProfile(std::size_t key, const std::string& ns, const std::string& profile_name)
 {
   const std::unique_lock lock(mutex_);
-  auto it = profiles_.find(ns);
-  if (it == profiles_.end())
+  ProfileMap profiles = copyProfiles();
+  auto it = profiles.find(ns);
+  if (it == profiles.end())
     return;
 
   auto it2 = it->second.find(key);
-  if (it2 != it->second.end())
-    it2->second.erase(profile_name);
+  if (it2 == it->second.end())
+    return;
+
+  it2->second.erase(profile_name);
+  setProfiles(std::move(profiles));
 }
 
 void ProfileDictionary::clear()
 {
   const std::unique_lock lock(mutex_);
-  profiles_.clear();
+  setProfiles(ProfileMap());
+}
+
+void ProfileDictionary::setProfiles(ProfileMap profiles)
+{
+  auto snapshot = std::make_unique<const Snapshot>(std::move(profiles));
+  snapshot_.store(snapshot.get());
+  snapshots_.insert(snapshots_.begin(), std::move(snapshot));
+
+  // A reader registers itself before loading the snapshot, so if no reader is registered after the new snapshot was
+  // published every later reader is guaranteed to load the new snapshot and the replaced snapshots can be released.
+  if (readers_.load() == 0)
+    snapshots_.erase(std::next(snapshots_.begin()), snapshots_.end());
+}
+
+ProfileDictionary::ProfileMap ProfileDictionary::copyProfiles() const { return snapshot_.load()->profiles; }
+
+template <class Archive>
+void ProfileDictionary::save(Archive& ar, const unsigned int /*version*/) const
+{
+  const ReadGuard guard(*this);
+  ar& boost::serialization::make_nvp("profiles", guard.get().profiles);
+}
+
+template <class Archive>
+void ProfileDictionary::load(Archive& ar, const unsigned int /*version*/)
+{
+  ProfileMap profiles;
+  ar& boost::serialization::make_nvp("profiles", profiles);
+
+  const std::unique_lock lock(mutex_);
+  setProfiles(std::move(profiles));
 }
 
 template <class Archive>
-void ProfileDictionary::serialize(Archive& ar, const unsigned int /*version*/)
+void ProfileDictionary::serialize(Archive& ar, const unsigned int version)
 {
-  const std::shared_lock lock(mutex_);
-  ar& boost::serialization::make_nvp("profiles", profiles_);
+  boost::serialization::split_member(ar, *this, version);
 }
 
 }  // namespace tesseract_planning
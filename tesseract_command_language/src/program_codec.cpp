@@ -0,0 +1,914 @@
+/**
+ * @file program_codec.cpp
+ * @brief A compact, columnar binary format for programs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <boost/version.hpp>
+#if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
+#include <boost/serialization/library_version_type.hpp>
+#endif
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unordered_map.hpp>
+#include <boost/uuid/uuid_serialize.hpp>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/program_codec.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_common/manipulator_info.h>
+#include <tesseract_common/std_variant_serialization.h>
+#include <tesseract_common/serialization.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+constexpr std::array<char, 4> MAGIC{ 'T', 'P', 'R', 'G' };
+constexpr std::uint32_t BYTE_ORDER_MARK{ 0x01020304 };
+
+/** @brief Marks an absent value in the node stream, like empty profile overrides */
+constexpr std::uint32_t NONE{ std::numeric_limits<std::uint32_t>::max() };
+
+enum class NodeKind : std::uint32_t
+{
+  COMPOSITE = 0,
+  MOVE = 1,
+  ARCHIVE = 2
+};
+
+enum class WaypointKind : std::uint32_t
+{
+  CARTESIAN = 0,
+  JOINT = 1,
+  STATE = 2
+};
+
+template <typename T>
+std::string toBlob(const T& value)
+{
+  std::ostringstream os;
+  {
+    boost::archive::binary_oarchive oa(os);
+    oa << boost::serialization::make_nvp("value", value);
+  }
+  return os.str();
+}
+
+template <typename T>
+void fromBlob(std::string_view blob, T& value)
+{
+  std::istringstream is{ std::string(blob) };
+  boost::archive::binary_iarchive ia(is);
+  ia >> boost::serialization::make_nvp("value", value);
+}
+
+/** @brief Appends trivially copyable values to a byte buffer */
+class ByteWriter
+{
+public:
+  template <typename T>
+  void write(const T& value)
+  {
+    writeArray(&value, 1);
+  }
+
+  template <typename T>
+  void writeArray(const T* values, std::size_t count)
+  {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(values);  // NOLINT
+    data_.insert(data_.end(), bytes, bytes + (count * sizeof(T)));
+  }
+
+  /** @brief Write the values prefixed by their count and padded so the next section is eight byte aligned */
+  template <typename T>
+  void writeSection(const std::vector<T>& values)
+  {
+    write<std::uint64_t>(values.size());
+    writeArray(values.data(), values.size());
+    data_.resize((data_.size() + 7) & ~std::size_t(7), 0);
+  }
+
+  std::vector<std::uint8_t>& data() { return data_; }
+
+private:
+  std::vector<std::uint8_t> data_;
+};
+
+/** @brief A section of the encoded data, which is referenced in place when it is suitably aligned */
+template <typename T>
+class SectionView
+{
+public:
+  void assign(const std::uint8_t* data, std::size_t count)
+  {
+    size_ = count;
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0)  // NOLINT
+    {
+      data_ = reinterpret_cast<const T*>(data);  // NOLINT
+      return;
+    }
+
+    copy_.resize(count);
+    std::memcpy(copy_.data(), data, count * sizeof(T));
+    data_ = copy_.data();
+  }
+
+  const T* data() const { return data_; }
+  std::size_t size() const { return size_; }
+  const T& operator[](std::size_t i) const { return data_[i]; }  // NOLINT
+
+private:
+  const T* data_{ nullptr };
+  std::size_t size_{ 0 };
+  std::vector<T> copy_;
+};
+
+/** @brief Reads the values written by ByteWriter, checking every read against the size of the data */
+class ByteReader
+{
+public:
+  ByteReader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  T read()
+  {
+    require(sizeof(T));
+    T value;
+    std::memcpy(&value, data_ + offset_, sizeof(T));  // NOLINT
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  template <typename T>
+  void readSection(SectionView<T>& section)
+  {
+    const auto count = read<std::uint64_t>();
+    if (count > (size_ - offset_) / sizeof(T))
+      throw std::runtime_error("ProgramCodec, the data is truncated");
+
+    section.assign(data_ + offset_, static_cast<std::size_t>(count));  // NOLINT
+    offset_ += static_cast<std::size_t>(count) * sizeof(T);
+    offset_ = std::min((offset_ + 7) & ~std::size_t(7), size_);
+  }
+
+private:
+  const std::uint8_t* data_;
+  std::size_t size_;
+  std::size_t offset_{ 0 };
+
+  void require(std::size_t bytes) const
+  {
+    if (bytes > size_ - offset_)
+      throw std::runtime_error("ProgramCodec, the data is truncated");
+  }
+};
+
+/** @brief Get the string at an index of a pool stored as offsets into a character array */
+std::string_view getPooled(const SectionView<std::uint64_t>& offsets, const SectionView<char>& chars, std::uint32_t id)
+{
+  if (id + std::size_t(1) >= offsets.size() || offsets[id] > offsets[id + 1] || offsets[id + 1] > chars.size())
+    throw std::runtime_error("ProgramCodec, invalid pool index");
+
+  return { chars.data() + offsets[id], static_cast<std::size_t>(offsets[id + 1] - offsets[id]) };  // NOLINT
+}
+
+class ProgramEncoder
+{
+public:
+  ProgramEncoder()
+  {
+    string_offsets_.push_back(0);
+    blob_offsets_.push_back(0);
+  }
+
+  void addComposite(const CompositeInstruction& composite)
+  {
+    nodes_.push_back(static_cast<std::uint32_t>(NodeKind::COMPOSITE));
+    nodes_.push_back(addUUID(composite.getUUID()));
+    nodes_.push_back(addUUID(composite.getParentUUID()));
+    nodes_.push_back(addString(composite.getDescription()));
+    nodes_.push_back(addString(composite.getProfile()));
+    nodes_.push_back(addProfileOverrides(composite.getProfileOverrides()));
+    nodes_.push_back(addManipulatorInfo(composite.getManipulatorInfo()));
+    nodes_.push_back(static_cast<std::uint32_t>(composite.getOrder()));
+    nodes_.push_back(composite.getUserData().empty() ? NONE : addBlob(toBlob(composite.getUserData())));
+    nodes_.push_back(static_cast<std::uint32_t>(composite.size()));
+    for (const auto& instruction : composite)
+      addInstruction(instruction);
+  }
+
+  std::vector<std::uint8_t> finish()
+  {
+    ByteWriter writer;
+    writer.writeArray(MAGIC.data(), MAGIC.size());
+    writer.write<std::uint32_t>(ProgramCodec::VERSION);
+    writer.write<std::uint32_t>(BYTE_ORDER_MARK);
+    writer.write<std::uint32_t>(0);
+    writer.writeSection(string_offsets_);
+    writer.writeSection(string_chars_);
+    writer.writeSection(uuids_);
+    writer.writeSection(blob_offsets_);
+    writer.writeSection(blob_chars_);
+    writer.writeSection(name_sets_);
+    writer.writeSection(nodes_);
+    writer.writeSection(position_);
+    writer.writeSection(velocity_);
+    writer.writeSection(acceleration_);
+    writer.writeSection(effort_);
+    writer.writeSection(time_);
+    writer.writeSection(values_);
+    return std::move(writer.data());
+  }
+
+private:
+  std::vector<std::uint64_t> string_offsets_;
+  std::vector<char> string_chars_;
+  std::unordered_map<std::string, std::uint32_t> string_index_;
+
+  std::vector<boost::uuids::uuid> uuids_;
+  std::map<boost::uuids::uuid, std::uint32_t> uuid_index_;
+
+  std::vector<std::uint64_t> blob_offsets_;
+  std::vector<char> blob_chars_;
+  std::unordered_map<std::string, std::uint32_t> blob_index_;
+
+  /** @brief Each list of joint names is stored as its size followed by the string index of every name */
+  std::vector<std::uint32_t> name_sets_;
+  std::map<std::vector<std::string>, std::uint32_t> name_set_index_;
+  const std::vector<std::string>* last_names_{ nullptr };
+  std::uint32_t last_name_set_{ NONE };
+
+  std::vector<std::pair<tesseract_common::ManipulatorInfo, std::uint32_t>> manipulator_infos_;
+
+  std::vector<std::uint32_t> nodes_;
+  std::vector<double> position_;
+  std::vector<double> velocity_;
+  std::vector<double> acceleration_;
+  std::vector<double> effort_;
+  std::vector<double> time_;
+  std::vector<double> values_;
+
+  std::uint32_t addString(const std::string& value)
+  {
+    auto it = string_index_.find(value);
+    if (it != string_index_.end())
+      return it->second;
+
+    const auto id = static_cast<std::uint32_t>(string_index_.size());
+    string_chars_.insert(string_chars_.end(), value.begin(), value.end());
+    string_offsets_.push_back(string_chars_.size());
+    string_index_.emplace(value, id);
+    return id;
+  }
+
+  std::uint32_t addUUID(const boost::uuids::uuid& value)
+  {
+    auto it = uuid_index_.find(value);
+    if (it != uuid_index_.end())
+      return it->second;
+
+    const auto id = static_cast<std::uint32_t>(uuids_.size());
+    uuids_.push_back(value);
+    uuid_index_.emplace(value, id);
+    return id;
+  }
+
+  std::uint32_t addBlob(std::string value)
+  {
+    auto it = blob_index_.find(value);
+    if (it != blob_index_.end())
+      return it->second;
+
+    const auto id = static_cast<std::uint32_t>(blob_index_.size());
+    blob_chars_.insert(blob_chars_.end(), value.begin(), value.end());
+    blob_offsets_.push_back(blob_chars_.size());
+    blob_index_.emplace(std::move(value), id);
+    return id;
+  }
+
+  std::uint32_t addNames(const std::vector<std::string>& names)
+  {
+    // Consecutive waypoints almost always share the same joint names
+    if (last_names_ != nullptr && *last_names_ == names)
+      return last_name_set_;
+
+    auto it = name_set_index_.find(names);
+    if (it == name_set_index_.end())
+    {
+      it = name_set_index_.emplace(names, static_cast<std::uint32_t>(name_set_index_.size())).first;
+      name_sets_.push_back(static_cast<std::uint32_t>(names.size()));
+      for (const auto& name : names)
+        name_sets_.push_back(addString(name));
+    }
+
+    last_names_ = &it->first;
+    last_name_set_ = it->second;
+    return it->second;
+  }
+
+  std::uint32_t addProfileOverrides(const ProfileOverrides& overrides)
+  {
+    return overrides.empty() ? NONE : addBlob(toBlob(overrides));
+  }
+
+  std::uint32_t addManipulatorInfo(const tesseract_common::ManipulatorInfo& info)
+  {
+    static const tesseract_common::ManipulatorInfo empty_info;
+    if (info == empty_info)
+      return NONE;
+
+    for (const auto& manipulator_info : manipulator_infos_)
+    {
+      if (manipulator_info.first == info)
+        return manipulator_info.second;
+    }
+
+    const std::uint32_t id = addBlob(toBlob(info));
+    manipulator_infos_.emplace_back(info, id);
+    return id;
+  }
+
+  static void addVector(std::vector<double>& column, const Eigen::VectorXd& values)
+  {
+    column.insert(column.end(), values.data(), values.data() + values.size());  // NOLINT
+  }
+
+  void addJointState(const std::vector<std::string>& names,
+                     const Eigen::VectorXd& position,
+                     const Eigen::VectorXd& velocity,
+                     const Eigen::VectorXd& acceleration,
+                     const Eigen::VectorXd& effort,
+                     double time)
+  {
+    nodes_.push_back(addNames(names));
+    nodes_.push_back(static_cast<std::uint32_t>(position.size()));
+    nodes_.push_back(static_cast<std::uint32_t>(velocity.size()));
+    nodes_.push_back(static_cast<std::uint32_t>(acceleration.size()));
+    nodes_.push_back(static_cast<std::uint32_t>(effort.size()));
+    addVector(position_, position);
+    addVector(velocity_, velocity);
+    addVector(acceleration_, acceleration);
+    addVector(effort_, effort);
+    time_.push_back(time);
+  }
+
+  void addTolerances(const Eigen::VectorXd& lower, const Eigen::VectorXd& upper)
+  {
+    nodes_.push_back(static_cast<std::uint32_t>(lower.size()));
+    nodes_.push_back(static_cast<std::uint32_t>(upper.size()));
+    addVector(values_, lower);
+    addVector(values_, upper);
+  }
+
+  /** @brief Check if the move instruction and its waypoint are the types stored in columns */
+  static bool isColumnar(const MoveInstructionPoly& move)
+  {
+    if (move.getType() != std::type_index(typeid(MoveInstruction)))
+      return false;
+
+    const WaypointPoly& waypoint = move.getWaypoint();
+    if (waypoint.isCartesianWaypoint())
+      return (waypoint.as<CartesianWaypointPoly>().getType() == std::type_index(typeid(CartesianWaypoint)));
+
+    if (waypoint.isJointWaypoint())
+      return (waypoint.as<JointWaypointPoly>().getType() == std::type_index(typeid(JointWaypoint)));
+
+    if (waypoint.isStateWaypoint())
+      return (waypoint.as<StateWaypointPoly>().getType() == std::type_index(typeid(StateWaypoint)));
+
+    return false;
+  }
+
+  void addInstruction(const InstructionPoly& instruction)
+  {
+    if (instruction.isCompositeInstruction())
+    {
+      addComposite(instruction.as<CompositeInstruction>());
+      return;
+    }
+
+    if (instruction.isMoveInstruction() && isColumnar(instruction.as<MoveInstructionPoly>()))
+    {
+      addMove(instruction.as<MoveInstructionPoly>().as<MoveInstruction>());
+      return;
+    }
+
+    nodes_.push_back(static_cast<std::uint32_t>(NodeKind::ARCHIVE));
+    nodes_.push_back(addBlob(toBlob(instruction)));
+  }
+
+  void addMove(const MoveInstruction& move)
+  {
+    nodes_.push_back(static_cast<std::uint32_t>(NodeKind::MOVE));
+    nodes_.push_back(addUUID(move.getUUID()));
+    nodes_.push_back(addUUID(move.getParentUUID()));
+    nodes_.push_back(static_cast<std::uint32_t>(move.getMoveType()));
+    nodes_.push_back(addString(move.getDescription()));
+    nodes_.push_back(addString(move.getProfile()));
+    nodes_.push_back(addString(move.getPathProfile()));
+    nodes_.push_back(addProfileOverrides(move.getProfileOverrides()));
+    nodes_.push_back(addProfileOverrides(move.getPathProfileOverrides()));
+    nodes_.push_back(addManipulatorInfo(move.getManipulatorInfo()));
+
+    const WaypointPoly& waypoint = move.getWaypoint();
+    if (waypoint.isStateWaypoint())
+    {
+      const auto& swp = waypoint.as<StateWaypointPoly>().as<StateWaypoint>();
+      nodes_.push_back(static_cast<std::uint32_t>(WaypointKind::STATE));
+      nodes_.push_back(addString(swp.getName()));
+      addJointState(
+          swp.getNames(), swp.getPosition(), swp.getVelocity(), swp.getAcceleration(), swp.getEffort(), swp.getTime());
+    }
+    else if (waypoint.isJointWaypoint())
+    {
+      const auto& jwp = waypoint.as<JointWaypointPoly>().as<JointWaypoint>();
+      nodes_.push_back(static_cast<std::uint32_t>(WaypointKind::JOINT));
+      nodes_.push_back(addString(jwp.getName()));
+      nodes_.push_back(addNames(jwp.getNames()));
+      nodes_.push_back(static_cast<std::uint32_t>(jwp.getPosition().size()));
+      nodes_.push_back(static_cast<std::uint32_t>(jwp.isConstrained()));
+      addVector(position_, jwp.getPosition());
+      addTolerances(jwp.getLowerTolerance(), jwp.getUpperTolerance());
+    }
+    else
+    {
+      const auto& cwp = waypoint.as<CartesianWaypointPoly>().as<CartesianWaypoint>();
+      nodes_.push_back(static_cast<std::uint32_t>(WaypointKind::CARTESIAN));
+      nodes_.push_back(addString(cwp.getName()));
+      const Eigen::Matrix<double, 3, 4> transform = cwp.getTransform().matrix().topRows<3>();
+      values_.insert(values_.end(), transform.data(), transform.data() + transform.size());  // NOLINT
+      addTolerances(cwp.getLowerTolerance(), cwp.getUpperTolerance());
+
+      const tesseract_common::JointState& seed = cwp.getSeed();
+      addJointState(seed.joint_names, seed.position, seed.velocity, seed.acceleration, seed.effort, seed.time);
+    }
+  }
+};
+
+class ProgramDecoder
+{
+public:
+  ProgramDecoder(const std::uint8_t* data, std::size_t size)
+  {
+    ByteReader reader(data, size);
+    std::array<char, 4> magic{};
+    for (char& c : magic)
+      c = reader.read<char>();
+
+    if (magic != MAGIC)
+      throw std::runtime_error("ProgramCodec, the data is not an encoded program");
+
+    const auto version = reader.read<std::uint32_t>();
+    if (version == 0 || version > ProgramCodec::VERSION)
+      throw std::runtime_error("ProgramCodec, unsupported version " + std::to_string(version));
+
+    if (reader.read<std::uint32_t>() != BYTE_ORDER_MARK)
+      throw std::runtime_error("ProgramCodec, the program was encoded with a different byte order");
+
+    reader.read<std::uint32_t>();
+    reader.readSection(string_offsets_);
+    reader.readSection(string_chars_);
+    reader.readSection(uuids_);
+    reader.readSection(blob_offsets_);
+    reader.readSection(blob_chars_);
+    reader.readSection(name_set_words_);
+    reader.readSection(nodes_);
+    reader.readSection(position_.data);
+    reader.readSection(velocity_.data);
+    reader.readSection(acceleration_.data);
+    reader.readSection(effort_.data);
+    reader.readSection(time_.data);
+    reader.readSection(values_.data);
+
+    if (string_offsets_.size() == 0 || blob_offsets_.size() == 0)
+      throw std::runtime_error("ProgramCodec, the data is not an encoded program");
+
+    strings_.reserve(string_offsets_.size() - 1);
+    for (std::uint32_t i = 0; i + std::size_t(1) < string_offsets_.size(); ++i)
+      strings_.emplace_back(getPooled(string_offsets_, string_chars_, i));
+
+    for (std::size_t i = 0; i < name_set_words_.size();)
+    {
+      const std::size_t count = name_set_words_[i++];
+      if (count > name_set_words_.size() - i)
+        throw std::runtime_error("ProgramCodec, invalid joint names table");
+
+      std::vector<std::string> names;
+      names.reserve(count);
+      for (std::size_t j = 0; j < count; ++j)
+        names.push_back(getString(name_set_words_[i++]));
+
+      name_sets_.push_back(std::move(names));
+    }
+  }
+
+  CompositeInstruction decode()
+  {
+    if (next() != static_cast<std::uint32_t>(NodeKind::COMPOSITE))
+      throw std::runtime_error("ProgramCodec, the program does not start with a composite instruction");
+
+    CompositeInstruction program = decodeCompositeFields();
+    decodeChildren(program);
+    if (node_cursor_ != nodes_.size())
+      throw std::runtime_error("ProgramCodec, unexpected data after the program");
+
+    return program;
+  }
+
+private:
+  struct Column
+  {
+    SectionView<double> data;
+    std::size_t cursor{ 0 };
+
+    Eigen::VectorXd take(std::uint32_t count)
+    {
+      if (count > data.size() - cursor)
+        throw std::runtime_error("ProgramCodec, a waypoint column is truncated");
+
+      Eigen::VectorXd values = Eigen::Map<const Eigen::VectorXd>(data.data() + cursor, count);  // NOLINT
+      cursor += count;
+      return values;
+    }
+  };
+
+  SectionView<std::uint64_t> string_offsets_;
+  SectionView<char> string_chars_;
+  SectionView<boost::uuids::uuid> uuids_;
+  SectionView<std::uint64_t> blob_offsets_;
+  SectionView<char> blob_chars_;
+  SectionView<std::uint32_t> name_set_words_;
+  SectionView<std::uint32_t> nodes_;
+  std::size_t node_cursor_{ 0 };
+  Column position_;
+  Column velocity_;
+  Column acceleration_;
+  Column effort_;
+  Column time_;
+  Column values_;
+
+  std::vector<std::string> strings_;
+  std::vector<std::vector<std::string>> name_sets_;
+  std::unordered_map<std::uint32_t, tesseract_common::ManipulatorInfo> manipulator_infos_;
+  std::unordered_map<std::uint32_t, ProfileOverrides> profile_overrides_;
+
+  std::uint32_t next()
+  {
+    if (node_cursor_ >= nodes_.size())
+      throw std::runtime_error("ProgramCodec, the instruction stream is truncated");
+
+    return nodes_[node_cursor_++];
+  }
+
+  const std::string& getString(std::uint32_t id) const
+  {
+    if (id >= strings_.size())
+      throw std::runtime_error("ProgramCodec, invalid string index");
+
+    return strings_[id];
+  }
+
+  const boost::uuids::uuid& getUUID(std::uint32_t id) const
+  {
+    if (id >= uuids_.size())
+      throw std::runtime_error("ProgramCodec, invalid uuid index");
+
+    return uuids_[id];
+  }
+
+  const std::vector<std::string>& getNames(std::uint32_t id) const
+  {
+    if (id >= name_sets_.size())
+      throw std::runtime_error("ProgramCodec, invalid joint names index");
+
+    return name_sets_[id];
+  }
+
+  std::string_view getBlob(std::uint32_t id) const { return getPooled(blob_offsets_, blob_chars_, id); }
+
+  const ProfileOverrides& getProfileOverrides(std::uint32_t id)
+  {
+    static const ProfileOverrides empty_overrides;
+    if (id == NONE)
+      return empty_overrides;
+
+    auto it = profile_overrides_.find(id);
+    if (it == profile_overrides_.end())
+    {
+      it = profile_overrides_.emplace(id, ProfileOverrides()).first;
+      fromBlob(getBlob(id), it->second);
+    }
+
+    return it->second;
+  }
+
+  const tesseract_common::ManipulatorInfo& getManipulatorInfo(std::uint32_t id)
+  {
+    static const tesseract_common::ManipulatorInfo empty_info;
+    if (id == NONE)
+      return empty_info;
+
+    auto it = manipulator_infos_.find(id);
+    if (it == manipulator_infos_.end())
+    {
+      it = manipulator_infos_.emplace(id, tesseract_common::ManipulatorInfo()).first;
+      fromBlob(getBlob(id), it->second);
+    }
+
+    return it->second;
+  }
+
+  void decodeJointState(std::vector<std::string>& names,
+                        Eigen::VectorXd& position,
+                        Eigen::VectorXd& velocity,
+                        Eigen::VectorXd& acceleration,
+                        Eigen::VectorXd& effort,
+                        double& time)
+  {
+    names = getNames(next());
+    position = position_.take(next());
+    velocity = velocity_.take(next());
+    acceleration = acceleration_.take(next());
+    effort = effort_.take(next());
+    time = time_.take(1)[0];
+  }
+
+  /** @brief Decode the fields of a composite instruction, leaving its children in the stream */
+  CompositeInstruction decodeCompositeFields()
+  {
+    const boost::uuids::uuid& uuid = getUUID(next());
+    const boost::uuids::uuid& parent_uuid = getUUID(next());
+    const std::string& description = getString(next());
+    const std::string& profile = getString(next());
+    const ProfileOverrides& overrides = getProfileOverrides(next());
+    const tesseract_common::ManipulatorInfo& manipulator_info = getManipulatorInfo(next());
+    const auto order = static_cast<CompositeInstructionOrder>(next());
+
+    CompositeInstruction composite(profile, manipulator_info, order);
+    composite.setUUID(uuid);
+    composite.setParentUUID(parent_uuid);
+    composite.setDescription(description);
+    composite.setProfileOverrides(overrides);
+
+    const std::uint32_t user_data = next();
+    if (user_data != NONE)
+      fromBlob(getBlob(user_data), composite.getUserData());
+
+    return composite;
+  }
+
+  void decodeChildren(CompositeInstruction& composite)
+  {
+    const std::uint32_t count = next();
+    if (count > nodes_.size() - node_cursor_)
+      throw std::runtime_error("ProgramCodec, the instruction stream is truncated");
+
+    composite.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+      decodeInstruction(composite);
+  }
+
+  /**
+   * @brief Decode the next instruction and append it to the composite
+   * @details The instructions are appended while empty and decoded in place, since wrapping a decoded instruction in
+   * its poly type copies it and with it every child of a composite.
+   */
+  void decodeInstruction(CompositeInstruction& parent)
+  {
+    const std::uint32_t kind = next();
+    switch (static_cast<NodeKind>(kind))
+    {
+      case NodeKind::COMPOSITE:
+      {
+        parent.push_back(decodeCompositeFields());
+        decodeChildren(parent.back().as<CompositeInstruction>());
+        return;
+      }
+      case NodeKind::MOVE:
+      {
+        // The default constructor is used since the other constructors generate a random uuid which is overwritten
+        parent.push_back(MoveInstructionPoly(MoveInstruction()));
+        decodeMove(parent.back().as<MoveInstructionPoly>().as<MoveInstruction>());
+        return;
+      }
+      case NodeKind::ARCHIVE:
+      {
+        parent.push_back(InstructionPoly());
+        fromBlob(getBlob(next()), parent.back());
+        return;
+      }
+    }
+
+    throw std::runtime_error("ProgramCodec, unknown instruction kind " + std::to_string(kind));
+  }
+
+  void decodeMove(MoveInstruction& move)
+  {
+    move.setUUID(getUUID(next()));
+    move.setParentUUID(getUUID(next()));
+    move.setMoveType(static_cast<MoveInstructionType>(next()));
+    move.setDescription(getString(next()));
+    move.setProfile(getString(next()));
+    move.setPathProfile(getString(next()));
+    move.setProfileOverrides(getProfileOverrides(next()));
+    move.setPathProfileOverrides(getProfileOverrides(next()));
+    move.setManipulatorInfo(getManipulatorInfo(next()));
+
+    const std::uint32_t kind = next();
+    switch (static_cast<WaypointKind>(kind))
+    {
+      case WaypointKind::STATE:
+      {
+        move.assignStateWaypoint(StateWaypointPoly(StateWaypoint()));
+        auto& swp = move.getWaypoint().as<StateWaypointPoly>().as<StateWaypoint>();
+        swp.setName(getString(next()));
+        double time{ 0 };
+        decodeJointState(
+            swp.getNames(), swp.getPosition(), swp.getVelocity(), swp.getAcceleration(), swp.getEffort(), time);
+        swp.setTime(time);
+        return;
+      }
+      case WaypointKind::JOINT:
+      {
+        move.assignJointWaypoint(JointWaypointPoly(JointWaypoint()));
+        auto& jwp = move.getWaypoint().as<JointWaypointPoly>().as<JointWaypoint>();
+        jwp.setName(getString(next()));
+        jwp.getNames() = getNames(next());
+        const std::uint32_t size = next();
+        jwp.setIsConstrained(next() != 0);
+        jwp.getPosition() = position_.take(size);
+        const std::uint32_t lower_size = next();
+        const std::uint32_t upper_size = next();
+        jwp.getLowerTolerance() = values_.take(lower_size);
+        jwp.getUpperTolerance() = values_.take(upper_size);
+        return;
+      }
+      case WaypointKind::CARTESIAN:
+      {
+        move.assignCartesianWaypoint(CartesianWaypointPoly(CartesianWaypoint()));
+        auto& cwp = move.getWaypoint().as<CartesianWaypointPoly>().as<CartesianWaypoint>();
+        cwp.setName(getString(next()));
+        const Eigen::VectorXd transform = values_.take(12);
+        cwp.getTransform().matrix().topRows<3>() = Eigen::Map<const Eigen::Matrix<double, 3, 4>>(transform.data());
+        const std::uint32_t lower_size = next();
+        const std::uint32_t upper_size = next();
+        cwp.getLowerTolerance() = values_.take(lower_size);
+        cwp.getUpperTolerance() = values_.take(upper_size);
+
+        tesseract_common::JointState& seed = cwp.getSeed();
+        decodeJointState(seed.joint_names, seed.position, seed.velocity, seed.acceleration, seed.effort, seed.time);
+        return;
+      }
+    }
+
+    throw std::runtime_error("ProgramCodec, unknown waypoint kind " + std::to_string(kind));
+  }
+};
+
+#ifndef _WIN32
+/** @brief A read only memory mapping of a file, which is unmapped on destruction */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string& file_path)
+  {
+    fd_ = ::open(file_path.c_str(), O_RDONLY);  // NOLINT
+    if (fd_ < 0)
+      throw std::runtime_error("ProgramCodec, failed to open file: " + file_path);
+
+    struct stat info
+    {
+    };
+    if (::fstat(fd_, &info) != 0)
+    {
+      ::close(fd_);
+      throw std::runtime_error("ProgramCodec, failed to read file: " + file_path);
+    }
+
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ == 0)
+      return;
+
+    void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (data == MAP_FAILED)  // NOLINT
+    {
+      ::close(fd_);
+      throw std::runtime_error("ProgramCodec, failed to map file: " + file_path);
+    }
+    data_ = static_cast<const std::uint8_t*>(data);
+  }
+
+  ~MappedFile()
+  {
+    if (data_ != nullptr)
+      ::munmap(const_cast<std::uint8_t*>(data_), size_);  // NOLINT
+
+    ::close(fd_);
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  const std::uint8_t* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+private:
+  int fd_{ -1 };
+  const std::uint8_t* data_{ nullptr };
+  std::size_t size_{ 0 };
+};
+#endif
+}  // namespace
+
+std::vector<std::uint8_t> ProgramCodec::encode(const CompositeInstruction& program)
+{
+  ProgramEncoder encoder;
+  encoder.addComposite(program);
+  return encoder.finish();
+}
+
+CompositeInstruction ProgramCodec::decode(const std::uint8_t* data, std::size_t size)
+{
+  return ProgramDecoder(data, size).decode();
+}
+
+CompositeInstruction ProgramCodec::decode(const std::vector<std::uint8_t>& data)
+{
+  return decode(data.data(), data.size());
+}
+
+bool ProgramCodec::toFile(const CompositeInstruction& program, const std::string& file_path)
+{
+  const std::vector<std::uint8_t> data = encode(program);
+  std::ofstream os(file_path, std::ios::binary | std::ios::trunc);
+  if (!os)
+  {
+    CONSOLE_BRIDGE_logError("ProgramCodec, failed to open file: %s", file_path.c_str());
+    return false;
+  }
+
+  os.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));  // NOLINT
+  return static_cast<bool>(os);
+}
+
+CompositeInstruction ProgramCodec::fromFile(const std::string& file_path)
+{
+#ifndef _WIN32
+  MappedFile file(file_path);
+  return decode(file.data(), file.size());
+#else
+  std::ifstream is(file_path, std::ios::binary);
+  if (!is)
+    throw std::runtime_error("ProgramCodec, failed to open file: " + file_path);
+
+  std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  return decode(data);
+#endif
+}
+
+}  // namespace tesseract_planning
@@ -26,6 +26,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -40,10 +44,171 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-static const tesseract_planning::locateFilterFn toJointTrajectoryInstructionFilter =
-    [](const tesseract_planning::InstructionPoly& i, const tesseract_planning::CompositeInstruction& /*composite*/) {
-      return i.isMoveInstruction();
-    };
+namespace
+{
+/** @brief Walks a composite instruction tree and accumulates the time of the joint states like toJointTrajectory */
+class JointStateVisitor
+{
+public:
+  /**
+   * @param fn The function called for each joint state
+   * @param skip_unseeded If false a Cartesian waypoint without a seed throws instead of being skipped
+   */
+  explicit JointStateVisitor(const JointStateVisitorFn& fn, bool skip_unseeded = true)
+    : fn_(fn), skip_unseeded_(skip_unseeded)
+  {
+  }
+
+  void visit(const CompositeInstruction& composite)
+  {
+    for (const auto& instruction : composite)
+    {
+      if (instruction.isCompositeInstruction())
+        visit(instruction.as<CompositeInstruction>());
+      else if (instruction.isMoveInstruction())
+        visit(instruction.as<MoveInstructionPoly>().getWaypoint());
+    }
+  }
+
+private:
+  const JointStateVisitorFn& fn_;
+  bool skip_unseeded_;
+  double last_time_{ 0 };
+  double current_time_{ 0 };
+  double total_time_{ 0 };
+
+  void visit(const WaypointPoly& waypoint)
+  {
+    static const Eigen::VectorXd empty;
+    if (waypoint.isJointWaypoint())
+    {
+      const auto& jwp = waypoint.as<JointWaypointPoly>();
+      fn_(JointStateView{ jwp.getNames(), jwp.getPosition(), empty, empty, empty, step() });
+    }
+    else if (waypoint.isStateWaypoint())
+    {
+      const auto& swp = waypoint.as<StateWaypointPoly>();
+
+      // It is possible for sub composites to start back from zero, this accounts for it
+      current_time_ = swp.getTime();
+      if (current_time_ < last_time_)
+        last_time_ = 0;
+
+      total_time_ += (current_time_ - last_time_);
+      last_time_ = current_time_;
+      fn_(JointStateView{ swp.getNames(),
+                          swp.getPosition(),
+                          swp.getVelocity(),
+                          swp.getAcceleration(),
+                          swp.getEffort(),
+                          total_time_ });
+    }
+    else if (waypoint.isCartesianWaypoint())
+    {
+      const auto& cwp = waypoint.as<CartesianWaypointPoly>();
+      if (cwp.hasSeed())
+      {
+        const tesseract_common::JointState& seed = cwp.getSeed();
+        fn_(JointStateView{ seed.joint_names, seed.position, seed.velocity, seed.acceleration, seed.effort, step() });
+      }
+      else if (!skip_unseeded_)
+      {
+        throw std::runtime_error("CartesianWaypoint does not have a seed.");
+      }
+    }
+  }
+
+  /** @brief Waypoints without a time are one second apart */
+  double step()
+  {
+    current_time_ += 1;
+    total_time_ += 1;
+    last_time_ = current_time_;
+    return total_time_;
+  }
+};
+
+/** @brief Writes to a file through a fixed size buffer, so rows are not formatted through the stream one by one */
+class BufferedFileWriter
+{
+public:
+  explicit BufferedFileWriter(const std::string& file_path)
+    : file_(file_path, std::ios::binary | std::ios::trunc), buffer_(BUFFER_SIZE)
+  {
+  }
+  ~BufferedFileWriter() = default;
+  BufferedFileWriter(const BufferedFileWriter&) = delete;
+  BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+  BufferedFileWriter(BufferedFileWriter&&) = delete;
+  BufferedFileWriter& operator=(BufferedFileWriter&&) = delete;
+
+  bool isOpen() const { return file_.is_open(); }
+
+  void write(const char* data, std::size_t size)
+  {
+    if (size > BUFFER_SIZE - used_)
+    {
+      flush();
+      if (size > BUFFER_SIZE)
+      {
+        file_.write(data, static_cast<std::streamsize>(size));
+        return;
+      }
+    }
+    std::copy(data, data + size, buffer_.data() + used_);  // NOLINT
+    used_ += size;
+  }
+
+  void write(char c) { write(&c, 1); }
+
+  void write(const std::string& value) { write(value.data(), value.size()); }
+
+  template <typename T>
+  void writeBinary(const T& value)
+  {
+    write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT
+  }
+
+  void writeBinary(const Eigen::VectorXd& values)
+  {
+    const auto size = sizeof(double) * static_cast<std::size_t>(values.size());
+    write(reinterpret_cast<const char*>(values.data()), size);  // NOLINT
+  }
+
+  /** @brief Write a double the same way as a std::ostream with the default precision */
+  void writeText(double value)
+  {
+    std::array<char, 32> text{};
+    const int size = std::snprintf(text.data(), text.size(), "%g", value);
+    write(text.data(), static_cast<std::size_t>(size));
+  }
+
+  /** @brief Flush the buffer and close the file, returning false if any write failed */
+  bool close()
+  {
+    flush();
+    file_.close();
+    return !file_.fail();
+  }
+
+private:
+  static constexpr std::size_t BUFFER_SIZE{ 1 << 16 };
+  std::ofstream file_;
+  std::vector<char> buffer_;
+  std::size_t used_{ 0 };
+
+  void flush()
+  {
+    file_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+    used_ = 0;
+  }
+};
+}  // namespace
+
+void visitJointStates(const CompositeInstruction& composite_instructions, const JointStateVisitorFn& fn)
+{
+  JointStateVisitor(fn).visit(composite_instructions);
+}
 
 tesseract_common::JointTrajectory toJointTrajectory(const InstructionPoly& instruction)
 {
@@ -60,72 +225,21 @@ tesseract_common::JointTrajectory toJointTrajectory(const InstructionPoly& instr
 tesseract_common::JointTrajectory toJointTrajectory(const CompositeInstruction& composite_instructions)
 {
   tesseract_common::JointTrajectory trajectory;
-  std::vector<std::reference_wrapper<const InstructionPoly>> flattened_program =
-      composite_instructions.flatten(toJointTrajectoryInstructionFilter);
-  trajectory.reserve(flattened_program.size());
+  trajectory.reserve(static_cast<std::size_t>(composite_instructions.getMoveInstructionCount()));
   trajectory.uuid = composite_instructions.getUUID();
   trajectory.description = composite_instructions.getDescription();
 
-  double last_time = 0;
-  double current_time = 0;
-  double total_time = 0;
-  for (auto& i : flattened_program)
-  {
-    if (i.get().isMoveInstruction())
-    {
-      const auto& pi = i.get().as<MoveInstructionPoly>();
-      if (pi.getWaypoint().isJointWaypoint())
-      {
-        const auto& jwp = pi.getWaypoint().as<JointWaypointPoly>();
-        tesseract_common::JointState joint_state;
-        joint_state.joint_names = jwp.getNames();
-        joint_state.position = jwp.getPosition();
-
-        double dt = 1;
-        current_time = current_time + dt;
-        total_time += dt;
-        joint_state.time = total_time;
-        last_time = current_time;
-        trajectory.push_back(joint_state);
-      }
-      else if (pi.getWaypoint().isStateWaypoint())
-      {
-        const auto& swp = pi.getWaypoint().as<StateWaypointPoly>();
-
-        tesseract_common::JointState joint_state;
-        joint_state.joint_names = swp.getNames();
-        joint_state.position = swp.getPosition();
-        joint_state.velocity = swp.getVelocity();
-        joint_state.acceleration = swp.getAcceleration();
-        joint_state.time = swp.getTime();
-
-        // It is possible for sub composites to start back from zero, this accounts for it
-        current_time = joint_state.time;
-        if (current_time < last_time)
-          last_time = 0;
-
-        double dt = current_time - last_time;
-        total_time += dt;
-        joint_state.time = total_time;
-        last_time = current_time;
-        trajectory.push_back(joint_state);
-      }
-      else if (pi.getWaypoint().isCartesianWaypoint())
-      {
-        const auto& cwp = pi.getWaypoint().as<CartesianWaypointPoly>();
-        if (cwp.hasSeed())
-        {
-          tesseract_common::JointState joint_state = cwp.getSeed();
-          double dt = 1;
-          current_time = current_time + dt;
-          total_time += dt;
-          joint_state.time = total_time;
-          last_time = current_time;
-          trajectory.push_back(joint_state);
-        }
-      }
-    }
-  }
+  visitJointStates(composite_instructions, [&trajectory](const JointStateView& state) {
+    tesseract_common::JointState joint_state;
+    joint_state.joint_names = state.joint_names;
+    joint_state.position = state.position;
+    joint_state.velocity = state.velocity;
+    joint_state.acceleration = state.acceleration;
+    joint_state.effort = state.effort;
+    joint_state.time = state.time;
+    trajectory.push_back(std::move(joint_state));
+  });
+
   return trajectory;
 }
 
@@ -354,29 +468,113 @@ bool clampToJointLimits(WaypointPoly& wp,
 
 bool toDelimitedFile(const CompositeInstruction& composite_instructions, const std::string& file_path, char separator)
 {
-  static const Eigen::IOFormat eigen_format(
-      Eigen::StreamPrecision, Eigen::DontAlignCols, "", std::string(&separator, 1));
-  std::ofstream myfile;
-  myfile.open(file_path);
+  BufferedFileWriter writer(file_path);
+  if (!writer.isOpen())
+  {
+    CONSOLE_BRIDGE_logError("toDelimitedFile: Failed to open file: %s", file_path.c_str());
+    return false;
+  }
 
-  std::vector<std::reference_wrapper<const InstructionPoly>> mi = composite_instructions.flatten(&moveFilter);
+  bool has_header{ false };
+  JointStateVisitorFn fn = [&writer, &has_header, separator](const JointStateView& state) {
+    // Write Joint names as header
+    if (!has_header)
+    {
+      for (std::size_t i = 0; i < state.joint_names.size(); ++i)
+      {
+        if (i > 0)
+          writer.write(separator);
+        writer.write(state.joint_names[i]);
+      }
+      writer.write('\n');
+      has_header = true;
+    }
 
-  // Write Joint names as header
-  std::vector<std::string> joint_names = getJointNames(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
+    // Write Positions
+    for (Eigen::Index i = 0; i < state.position.size(); ++i)
+    {
+      if (i > 0)
+        writer.write(separator);
+      writer.writeText(state.position(i));
+    }
+    writer.write('\n');
+  };
+
+  // A Cartesian waypoint without a seed has no joint positions to write, so it is an error like in getJointPosition
+  JointStateVisitor(fn, false).visit(composite_instructions);
+  return writer.close();
+}
 
-  for (std::size_t i = 0; i < joint_names.size() - 1; ++i)
-    myfile << joint_names[i] << separator;
+bool toBinaryFile(const CompositeInstruction& composite_instructions, const std::string& file_path)
+{
+  BufferedFileWriter writer(file_path);
+  if (!writer.isOpen())
+  {
+    CONSOLE_BRIDGE_logError("toBinaryFile: Failed to open file: %s", file_path.c_str());
+    return false;
+  }
 
-  myfile << joint_names.back() << std::endl;
+  static const std::array<char, 4> magic{ 'T', 'J', 'T', 'B' };
+  writer.write(magic.data(), magic.size());
+  writer.writeBinary<std::uint32_t>(1);
+
+  bool has_header{ false };
+  bool consistent{ true };
+  Eigen::Index dof{ 0 };
+  visitJointStates(composite_instructions, [&](const JointStateView& state) {
+    if (!consistent)
+      return;
+
+    if (!has_header)
+    {
+      dof = state.position.size();
+      writer.writeBinary(static_cast<std::uint32_t>(state.joint_names.size()));
+      for (const auto& name : state.joint_names)
+      {
+        writer.writeBinary(static_cast<std::uint32_t>(name.size()));
+        writer.write(name);
+      }
+      has_header = true;
+    }
 
-  // Write Positions
-  for (const auto& i : mi)
+    if (state.position.size() != dof)
+    {
+      consistent = false;
+      return;
+    }
+
+    static constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    writer.writeBinary(state.time);
+    writer.writeBinary(state.position);
+    for (const Eigen::VectorXd* values : { &state.velocity, &state.acceleration })
+    {
+      if (values->size() == dof)
+      {
+        writer.writeBinary(*values);
+        continue;
+      }
+
+      for (Eigen::Index i = 0; i < dof; ++i)
+        writer.writeBinary(nan);
+    }
+  });
+
+  if (!has_header)
+    writer.writeBinary<std::uint32_t>(0);
+
+  const bool success = writer.close();
+  if (!consistent)
+    CONSOLE_BRIDGE_logError("toBinaryFile: The number of joints is not consistent across the program!");
+  else if (!success)
+    CONSOLE_BRIDGE_logError("toBinaryFile: Failed to write file: %s", file_path.c_str());
+
+  // Do not leave a partial file behind which could be mistaken for a complete trajectory
+  if (!consistent || !success)
   {
-    const Eigen::VectorXd& p = getJointPosition(i.get().as<MoveInstructionPoly>().getWaypoint());
-    myfile << p.format(eigen_format) << std::endl;
+    std::remove(file_path.c_str());
+    return false;
   }
 
-  myfile.close();
   return true;
 }
 
@@ -0,0 +1,100 @@
+/**
+ * @file benchmark_utils.hpp
+ * @brief Utilities shared by the benchmarks of this package
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMAND_LANGUAGE_TEST_BENCHMARK_UTILS_HPP
+#define TESSERACT_COMMAND_LANGUAGE_TEST_BENCHMARK_UTILS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+
+namespace tesseract_planning::test_suite
+{
+/**
+ * @brief Create a time parameterized six joint program split into raster segments of at most 1000 waypoints
+ * @param size The number of waypoints
+ * @return The program
+ */
+inline CompositeInstruction createBenchmarkProgram(std::size_t size)
+{
+  CompositeInstruction program("DEFAULT", tesseract_common::ManipulatorInfo("manipulator", "world", "tool0"));
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  for (std::size_t i = 0; i < size; i += 1000)
+  {
+    CompositeInstruction segment("RASTER");
+    segment.setDescription("raster_segment");
+    for (std::size_t j = i; j < std::min(i + 1000, size); ++j)
+    {
+      StateWaypoint swp(joint_names, Eigen::VectorXd::Constant(6, 0.001 * static_cast<double>(j)));
+      swp.setVelocity(Eigen::VectorXd::Constant(6, 0.1));
+      swp.setAcceleration(Eigen::VectorXd::Zero(6));
+      swp.setTime(0.01 * static_cast<double>(j));
+      segment.appendMoveInstruction(MoveInstruction(StateWaypointPoly(swp), MoveInstructionType::LINEAR, "RASTER"));
+    }
+    program.push_back(segment);
+  }
+  return program;
+}
+
+/**
+ * @brief Run the registered benchmarks, writing the results as JSON
+ * @details Unless --benchmark_out is provided the results are written to the default file in the working directory,
+ * so the results can be tracked per commit.
+ * @param argc The number of command line arguments
+ * @param argv The command line arguments
+ * @param default_out The file the results are written to if --benchmark_out is not provided
+ * @return The exit code of the benchmark executable
+ */
+inline int runBenchmarks(int argc, char** argv, const std::string& default_out)
+{
+  std::vector<char*> args(argv, argv + argc);
+  std::string out_arg = "--benchmark_out=" + default_out;
+  std::string format_arg = "--benchmark_out_format=json";
+  bool has_out{ false };
+  for (int i = 1; i < argc; ++i)
+    has_out = has_out || (std::string(argv[i]).rfind("--benchmark_out=", 0) == 0);  // NOLINT
+
+  if (!has_out)
+  {
+    args.push_back(out_arg.data());
+    args.push_back(format_arg.data());
+  }
+
+  int args_count = static_cast<int>(args.size());
+  benchmark::Initialize(&args_count, args.data());
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+}  // namespace tesseract_planning::test_suite
+
+#endif  // TESSERACT_COMMAND_LANGUAGE_TEST_BENCHMARK_UTILS_HPP
@@ -44,6 +44,8 @@
 #include <tesseract_command_language/timer_instruction.h>
 #include <tesseract_command_language/wait_instruction.h>
 #include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/program_codec.h>
+#include <tesseract_common/utils.h>
 
 #include "command_language_test_program.hpp"
 
@@ -674,6 +676,92 @@ TEST(TesseractCommandLanguageUnit, CompositeInstructionTests)  // NOLINT
   }
 }
 
+TEST(TesseractCommandLanguageUnit, ProgramCodecTests)  // NOLINT
+{
+  CompositeInstruction program = getTestProgram(
+      "raster_program", CompositeInstructionOrder::ORDERED, ManipulatorInfo("manipulator", "world", "tool0"));
+  program.setProfileOverrides({ { "ns", "override_profile" } });
+  program.getUserData()["key"] = 5.0;
+
+  std::vector<std::uint8_t> data = ProgramCodec::encode(program);
+  EXPECT_EQ(ProgramCodec::decode(data), program);
+
+  std::string file_path = tesseract_common::getTempPath() + "program_codec_unit.tprg";
+  EXPECT_TRUE(ProgramCodec::toFile(program, file_path));
+  EXPECT_EQ(ProgramCodec::fromFile(file_path), program);
+
+  // Invalid data
+  EXPECT_ANY_THROW(ProgramCodec::decode(nullptr, 0));                       // NOLINT
+  EXPECT_ANY_THROW(ProgramCodec::decode(data.data(), data.size() / 2));     // NOLINT
+  EXPECT_ANY_THROW(ProgramCodec::fromFile(file_path + ".does_not_exist"));  // NOLINT
+
+  data[4] = static_cast<std::uint8_t>(ProgramCodec::VERSION + 1);
+  EXPECT_ANY_THROW(ProgramCodec::decode(data));  // NOLINT
+
+  // The equality of waypoints does not compare every column, so these are checked one by one
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3" };
+  StateWaypoint swp(joint_names, Eigen::Vector3d(0.1, 0.2, 0.3));
+  swp.setVelocity(Eigen::Vector3d(1.1, 1.2, 1.3));
+  swp.setAcceleration(Eigen::Vector3d(2.1, 2.2, 2.3));
+  swp.getEffort() = Eigen::Vector3d(3.1, 3.2, 3.3);
+  swp.setTime(4.5);
+
+  tesseract_common::JointState seed;
+  seed.joint_names = joint_names;
+  seed.position = Eigen::Vector3d(0.4, 0.5, 0.6);
+  seed.velocity = Eigen::Vector3d(1.4, 1.5, 1.6);
+  seed.acceleration = Eigen::Vector3d(2.4, 2.5, 2.6);
+  seed.effort = Eigen::Vector3d(3.4, 3.5, 3.6);
+  seed.time = 5.5;
+  CartesianWaypoint cwp(Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -0.3, 0.8));
+  cwp.setSeed(seed);
+
+  CompositeInstruction columns_program("DEFAULT", ManipulatorInfo("manipulator", "world", "tool0"));
+  columns_program.appendMoveInstruction(MoveInstruction(StateWaypointPoly(swp), MoveInstructionType::LINEAR, "RASTER"));
+  columns_program.appendMoveInstruction(
+      MoveInstruction(CartesianWaypointPoly(cwp), MoveInstructionType::LINEAR, "RASTER"));
+  columns_program.appendMoveInstruction(
+      MoveInstruction(CartesianWaypointPoly(CartesianWaypoint()), MoveInstructionType::LINEAR, "RASTER"));
+  columns_program.push_back(WaitInstruction(WaitInstructionType::DIGITAL_INPUT_HIGH, 7));
+  columns_program.push_back(TimerInstruction(TimerInstructionType::DIGITAL_OUTPUT_HIGH, 2.5, 3));
+
+  CompositeInstruction decoded = ProgramCodec::decode(ProgramCodec::encode(columns_program));
+  ASSERT_EQ(decoded.size(), columns_program.size());
+  EXPECT_EQ(decoded, columns_program);
+
+  const auto& decoded_swp = decoded.at(0).as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+  EXPECT_EQ(decoded_swp.getNames(), joint_names);
+  EXPECT_TRUE(decoded_swp.getPosition().isApprox(swp.getPosition()));
+  EXPECT_TRUE(decoded_swp.getVelocity().isApprox(swp.getVelocity()));
+  EXPECT_TRUE(decoded_swp.getAcceleration().isApprox(swp.getAcceleration()));
+  EXPECT_TRUE(decoded_swp.getEffort().isApprox(swp.getEffort()));
+  EXPECT_DOUBLE_EQ(decoded_swp.getTime(), swp.getTime());
+
+  const auto& decoded_cwp = decoded.at(1).as<MoveInstructionPoly>().getWaypoint().as<CartesianWaypointPoly>();
+  ASSERT_TRUE(decoded_cwp.hasSeed());
+  EXPECT_EQ(decoded_cwp.getSeed().joint_names, joint_names);
+  EXPECT_TRUE(decoded_cwp.getSeed().position.isApprox(seed.position));
+  EXPECT_TRUE(decoded_cwp.getSeed().velocity.isApprox(seed.velocity));
+  EXPECT_TRUE(decoded_cwp.getSeed().acceleration.isApprox(seed.acceleration));
+  EXPECT_TRUE(decoded_cwp.getSeed().effort.isApprox(seed.effort));
+  EXPECT_DOUBLE_EQ(decoded_cwp.getSeed().time, seed.time);
+  EXPECT_TRUE(decoded_cwp.getTransform().isApprox(cwp.getTransform()));
+  EXPECT_FALSE(decoded.at(2).as<MoveInstructionPoly>().getWaypoint().as<CartesianWaypointPoly>().hasSeed());
+
+  // Instructions without columns of their own go through the embedded archive
+  ASSERT_TRUE(isWaitInstruction(decoded.at(3)));
+  const auto& wait = decoded.at(3).as<WaitInstruction>();
+  EXPECT_EQ(wait.getWaitType(), WaitInstructionType::DIGITAL_INPUT_HIGH);
+  EXPECT_EQ(wait.getWaitIO(), 7);
+  EXPECT_EQ(wait.getUUID(), columns_program.at(3).getUUID());
+
+  ASSERT_TRUE(isTimerInstruction(decoded.at(4)));
+  const auto& timer = decoded.at(4).as<TimerInstruction>();
+  EXPECT_EQ(timer.getTimerType(), TimerInstructionType::DIGITAL_OUTPUT_HIGH);
+  EXPECT_DOUBLE_EQ(timer.getTimerTime(), 2.5);
+  EXPECT_EQ(timer.getTimerIO(), 3);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -169,6 +171,22 @@ TEST(TesseractCommandLanguageUtilsUnit, toJointTrajectoryTests)  // NOLINT
 
   InstructionPoly error_poly{ MoveInstruction() };
   EXPECT_ANY_THROW(toJointTrajectory(error_poly));  // NOLINT
+
+  // The effort of state waypoints is copied along with the velocity and acceleration
+  std::vector<std::string> joint_names = { "1", "2", "3" };
+  StateWaypoint swp(joint_names, Eigen::VectorXd::Constant(3, 10));
+  swp.setVelocity(Eigen::VectorXd::Constant(3, 1));
+  swp.setAcceleration(Eigen::VectorXd::Constant(3, 2));
+  swp.getEffort() = Eigen::VectorXd::Constant(3, 3);
+  CompositeInstruction composite;
+  composite.appendMoveInstruction(MoveInstruction(StateWaypointPoly(swp), MoveInstructionType::LINEAR));
+  composite.appendMoveInstruction(
+      MoveInstruction(CartesianWaypointPoly(CartesianWaypoint()), MoveInstructionType::LINEAR));
+  jt = toJointTrajectory(composite);
+  ASSERT_EQ(jt.size(), 1);
+  EXPECT_TRUE(jt[0].velocity.isApprox(swp.getVelocity()));
+  EXPECT_TRUE(jt[0].acceleration.isApprox(swp.getAcceleration()));
+  EXPECT_TRUE(jt[0].effort.isApprox(swp.getEffort()));
 }
 
 TEST(TesseractCommandLanguageUtilsUnit, getJointPositionTests)  // NOLINT
@@ -597,6 +615,83 @@ TEST(TesseractCommandLanguageUtilsUnit, toDelimitedFile)  // NOLINT
   std::string check = "1,2,3\n5,5,5\n10,10,10\n15,15,15\n";
   std::cout << buffer.str() << std::endl;
   EXPECT_EQ(check, buffer.str());
+
+  // A Cartesian waypoint with a seed writes the seed
+  tesseract_common::JointState seed;
+  seed.joint_names = joint_names;
+  seed.position = Eigen::VectorXd::Constant(3, 20);
+  CartesianWaypoint cwp;
+  cwp.setSeed(seed);
+  composite.appendMoveInstruction(MoveInstruction(CartesianWaypointPoly(cwp), MoveInstructionType::LINEAR));
+  EXPECT_TRUE(toDelimitedFile(composite, path));
+  file.open(path);
+  buffer.str("");
+  buffer << file.rdbuf();
+  file.close();
+  EXPECT_EQ(check + "20,20,20\n", buffer.str());
+
+  // A Cartesian waypoint without a seed has no joint positions
+  composite.appendMoveInstruction(
+      MoveInstruction(CartesianWaypointPoly(CartesianWaypoint()), MoveInstructionType::LINEAR));
+  EXPECT_ANY_THROW(toDelimitedFile(composite, path));  // NOLINT
+}
+
+TEST(TesseractCommandLanguageUtilsUnit, toBinaryFile)  // NOLINT
+{
+  CompositeInstruction composite;
+  composite.setDescription("To Binary File: Composite");
+
+  std::vector<std::string> joint_names = { "1", "2", "3" };
+  {
+    JointWaypointPoly jwp{ JointWaypoint(joint_names, Eigen::VectorXd::Constant(3, 5)) };
+    composite.appendMoveInstruction(MoveInstruction(jwp, MoveInstructionType::FREESPACE));
+  }
+  {
+    StateWaypoint swp(joint_names, Eigen::VectorXd::Constant(3, 10));
+    swp.setVelocity(Eigen::VectorXd::Constant(3, 1));
+    swp.setAcceleration(Eigen::VectorXd::Constant(3, 2));
+    swp.setTime(3);
+    composite.appendMoveInstruction(MoveInstruction(StateWaypointPoly(swp), MoveInstructionType::LINEAR));
+  }
+
+  // A Cartesian waypoint without a seed is skipped
+  composite.appendMoveInstruction(
+      MoveInstruction(CartesianWaypointPoly(CartesianWaypoint()), MoveInstructionType::LINEAR));
+
+  std::vector<double> times;
+  visitJointStates(composite, [&times](const JointStateView& state) { times.push_back(state.time); });
+  EXPECT_EQ(times, std::vector<double>({ 1, 3 }));
+
+  std::string path = tesseract_common::getTempPath() + "to_binary_file.bin";
+  EXPECT_TRUE(toBinaryFile(composite, path));
+
+  std::ifstream file(path, std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+
+  // Magic, version, joint count, three names of one character and two rows of ten doubles
+  const std::size_t header_size = 4 + 4 + 4 + (3 * (4 + 1));
+  ASSERT_EQ(data.size(), header_size + (2 * 10 * sizeof(double)));
+  EXPECT_EQ(std::string(data.data(), 4), "TJTB");
+
+  std::vector<double> rows(20);
+  std::memcpy(rows.data(), data.data() + header_size, rows.size() * sizeof(double));
+  EXPECT_DOUBLE_EQ(rows[0], 1);
+  EXPECT_DOUBLE_EQ(rows[1], 5);
+  EXPECT_TRUE(std::isnan(rows[4]));
+  EXPECT_TRUE(std::isnan(rows[7]));
+  EXPECT_DOUBLE_EQ(rows[10], 3);
+  EXPECT_DOUBLE_EQ(rows[11], 10);
+  EXPECT_DOUBLE_EQ(rows[14], 1);
+  EXPECT_DOUBLE_EQ(rows[17], 2);
+
+  // Inconsistent number of joints
+  JointWaypointPoly jwp{ JointWaypoint(std::vector<std::string>{ "1" }, Eigen::VectorXd::Zero(1)) };
+  composite.appendMoveInstruction(MoveInstruction(jwp, MoveInstructionType::FREESPACE));
+  EXPECT_FALSE(toBinaryFile(composite, path));
+
+  // The partial file is removed
+  EXPECT_FALSE(std::ifstream(path).good());
 }
 
 int main(int argc, char** argv)
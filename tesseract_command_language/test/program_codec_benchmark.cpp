@@ -0,0 +1,152 @@
+/**
+ * @file program_codec_benchmark.cpp
+ * @brief Compare the program codec against the Boost archives
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <fstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/serialization.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/program_codec.h>
+#include "benchmark_utils.hpp"
+
+using namespace tesseract_planning;
+
+double getFileSize(const std::string& file_path)
+{
+  std::ifstream is(file_path, std::ios::binary | std::ios::ate);
+  return static_cast<double>(is.tellg());
+}
+
+static void BM_ProgramCodecEncode(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    std::vector<std::uint8_t> data = ProgramCodec::encode(program);
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+BENCHMARK(BM_ProgramCodecEncode)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ProgramCodecDecode(benchmark::State& state)
+{
+  std::vector<std::uint8_t> data =
+      ProgramCodec::encode(test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state)
+  {
+    CompositeInstruction program = ProgramCodec::decode(data);
+    benchmark::DoNotOptimize(program);
+  }
+}
+
+BENCHMARK(BM_ProgramCodecDecode)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ProgramCodecSave(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.tprg";
+  for (auto _ : state)
+    ProgramCodec::toFile(program, file_path);
+
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_ProgramCodecSave)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ProgramCodecLoad(benchmark::State& state)
+{
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.tprg";
+  ProgramCodec::toFile(test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0))), file_path);
+  for (auto _ : state)
+  {
+    CompositeInstruction program = ProgramCodec::fromFile(file_path);
+    benchmark::DoNotOptimize(program);
+  }
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_ProgramCodecLoad)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BoostBinarySave(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.binary";
+  for (auto _ : state)
+    tesseract_common::Serialization::toArchiveFileBinary<CompositeInstruction>(program, file_path);
+
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_BoostBinarySave)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BoostBinaryLoad(benchmark::State& state)
+{
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.binary";
+  tesseract_common::Serialization::toArchiveFileBinary<CompositeInstruction>(
+      test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0))), file_path);
+  for (auto _ : state)
+  {
+    auto program = tesseract_common::Serialization::fromArchiveFileBinary<CompositeInstruction>(file_path);
+    benchmark::DoNotOptimize(program);
+  }
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_BoostBinaryLoad)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BoostXMLSave(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.xml";
+  for (auto _ : state)
+    tesseract_common::Serialization::toArchiveFileXML<CompositeInstruction>(program, file_path);
+
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_BoostXMLSave)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BoostXMLLoad(benchmark::State& state)
+{
+  const std::string file_path = tesseract_common::getTempPath() + "program_codec_benchmark.xml";
+  tesseract_common::Serialization::toArchiveFileXML<CompositeInstruction>(
+      test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0))), file_path);
+  for (auto _ : state)
+  {
+    auto program = tesseract_common::Serialization::fromArchiveFileXML<CompositeInstruction>(file_path);
+    benchmark::DoNotOptimize(program);
+  }
+  state.counters["file_size"] = getFileSize(file_path);
+}
+
+BENCHMARK(BM_BoostXMLLoad)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
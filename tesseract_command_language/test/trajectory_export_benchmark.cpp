@@ -0,0 +1,87 @@
+/**
+ * @file trajectory_export_benchmark.cpp
+ * @brief Throughput of the joint trajectory exporters
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/joint_state.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/utils.h>
+#include "benchmark_utils.hpp"
+
+using namespace tesseract_planning;
+
+static void BM_VisitJointStates(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    double total{ 0 };
+    visitJointStates(program, [&total](const JointStateView& js) { total += js.position(0); });
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_VisitJointStates)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ToJointTrajectory(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    tesseract_common::JointTrajectory trajectory = toJointTrajectory(program);
+    benchmark::DoNotOptimize(trajectory);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ToJointTrajectory)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ToDelimitedFile(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  const std::string file_path = tesseract_common::getTempPath() + "trajectory_export_benchmark.csv";
+  for (auto _ : state)
+    toDelimitedFile(program, file_path);
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ToDelimitedFile)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ToBinaryFile(benchmark::State& state)
+{
+  CompositeInstruction program = test_suite::createBenchmarkProgram(static_cast<std::size_t>(state.range(0)));
+  const std::string file_path = tesseract_common::getTempPath() + "trajectory_export_benchmark.bin";
+  for (auto _ : state)
+    toBinaryFile(program, file_path);
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ToBinaryFile)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
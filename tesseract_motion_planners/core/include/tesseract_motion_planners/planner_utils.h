@@ -30,6 +30,8 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 #include <console_bridge/console.h>
+#include <type_traits>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/constants.h>
@@ -106,9 +108,9 @@ std::shared_ptr<const ProfileType> getProfile(const std::string& ns,
                                               const ProfileDictionary& profile_dictionary,
                                               std::shared_ptr<const ProfileType> default_profile = nullptr)
 {
-  if (profile_dictionary.hasProfile(ProfileType::getStaticKey(), ns, profile))
-    return std::static_pointer_cast<const ProfileType>(
-        profile_dictionary.getProfile(ProfileType::getStaticKey(), ns, profile));
+  Profile::ConstPtr found = profile_dictionary.findProfile(ProfileType::getStaticKey(), ns, profile);
+  if (found != nullptr)
+    return std::static_pointer_cast<const ProfileType>(found);
 
   CONSOLE_BRIDGE_logDebug("Profile '%s' was not found in namespace '%s' for type '%s'. Using default if available. "
                           "Available "
@@ -127,6 +129,93 @@ std::shared_ptr<const ProfileType> getProfile(const std::string& ns,
 
   return default_profile;
 }
+
+/**
+ * @brief Gets the profile specified by a pre-hashed handle from the profile map
+ * @details The handle must be created with ProfileType::getStaticKey() as the key
+ * @param handle The profile handle
+ * @param profile_dictionary The profile dictionary
+ * @param default_profile Profile that is returned if the requested profile is not found in the map. Default = nullptr
+ * @return The profile requested if found. Otherwise the default_profile
+ */
+template <typename ProfileType>
+std::shared_ptr<const ProfileType> getProfile(const ProfileHandle& handle,
+                                              const ProfileDictionary& profile_dictionary,
+                                              std::shared_ptr<const ProfileType> default_profile = nullptr)
+{
+  assert(handle.getKey() == ProfileType::getStaticKey());
+  Profile::ConstPtr found = profile_dictionary.findProfile(handle);
+  if (found != nullptr)
+    return std::static_pointer_cast<const ProfileType>(found);
+
+  return getProfile<ProfileType>(handle.getNamespace(), handle.getName(), profile_dictionary, default_profile);
+}
+
+/**
+ * @brief Memoizes profile lookups for the duration of a single planning request
+ * @details Instructions typically share a small number of profile names, so each unique profile name is only looked up
+ * in the profile dictionary once and the default profile is only constructed the first time a profile is missing.
+ * @tparam ProfileType The profile type to look up
+ * @tparam DefaultProfileType The profile type constructed if the requested profile is not found, if void nullptr is
+ * returned instead
+ */
+template <typename ProfileType, typename DefaultProfileType = void>
+class ProfileResolver
+{
+public:
+  /**
+   * @brief Constructor
+   * @param ns The namespace to search for requested profiles
+   * @param profile_dictionary The profile dictionary, it must outlive the resolver
+   */
+  ProfileResolver(std::string ns, const ProfileDictionary& profile_dictionary)
+    : ns_(std::move(ns)), profile_dictionary_(profile_dictionary)
+  {
+  }
+
+  /**
+   * @brief Get the profile with the provided name
+   * @param profile The requested profile
+   * @return The profile requested if found. Otherwise the default profile
+   */
+  const std::shared_ptr<const ProfileType>& get(const std::string& profile)
+  {
+    // Consecutive instructions usually share the same profile
+    if (last_ != nullptr && last_->first == profile)
+      return last_->second;
+
+    auto it = cache_.find(profile);
+    if (it == cache_.end())
+    {
+      std::shared_ptr<const ProfileType> found = getProfile<ProfileType>(ns_, profile, profile_dictionary_);
+      if (found == nullptr)
+        found = getDefaultProfile();
+
+      it = cache_.emplace(profile, std::move(found)).first;
+    }
+
+    last_ = &(*it);
+    return it->second;
+  }
+
+private:
+  std::string ns_;
+  const ProfileDictionary& profile_dictionary_;
+  std::unordered_map<std::string, std::shared_ptr<const ProfileType>> cache_;
+  const std::pair<const std::string, std::shared_ptr<const ProfileType>>* last_{ nullptr };
+  std::shared_ptr<const ProfileType> default_profile_;
+
+  const std::shared_ptr<const ProfileType>& getDefaultProfile()
+  {
+    if constexpr (!std::is_void_v<DefaultProfileType>)
+    {
+      if (default_profile_ == nullptr)
+        default_profile_ = std::make_shared<DefaultProfileType>();
+    }
+
+    return default_profile_;
+  }
+};
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_PLANNER_UTILS_H
@@ -26,6 +26,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/profile_dictionary.h>
@@ -142,6 +143,125 @@ TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryTest)  // NOLINT
   EXPECT_EQ(profile_check4->a, 20);
 }
 
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryHandleTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+
+  ProfileHandle handle(ProfileBase::getStaticKey(), "ns", "key");
+  EXPECT_EQ(handle.getKey(), ProfileBase::getStaticKey());
+  EXPECT_EQ(handle.getNamespace(), "ns");
+  EXPECT_EQ(handle.getName(), "key");
+  EXPECT_EQ(handle.getHash(), ProfileHandle::hash(ProfileBase::getStaticKey(), "ns", "key"));
+  EXPECT_EQ(handle, ProfileHandle(ProfileBase::getStaticKey(), "ns", "key"));
+  EXPECT_NE(handle, ProfileHandle(ProfileBase::getStaticKey(), "ns", "key2"));
+  EXPECT_NE(handle, ProfileHandle(ProfileBase2::getStaticKey(), "ns", "key"));
+
+  EXPECT_FALSE(profiles.hasProfile(handle));
+  EXPECT_TRUE(profiles.findProfile(handle) == nullptr);
+  EXPECT_ANY_THROW(profiles.getProfile(handle));  // NOLINT
+  EXPECT_TRUE(getProfile<ProfileBase>(handle, profiles) == nullptr);
+
+  profiles.addProfile("ns", std::vector<std::string>{ "key", "key2" }, std::make_shared<ProfileTest>(10));
+  profiles.addProfile("ns", "key", std::make_shared<ProfileTest2>(5));
+  EXPECT_TRUE(profiles.hasProfile(handle));
+  EXPECT_TRUE(profiles.findProfile(handle) != nullptr);
+  EXPECT_TRUE(profiles.findProfile(ProfileBase::getStaticKey(), "ns", "key2") != nullptr);
+  EXPECT_TRUE(profiles.findProfile(ProfileBase::getStaticKey(), "ns", "DoesNotExist") == nullptr);
+
+  auto profile = getProfile<ProfileBase>(handle, profiles);
+  EXPECT_TRUE(profile != nullptr);
+  EXPECT_EQ(profile->a, 10);
+
+  auto profile2 = getProfile<ProfileBase2>(ProfileHandle(ProfileBase2::getStaticKey(), "ns", "key"), profiles);
+  EXPECT_TRUE(profile2 != nullptr);
+  EXPECT_EQ(profile2->b, 5);
+
+  // Check remove profile
+  profiles.removeProfile(ProfileBase::getStaticKey(), "ns", "key");
+  EXPECT_FALSE(profiles.hasProfile(handle));
+  EXPECT_TRUE(profiles.hasProfile(ProfileBase::getStaticKey(), "ns", "key2"));
+  EXPECT_TRUE(profiles.hasProfile(ProfileBase2::getStaticKey(), "ns", "key"));
+
+  // Check remove profile entry
+  profiles.removeProfileEntry(ProfileBase::getStaticKey(), "ns");
+  EXPECT_FALSE(profiles.hasProfileEntry(ProfileBase::getStaticKey(), "ns"));
+  EXPECT_FALSE(profiles.hasProfile(ProfileBase::getStaticKey(), "ns", "key2"));
+  EXPECT_TRUE(profiles.hasProfileEntry(ProfileBase2::getStaticKey(), "ns"));
+
+  // Check clear
+  profiles.clear();
+  EXPECT_FALSE(profiles.hasProfileEntry(ProfileBase2::getStaticKey(), "ns"));
+  EXPECT_FALSE(profiles.hasProfile(ProfileBase2::getStaticKey(), "ns", "key"));
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryConcurrentTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  profiles.addProfile("ns", "key", std::make_shared<ProfileTest>(1));
+
+  const ProfileHandle handle(ProfileBase::getStaticKey(), "ns", "key");
+  std::vector<std::thread> readers;
+  std::vector<int> failures(4, 0);
+  for (std::size_t i = 0; i < failures.size(); ++i)
+  {
+    readers.emplace_back([&profiles, &handle, &failures, i]() {
+      for (int j = 0; j < 1000; ++j)
+      {
+        // The profile is only ever replaced so it must always be found
+        auto profile = getProfile<ProfileBase>(handle, profiles);
+        if (profile == nullptr || profile->a < 1)
+          ++failures[i];
+
+        if (!profiles.hasProfileEntry(ProfileBase::getStaticKey(), "ns") ||
+            profiles.findProfile(ProfileBase::getStaticKey(), "ns", "key") == nullptr)
+          ++failures[i];
+      }
+    });
+  }
+
+  for (int i = 2; i < 100; ++i)
+  {
+    profiles.addProfile("ns", "key", std::make_shared<ProfileTest>(i));
+    profiles.addProfile("ns", "key" + std::to_string(i), std::make_shared<ProfileTest2>(i));
+  }
+
+  for (auto& reader : readers)
+    reader.join();
+
+  for (const auto& failure : failures)
+    EXPECT_EQ(failure, 0);
+
+  EXPECT_EQ(getProfile<ProfileBase>(handle, profiles)->a, 99);
+  EXPECT_EQ(profiles.getProfileEntry(ProfileBase2::getStaticKey(), "ns").size(), 98);
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileResolverTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  profiles.addProfile("ns", "key", std::make_shared<ProfileTest>(10));
+
+  ProfileResolver<ProfileBase, ProfileTest> resolver("ns", profiles);
+  auto profile = resolver.get("key");
+  EXPECT_TRUE(profile != nullptr);
+  EXPECT_EQ(profile->a, 10);
+  EXPECT_EQ(resolver.get("key"), profile);
+
+  // Missing profiles share a single default profile
+  auto default_profile = resolver.get("DoesNotExist");
+  EXPECT_TRUE(default_profile != nullptr);
+  EXPECT_EQ(default_profile->a, 0);
+  EXPECT_EQ(resolver.get("DoesNotExist2"), default_profile);
+  EXPECT_EQ(resolver.get("key"), profile);
+
+  // The resolver memoizes the lookup for the duration of a request
+  profiles.addProfile("ns", "key", std::make_shared<ProfileTest>(20));
+  EXPECT_EQ(resolver.get("key")->a, 10);
+
+  ProfileResolver<ProfileBase> resolver_no_default("ns", profiles);
+  EXPECT_EQ(resolver_no_default.get("key")->a, 20);
+  EXPECT_TRUE(resolver_no_default.get("DoesNotExist") == nullptr);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -83,6 +83,8 @@ PlannerResponse DescartesMotionPlanner<FloatType>::solve(const PlannerRequest& r
   auto move_instructions = request.instructions.flatten(&moveFilter);
 
   // Transform plan instructions into descartes samplers
+  ProfileResolver<DescartesPlanProfile<FloatType>, DescartesDefaultPlanProfile<FloatType>> plan_profiles(
+      name_, *request.profiles);
   int index = 0;
   for (const auto& instruction : move_instructions)
   {
@@ -90,11 +92,7 @@ PlannerResponse DescartesMotionPlanner<FloatType>::solve(const PlannerRequest& r
     const auto& move_instruction = instruction.get().template as<MoveInstructionPoly>();
 
     // Get Plan Profile
-    auto cur_plan_profile =
-        getProfile<DescartesPlanProfile<FloatType>>(name_,
-                                                    move_instruction.getProfile(name_),
-                                                    *request.profiles,
-                                                    std::make_shared<DescartesDefaultPlanProfile<FloatType>>());
+    const auto& cur_plan_profile = plan_profiles.get(move_instruction.getProfile(name_));
 
     if (!cur_plan_profile)
       throw std::runtime_error("DescartesMotionPlanner: Invalid profile");
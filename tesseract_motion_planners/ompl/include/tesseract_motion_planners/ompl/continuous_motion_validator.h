@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/types.h>
+#include <tesseract_common/eigen_types.h>
 #include <tesseract_collision/core/fwd.h>
 #include <tesseract_kinematics/core/fwd.h>
 #include <tesseract_environment/fwd.h>
@@ -49,7 +50,12 @@ using StateValidityCheckerPtr = std::shared_ptr<StateValidityChecker>;
 
 namespace tesseract_planning
 {
-/** @brief Continuous collision check between two states */
+/**
+ * @brief Continuous collision check between two states
+ * @details The motion is split into validSegmentCount casts. Forward kinematics is computed once per interpolated
+ * state and shared by the two casts which meet at that state. When the last valid state is not requested the casts
+ * are checked from coarse to fine, so a collision anywhere along a long motion is found in fewer checks.
+ */
 class ContinuousMotionValidator : public ompl::base::MotionValidator
 {
 public:
@@ -67,13 +73,58 @@ public:
                    std::pair<ompl::base::State*, double>& lastValid) const override;
 
 private:
+  /** @brief The contact manager and forward kinematics buffer owned by a single thread */
+  struct ThreadLocalData
+  {
+    /** @brief The cached continuous contact manager */
+    std::shared_ptr<tesseract_collision::ContinuousContactManager> contact_manager;
+
+    /** @brief The active link transforms of every interpolated state, stored state by state */
+    tesseract_common::VectorIsometry3d link_transforms;
+
+    /** @brief Indicates if the link transforms of an interpolated state have been computed */
+    std::vector<bool> computed;
+  };
+
+  /**
+   * @brief Get the data of the calling thread prepared for a motion with the provided number of segments
+   * @param n_steps The number of segments of the motion
+   * @return The thread local data
+   */
+  ThreadLocalData& getThreadLocalData(unsigned n_steps) const;
+
+  /**
+   * @brief Check a single segment of the motion between two ompl states
+   * @param s1 The start of the motion
+   * @param s2 The end of the motion
+   * @param step The index of the segment, which ends at the interpolated state with the same index
+   * @param n_steps The number of segments of the motion
+   * @param interp A state used for interpolating
+   * @param data The thread local data
+   * @return True if the end state is valid and the segment is not in collision, otherwise false.
+   */
+  bool checkSegment(const ompl::base::State* s1,
+                    const ompl::base::State* s2,
+                    unsigned step,
+                    unsigned n_steps,
+                    ompl::base::State* interp,
+                    ThreadLocalData& data) const;
+
   /**
-   * @brief Perform a continuous collision check between two ompl states
-   * @param s1 First OMPL State
-   * @param s2 Second OMPL State
-   * @return True if not in collision, otherwise false.
+   * @brief Compute the active link transforms of an interpolated state if they have not already been computed
+   * @param s1 The start of the motion
+   * @param s2 The end of the motion
+   * @param step The index of the interpolated state
+   * @param n_steps The number of segments of the motion
+   * @param interp A state used for interpolating
+   * @param data The thread local data
    */
-  bool continuousCollisionCheck(const ompl::base::State* s1, const ompl::base::State* s2) const;
+  void computeLinkTransforms(const ompl::base::State* s1,
+                             const ompl::base::State* s2,
+                             unsigned step,
+                             unsigned n_steps,
+                             ompl::base::State* interp,
+                             ThreadLocalData& data) const;
 
   /**
    * @brief The state validator without collision checking
@@ -102,9 +153,8 @@ private:
   /** @brief Contact manager caching mutex */
   mutable std::mutex mutex_;
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, std::shared_ptr<tesseract_collision::ContinuousContactManager>>
-      continuous_contact_managers_;
+  /** @brief The continuous contact manager and forward kinematics buffer cache */
+  mutable std::map<unsigned long int, std::unique_ptr<ThreadLocalData>> thread_data_;
 };
 }  // namespace tesseract_planning
 
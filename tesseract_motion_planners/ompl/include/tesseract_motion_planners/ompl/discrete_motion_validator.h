@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/MotionValidator.h>
+#include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace ompl::base
@@ -41,17 +42,54 @@ using StateValidityCheckerPtr = std::shared_ptr<StateValidityChecker>;
 
 namespace tesseract_planning
 {
-/** @brief Continuous collision check between two states */
+/**
+ * @brief Discrete collision check between two states
+ * @details The interpolated states are checked using the state validity checker of the space information. When the
+ * last valid state is not requested they may be checked from coarse to fine, which rejects an edge colliding somewhere
+ * in the middle in far fewer checks. This benefits lazy planners like LazyPRMstar and RRTConnect the most.
+ *
+ * An optional cache remembers the result of recently validated states and motions. It is shared by every planner
+ * thread using this validator, so identical states and edges are not checked again.
+ */
 class DiscreteMotionValidator : public ompl::base::MotionValidator
 {
 public:
-  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info);
+  /**
+   * @brief Constructor
+   * @param space_info The space information
+   * @param bisect If true the interpolated states are checked from coarse to fine, otherwise from start to end
+   * @param cache_size The number of recently validated states and motions to remember, zero disables the cache
+   */
+  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                          bool bisect = false,
+                          std::size_t cache_size = 0);
+  ~DiscreteMotionValidator() override;
+  DiscreteMotionValidator(const DiscreteMotionValidator&) = delete;
+  DiscreteMotionValidator& operator=(const DiscreteMotionValidator&) = delete;
+  DiscreteMotionValidator(DiscreteMotionValidator&&) = delete;
+  DiscreteMotionValidator& operator=(DiscreteMotionValidator&&) = delete;
 
   bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const override;
 
   bool checkMotion(const ompl::base::State* s1,
                    const ompl::base::State* s2,
                    std::pair<ompl::base::State*, double>& lastValid) const override;
+
+private:
+  struct Cache;
+
+  /** @brief Indicate if the interpolated states are checked from coarse to fine */
+  bool bisect_{ false };
+
+  /** @brief The cache of recently validated states and motions, nullptr if disabled */
+  std::unique_ptr<Cache> cache_;
+
+  /**
+   * @brief Check if a state is valid, using the cache if enabled
+   * @param state The state to check
+   * @return True if valid, otherwise false
+   */
+  bool isValid(const ompl::base::State* state) const;
 };
 }  // namespace tesseract_planning
 
@@ -33,6 +33,10 @@ struct PRMstarConfigurator;
 struct LazyPRMstarConfigurator;
 struct SPARSConfigurator;
 
+// ompl_roadmap_store.h
+struct OMPLRoadmap;
+class OMPLRoadmapStore;
+
 // ompl_solver_config.h
 struct OMPLSolverConfig;
 
@@ -46,6 +46,7 @@ class Planner;
 using PlannerPtr = std::shared_ptr<Planner>;
 class SpaceInformation;
 using SpaceInformationPtr = std::shared_ptr<SpaceInformation>;
+class PlannerData;
 }  // namespace ompl::base
 namespace tesseract_planning
 {
@@ -81,6 +82,21 @@ struct OMPLPlannerConfigurator
 
   virtual ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const = 0;
 
+  /**
+   * @brief Create the planner seeded with the roadmap of an earlier request
+   * @details Only the PRM family of planners use the roadmap, every other planner ignores it
+   * @param si The space information, which must also be the space information of the roadmap
+   * @param roadmap The roadmap, which must only hold states and motions valid in the space information
+   */
+  virtual ompl::base::PlannerPtr createWithRoadmap(ompl::base::SpaceInformationPtr si,
+                                                   const ompl::base::PlannerData& roadmap) const;
+
+  /**
+   * @brief Indicate if the roadmap of the created planner only holds validated states and motions
+   * @details If true the roadmap may be stored for later requests
+   */
+  virtual bool providesRoadmap() const;
+
   virtual OMPLPlannerType getType() const = 0;
 
 protected:
@@ -404,6 +420,12 @@ struct PRMConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner seeded with the roadmap of an earlier request */
+  ompl::base::PlannerPtr createWithRoadmap(ompl::base::SpaceInformationPtr si,
+                                           const ompl::base::PlannerData& roadmap) const override;
+
+  bool providesRoadmap() const override;
+
   OMPLPlannerType getType() const override;
 
 protected:
@@ -424,6 +446,12 @@ struct PRMstarConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner seeded with the roadmap of an earlier request */
+  ompl::base::PlannerPtr createWithRoadmap(ompl::base::SpaceInformationPtr si,
+                                           const ompl::base::PlannerData& roadmap) const override;
+
+  bool providesRoadmap() const override;
+
   OMPLPlannerType getType() const override;
 
 protected:
@@ -444,6 +472,10 @@ struct LazyPRMstarConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner seeded with the roadmap of an earlier request */
+  ompl::base::PlannerPtr createWithRoadmap(ompl::base::SpaceInformationPtr si,
+                                           const ompl::base::PlannerData& roadmap) const override;
+
   OMPLPlannerType getType() const override;
 
 protected:
@@ -0,0 +1,230 @@
+/**
+ * @file ompl_roadmap_store.h
+ * @brief A persistent store of OMPL roadmaps shared across planning requests
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_STORE_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_STORE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/serialization/access.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/fwd.h>
+#include <tesseract_kinematics/core/fwd.h>
+
+namespace ompl::base
+{
+class PlannerData;
+}
+
+namespace tesseract_planning
+{
+/**
+ * @brief A roadmap of validated states and motions independent of an OMPL space information
+ * @details The states are stored as the real values of the state space so the roadmap may be loaded into the space
+ * information of a later request for the same manipulator.
+ */
+struct OMPLRoadmap
+{
+  using Ptr = std::shared_ptr<OMPLRoadmap>;
+  using ConstPtr = std::shared_ptr<const OMPLRoadmap>;
+
+  /** @brief The real values of every state in the roadmap */
+  std::vector<std::vector<double>> vertices;
+
+  /** @brief The undirected edges between the vertices, stored once with the lower index first */
+  std::vector<std::pair<unsigned, unsigned>> edges;
+
+  /**
+   * @brief Create a roadmap from planner data
+   * @param data The planner data, usually extracted from a PRM planner
+   * @return The roadmap
+   */
+  static OMPLRoadmap fromPlannerData(const ompl::base::PlannerData& data);
+
+  /**
+   * @brief Add the states and motions of the roadmap which are valid in the space information of planner data
+   * @details The roadmap may have been built with other profile settings than the space information, for example a
+   * smaller collision margin, so unless validate is false every state and motion is checked again and the invalid ones
+   * are discarded. The states are allocated by the space information of the planner data, which takes ownership of
+   * them.
+   * @param data The planner data to populate, it should be empty and its space information must be setup
+   * @param validate If false every state and motion is added without checking it, which is only correct if the roadmap
+   * was validated with the same settings as the space information
+   */
+  void toPlannerData(ompl::base::PlannerData& data, bool validate = true) const;
+
+  /**
+   * @brief Create a copy of the roadmap holding at most the first max_vertices vertices
+   * @param max_vertices The maximum number of vertices
+   * @return The roadmap, with the edges to the removed vertices removed as well
+   */
+  OMPLRoadmap truncated(std::size_t max_vertices) const;
+
+private:
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+/**
+ * @brief A thread safe store of roadmaps which persists across planning requests
+ * @details A roadmap is stored per environment and manipulator. It is only valid for the revision and state of the
+ * environment it was built in, so once either changes the next lookup discards it. When several requests extend the
+ * same roadmap at once the roadmap with the most vertices is kept.
+ *
+ * Every roadmap is stored with the validation key of the profile which built it, see
+ * OMPLPlanProfile::getValidationKey. A request with the same key uses the roadmap as is, while a request with another
+ * or an empty key validates every state and motion again before a planner is seeded, see OMPLRoadmap::toPlannerData.
+ * The key is not saved, so roadmaps loaded from a file are always validated again before they are used. The time spent
+ * validating counts against the planning time of the request.
+ *
+ * The number of vertices of a stored roadmap is capped, once a roadmap is full the vertices added by later requests
+ * are no longer stored.
+ *
+ * The store is assigned to OMPLSolverConfig::roadmap_store, where the PRM family of planner configurators load the
+ * roadmap before planning and the validated roadmap they built is stored again afterwards.
+ */
+class OMPLRoadmapStore
+{
+public:
+  using Ptr = std::shared_ptr<OMPLRoadmapStore>;
+  using ConstPtr = std::shared_ptr<const OMPLRoadmapStore>;
+
+  /**
+   * @brief Constructor
+   * @param max_vertices The maximum number of vertices of a stored roadmap
+   */
+  explicit OMPLRoadmapStore(std::size_t max_vertices = 10000);
+  ~OMPLRoadmapStore() = default;
+  OMPLRoadmapStore(const OMPLRoadmapStore&) = delete;
+  OMPLRoadmapStore& operator=(const OMPLRoadmapStore&) = delete;
+  OMPLRoadmapStore(OMPLRoadmapStore&&) = delete;
+  OMPLRoadmapStore& operator=(OMPLRoadmapStore&&) = delete;
+
+  /**
+   * @brief Get the roadmap of a manipulator
+   * @param env The environment
+   * @param manip The manipulator
+   * @return The roadmap, or nullptr if there is none or the environment changed since it was stored
+   */
+  OMPLRoadmap::ConstPtr get(const tesseract_environment::Environment& env,
+                            const tesseract_kinematics::JointGroup& manip) const;
+
+  /**
+   * @brief Get the roadmap of a manipulator and whether it needs to be validated again
+   * @param env The environment
+   * @param manip The manipulator
+   * @param validation_key The validation key of the request
+   * @param validated Set to true if the roadmap was stored with the same, non empty, validation key
+   * @return The roadmap, or nullptr if there is none or the environment changed since it was stored
+   */
+  OMPLRoadmap::ConstPtr get(const tesseract_environment::Environment& env,
+                            const tesseract_kinematics::JointGroup& manip,
+                            const std::string& validation_key,
+                            bool& validated) const;
+
+  /**
+   * @brief Store the roadmap of a manipulator
+   * @details An existing roadmap for the same revision, state and validation key with more vertices is kept instead.
+   * A roadmap with more vertices than the maximum is truncated.
+   * @param env The environment the roadmap was built in
+   * @param manip The manipulator
+   * @param roadmap The roadmap
+   * @param validation_key The validation key of the settings every state and motion of the roadmap is valid for
+   */
+  void put(const tesseract_environment::Environment& env,
+           const tesseract_kinematics::JointGroup& manip,
+           OMPLRoadmap::ConstPtr roadmap,
+           std::string validation_key = "");
+
+  /**
+   * @brief Remove the roadmaps of every manipulator of an environment
+   * @param env The environment
+   */
+  void invalidate(const tesseract_environment::Environment& env);
+
+  /** @brief Remove all roadmaps */
+  void clear();
+
+  /** @brief The number of roadmaps stored */
+  std::size_t size() const;
+
+  /** @brief The maximum number of vertices of a stored roadmap */
+  std::size_t getMaxVertices() const;
+
+  /**
+   * @brief Save the store to a binary file
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  bool save(const std::string& file_path) const;
+
+  /**
+   * @brief Load the store from a binary file, replacing all roadmaps
+   * @details The validation keys are not saved, so the roadmaps are validated again when first used
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  bool load(const std::string& file_path);
+
+  struct Entry
+  {
+    /** @brief The revision of the environment */
+    int revision{ 0 };
+
+    /** @brief The values of the environment joints which are not part of the manipulator */
+    std::map<std::string, double> joint_values;
+
+    /** @brief The roadmap */
+    OMPLRoadmap::ConstPtr roadmap;
+
+    /** @brief The validation key of the roadmap, this is not serialized */
+    std::string validation_key;
+
+  private:
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version);  // NOLINT
+  };
+
+protected:
+  std::size_t max_vertices_;
+
+  mutable std::mutex mutex_;
+
+  /** @brief The entries keyed by environment name and manipulator name */
+  mutable std::map<std::pair<std::string, std::string>, Entry> entries_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_STORE_H
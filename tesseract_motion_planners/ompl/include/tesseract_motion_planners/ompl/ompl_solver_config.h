@@ -34,6 +34,7 @@
 namespace tesseract_planning
 {
 struct OMPLPlannerConfigurator;
+class OMPLRoadmapStore;
 struct OMPLSolverConfig
 {
   using Ptr = std::shared_ptr<OMPLSolverConfig>;
@@ -77,6 +78,15 @@ struct OMPLSolverConfig
    */
   std::vector<std::shared_ptr<const OMPLPlannerConfigurator>> planners;
 
+  /**
+   * @brief The store of roadmaps shared across requests, nullptr disables it
+   *
+   * When set the PRM family of planners start from the roadmap built by earlier requests for the same environment and
+   * manipulator and the roadmap they extend is stored again afterwards. Since the store holds runtime data it is not
+   * serialized, use OMPLRoadmapStore::save and OMPLRoadmapStore::load to persist it.
+   */
+  std::shared_ptr<OMPLRoadmapStore> roadmap_store;
+
 protected:
   friend class boost::serialization::access;
   template <class Archive>
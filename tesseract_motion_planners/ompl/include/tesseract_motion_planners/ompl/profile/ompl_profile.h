@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
 #include <vector>
 #include <memory>
 #include <Eigen/Geometry>
@@ -92,6 +93,14 @@ public:
                     const tesseract_common::ManipulatorInfo& composite_mi,
                     const std::shared_ptr<const tesseract_environment::Environment>& env) const = 0;
 
+  /**
+   * @brief Get a key identifying the settings which decide which states and motions are valid
+   * @details Profiles with the same non empty key must accept the same states and motions, so a stored roadmap built
+   * with one of them is used by the others without validating it again, see OMPLRoadmapStore.
+   * @return The validation key, the default is empty so stored roadmaps are always validated again
+   */
+  virtual std::string getValidationKey() const;
+
 protected:
   friend class boost::serialization::access;
   template <class Archive>
@@ -74,6 +74,18 @@ public:
   /** @brief The collision check configuration */
   tesseract_collision::CollisionCheckConfig collision_check_config;
 
+  /**
+   * @brief Check the interpolated states of a discrete motion from coarse to fine instead of from start to end
+   * @details This rejects invalid edges sooner, which mostly benefits lazy planners like LazyPRMstar and RRTConnect
+   */
+  bool motion_validator_bisect{ false };
+
+  /**
+   * @brief The number of recently validated states and motions the discrete motion validator remembers
+   * @details The cache is shared by all planner threads of a plan, zero disables it
+   */
+  std::size_t motion_validator_cache_size{ 0 };
+
   std::unique_ptr<OMPLSolverConfig> createSolverConfig() const override;
 
   OMPLStateExtractor createStateExtractor(const tesseract_kinematics::JointGroup& manip) const override;
@@ -84,6 +96,12 @@ public:
                     const tesseract_common::ManipulatorInfo& composite_mi,
                     const std::shared_ptr<const tesseract_environment::Environment>& env) const override;
 
+  /**
+   * @brief The validation key is the profile type and the collision check configuration
+   * @details Derived profiles which override the validators with settings of their own should override this as well
+   */
+  std::string getValidationKey() const override;
+
 protected:
   static void applyGoalStates(ompl::geometric::SimpleSetup& simple_setup,
                               const tesseract_kinematics::KinGroupIKInput& ik_input,
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Core>
 #include <functional>
 #include <memory>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/types.h>
@@ -88,6 +89,17 @@ void processLongestValidSegment(const ompl::base::StateSpacePtr& state_space_ptr
 void processLongestValidSegment(const ompl::base::StateSpacePtr& state_space_ptr,
                                 const tesseract_collision::CollisionCheckConfig& collision_check_config);
 
+/**
+ * @brief Get the indices of an interval ordered from coarse to fine
+ * @details The midpoint of the interval is first, followed by the midpoints of each half in breadth first order. When
+ * checking the states along a motion in this order a collision anywhere along it is usually found in far fewer checks
+ * than when checking from start to end.
+ * @param first The first index of the interval
+ * @param last The last index of the interval
+ * @return Every index of the interval once, or an empty vector if last is less than first
+ */
+std::vector<unsigned> getBisectionOrder(unsigned first, unsigned last);
+
 /**
  * @brief For the provided problem check if the state is in collision
  * @param contact_map Map of contact results. Will be empty if return true
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 
 #include <tesseract_environment/environment.h>
 #include <tesseract_kinematics/core/joint_group.h>
@@ -60,8 +61,23 @@ ContinuousMotionValidator::ContinuousMotionValidator(
 
 bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
-  std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
-  return checkMotion(s1, s2, dummy);
+  const unsigned n_steps = si_->getStateSpace()->validSegmentCount(s1, s2);
+  ThreadLocalData& data = getThreadLocalData(n_steps);
+
+  // Without the last valid state the segments are checked coarse to fine, since the first collision found is enough
+  bool is_valid = true;
+  ompl::base::State* interp = si_->allocState();
+  for (unsigned step : getBisectionOrder(1, n_steps))
+  {
+    if (!checkSegment(s1, s2, step, n_steps, interp, data))
+    {
+      is_valid = false;
+      break;
+    }
+  }
+  si_->freeState(interp);
+
+  return is_valid;
 }
 
 bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1,
@@ -69,89 +85,125 @@ bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1,
                                             std::pair<ompl::base::State*, double>& lastValid) const
 {
   const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+  const unsigned n_steps = state_space.validSegmentCount(s1, s2);
+  ThreadLocalData& data = getThreadLocalData(n_steps);
 
-  unsigned n_steps = state_space.validSegmentCount(s1, s2);
   bool is_valid = true;
-
-  ompl::base::State* start_interp = si_->allocState();
-  if (n_steps > 1)
+  ompl::base::State* interp = si_->allocState();
+  for (unsigned step = 1; step <= n_steps; ++step)
   {
-    ompl::base::State* end_interp = si_->allocState();
-
-    for (unsigned i = 1; i < n_steps; ++i)
+    if (!checkSegment(s1, s2, step, n_steps, interp, data))
     {
-      state_space.interpolate(s1, s2, (i - 1) / static_cast<double>(n_steps), start_interp);
-      state_space.interpolate(s1, s2, (i) / static_cast<double>(n_steps), end_interp);
-      if (state_validator_ && !state_validator_->isValid(end_interp))
-      {
-        lastValid.second = static_cast<double>(i - 1) / static_cast<double>(n_steps);
-        if (lastValid.first != nullptr)
-          state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
-
-        is_valid = false;
-      }
-      else if (!continuousCollisionCheck(start_interp, end_interp))
-      {
-        lastValid.second = (i - 1) / static_cast<double>(n_steps);
-        if (lastValid.first != nullptr)
-          state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
-
-        is_valid = false;
-      }
-    }
-
-    si_->freeState(end_interp);
-  }
-
-  if (is_valid)
-  {
-    state_space.interpolate(s1, s2, (n_steps - 1) / static_cast<double>(n_steps), start_interp);
-    if ((state_validator_ != nullptr && !state_validator_->isValid(s2)) || !continuousCollisionCheck(start_interp, s2))
-    {
-      lastValid.second = static_cast<double>(n_steps - 1) / static_cast<double>(n_steps);
+      lastValid.second = static_cast<double>(step - 1) / static_cast<double>(n_steps);
       if (lastValid.first != nullptr)
         state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
 
       is_valid = false;
+      break;
     }
   }
-
-  si_->freeState(start_interp);
+  si_->freeState(interp);
 
   return is_valid;
 }
 
-bool ContinuousMotionValidator::continuousCollisionCheck(const ompl::base::State* s1, const ompl::base::State* s2) const
+ContinuousMotionValidator::ThreadLocalData& ContinuousMotionValidator::getThreadLocalData(unsigned n_steps) const
 {
   // It was time using chronos time elapsed and it was faster to cache the contact manager
   unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::ContinuousContactManager::Ptr cm;
+  ThreadLocalData* data{ nullptr };
   mutex_.lock();
-  auto it = continuous_contact_managers_.find(hash);
-  if (it == continuous_contact_managers_.end())
+  auto it = thread_data_.find(hash);
+  if (it == thread_data_.end())
   {
-    cm = continuous_contact_manager_->clone();
-    continuous_contact_managers_[hash] = cm;
+    auto new_data = std::make_unique<ThreadLocalData>();
+    new_data->contact_manager = continuous_contact_manager_->clone();
+    data = new_data.get();
+    thread_data_[hash] = std::move(new_data);
   }
   else
   {
-    cm = it->second;
+    data = it->second.get();
   }
   mutex_.unlock();
 
-  Eigen::Map<Eigen::VectorXd> start_joints = extractor_(s1);
-  Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(s2);
+  // The buffer only grows so it is not reallocated for every motion
+  const std::size_t n_transforms = (n_steps + 1) * links_.size();
+  if (data->link_transforms.size() < n_transforms)
+    data->link_transforms.resize(n_transforms);
+
+  data->computed.assign(n_steps + 1, false);
+  return *data;
+}
+
+bool ContinuousMotionValidator::checkSegment(const ompl::base::State* s1,
+                                             const ompl::base::State* s2,
+                                             unsigned step,
+                                             unsigned n_steps,
+                                             ompl::base::State* interp,
+                                             ThreadLocalData& data) const
+{
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+  const ompl::base::State* end_state = s2;
+  if (step < n_steps)
+  {
+    state_space.interpolate(s1, s2, static_cast<double>(step) / static_cast<double>(n_steps), interp);
+    end_state = interp;
+  }
 
-  tesseract_common::TransformMap state0 = manip_->calcFwdKin(start_joints);
-  tesseract_common::TransformMap state1 = manip_->calcFwdKin(finish_joints);
+  if (state_validator_ && !state_validator_->isValid(end_state))
+    return false;
 
-  for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state0[link_name], state1[link_name]);
+  computeLinkTransforms(s1, s2, step, n_steps, interp, data);
+  computeLinkTransforms(s1, s2, step - 1, n_steps, interp, data);
+
+  const std::size_t start_offset = (step - 1) * links_.size();
+  const std::size_t end_offset = step * links_.size();
+  for (std::size_t i = 0; i < links_.size(); ++i)
+  {
+    data.contact_manager->setCollisionObjectsTransform(
+        links_[i], data.link_transforms[start_offset + i], data.link_transforms[end_offset + i]);
+  }
 
   tesseract_collision::ContactResultMap contact_map;
-  cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
+  data.contact_manager->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
 
   return contact_map.empty();
 }
 
+void ContinuousMotionValidator::computeLinkTransforms(const ompl::base::State* s1,
+                                                      const ompl::base::State* s2,
+                                                      unsigned step,
+                                                      unsigned n_steps,
+                                                      ompl::base::State* interp,
+                                                      ThreadLocalData& data) const
+{
+  if (data.computed[step])
+    return;
+
+  const ompl::base::State* state = interp;
+  if (step == 0)
+  {
+    state = s1;
+  }
+  else if (step == n_steps)
+  {
+    state = s2;
+  }
+  else
+  {
+    // The interpolated state may hold a different step so it is always interpolated again
+    si_->getStateSpace()->interpolate(s1, s2, static_cast<double>(step) / static_cast<double>(n_steps), interp);
+  }
+
+  Eigen::Map<Eigen::VectorXd> joints = extractor_(state);
+  tesseract_common::TransformMap transforms = manip_->calcFwdKin(joints);
+
+  const std::size_t offset = step * links_.size();
+  for (std::size_t i = 0; i < links_.size(); ++i)
+    data.link_transforms[offset + i] = transforms[links_[i]];
+
+  data.computed[step] = true;
+}
+
 }  // namespace tesseract_planning
@@ -26,21 +26,155 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 
 namespace tesseract_planning
 {
-DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info)
-  : MotionValidator(space_info)
+namespace
 {
+struct RealsHash
+{
+  std::size_t operator()(const std::vector<double>& reals) const
+  {
+    std::size_t seed = reals.size();
+    for (double value : reals)
+      seed ^= std::hash<double>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+    return seed;
+  }
+};
+
+/** @brief A thread safe least recently used cache of validity results keyed by the exact values of the states */
+class ValidityCache
+{
+public:
+  explicit ValidityCache(std::size_t capacity) : capacity_(capacity) {}
+
+  std::optional<bool> find(const std::vector<double>& key)
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end())
+      return std::nullopt;
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  void insert(const std::vector<double>& key, bool valid)
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+      it->second->second = valid;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return;
+    }
+
+    entries_.emplace_front(key, valid);
+    index_[key] = entries_.begin();
+    if (entries_.size() > capacity_)
+    {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+private:
+  using Entries = std::list<std::pair<std::vector<double>, bool>>;
+
+  std::mutex mutex_;
+  std::size_t capacity_;
+  Entries entries_;
+  std::unordered_map<std::vector<double>, Entries::iterator, RealsHash> index_;
+};
+}  // namespace
+
+struct DiscreteMotionValidator::Cache
+{
+  explicit Cache(std::size_t capacity) : states(capacity), motions(capacity) {}
+
+  ValidityCache states;
+  ValidityCache motions;
+};
+
+DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                                                 bool bisect,
+                                                 std::size_t cache_size)
+  : MotionValidator(space_info), bisect_(bisect)
+{
+  if (cache_size > 0)
+    cache_ = std::make_unique<Cache>(cache_size);
 }
 
+DiscreteMotionValidator::~DiscreteMotionValidator() = default;
+
 bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
-  std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
-  return checkMotion(s1, s2, dummy);
+  if (!bisect_ && cache_ == nullptr)
+  {
+    std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
+    return checkMotion(s1, s2, dummy);
+  }
+
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+
+  std::vector<double> motion_key;
+  if (cache_ != nullptr)
+  {
+    std::vector<double> end_reals;
+    state_space.copyToReals(motion_key, s1);
+    state_space.copyToReals(end_reals, s2);
+    motion_key.insert(motion_key.end(), end_reals.begin(), end_reals.end());
+    if (std::optional<bool> valid = cache_->motions.find(motion_key))
+      return *valid;
+  }
+
+  unsigned n_steps = state_space.validSegmentCount(s1, s2);
+
+  // The end state is checked first since it is the one most likely shared with other motions
+  bool is_valid = isValid(s2);
+  if (is_valid && n_steps > 1)
+  {
+    std::vector<unsigned> order;
+    if (bisect_)
+    {
+      order = getBisectionOrder(1, n_steps - 1);
+    }
+    else
+    {
+      order.reserve(n_steps - 1);
+      for (unsigned i = 1; i < n_steps; ++i)
+        order.push_back(i);
+    }
+
+    ompl::base::State* interp = si_->allocState();
+    for (unsigned i : order)
+    {
+      state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), interp);
+      if (!isValid(interp))
+      {
+        is_valid = false;
+        break;
+      }
+    }
+    si_->freeState(interp);
+  }
+
+  if (cache_ != nullptr)
+    cache_->motions.insert(motion_key, is_valid);
+
+  return is_valid;
 }
 
 bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
@@ -59,7 +193,7 @@ bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
     {
       state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), end_interp);
 
-      if (!si_->isValid(end_interp))
+      if (!isValid(end_interp))
       {
         lastValid.second = static_cast<double>(i - 1) / static_cast<double>(n_steps);
         if (lastValid.first != nullptr)
@@ -74,7 +208,7 @@ bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
 
   if (is_valid)
   {
-    if (!si_->isValid(s2))
+    if (!isValid(s2))
     {
       lastValid.second = static_cast<double>(n_steps - 1) / static_cast<double>(n_steps);
       if (lastValid.first != nullptr)
@@ -86,4 +220,19 @@ bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
 
   return is_valid;
 }
+
+bool DiscreteMotionValidator::isValid(const ompl::base::State* state) const
+{
+  if (cache_ == nullptr)
+    return si_->isValid(state);
+
+  std::vector<double> key;
+  si_->getStateSpace()->copyToReals(key, state);
+  if (std::optional<bool> valid = cache_->states.find(key))
+    return *valid;
+
+  const bool valid = si_->isValid(state);
+  cache_->states.insert(key, valid);
+  return valid;
+}
 }  // namespace tesseract_planning
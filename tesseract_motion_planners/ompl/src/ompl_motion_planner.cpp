@@ -29,6 +29,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/goals/GoalStates.h>
+#include <ompl/base/PlannerData.h>
 #include <ompl/geometric/SimpleSetup.h>
 #include <ompl/tools/multiplan/ParallelPlan.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -38,6 +39,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
 #include <tesseract_motion_planners/ompl/ompl_solver_config.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_store.h>
 #include <tesseract_motion_planners/ompl/types.h>
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_profile.h>
@@ -106,16 +108,75 @@ bool OMPLMotionPlanner::terminate()
   return false;
 }
 
+/**
+ * @brief Store the largest validated roadmap built by the planners
+ * @param planners The planners which provide a roadmap
+ * @param solver_config The solver config holding the roadmap store
+ * @param env The environment
+ * @param manip The manipulator
+ * @param validation_key The validation key of the plan profile
+ */
+void storeRoadmap(const std::vector<ompl::base::PlannerPtr>& planners,
+                  const OMPLSolverConfig& solver_config,
+                  const tesseract_environment::Environment& env,
+                  const tesseract_kinematics::JointGroup& manip,
+                  const std::string& validation_key)
+{
+  std::unique_ptr<ompl::base::PlannerData> largest;
+  for (const auto& planner : planners)
+  {
+    auto data = std::make_unique<ompl::base::PlannerData>(planner->getSpaceInformation());
+    planner->getPlannerData(*data);
+    if (largest == nullptr || data->numVertices() > largest->numVertices())
+      largest = std::move(data);
+  }
+
+  if (largest != nullptr)
+    solver_config.roadmap_store->put(
+        env, manip, std::make_shared<OMPLRoadmap>(OMPLRoadmap::fromPlannerData(*largest)), validation_key);
+}
+
 std::pair<bool, std::string> parallelPlan(ompl::geometric::SimpleSetup& simple_setup,
                                           const OMPLSolverConfig& solver_config,
-                                          const unsigned num_output_states)
+                                          const unsigned num_output_states,
+                                          const tesseract_environment::Environment& env,
+                                          const tesseract_kinematics::JointGroup& manip,
+                                          const std::string& validation_key)
 {
   std::string reason;
   simple_setup.setup();
+
+  // Validating a stored roadmap counts against the planning time
+  const ompl::time::point end = ompl::time::now() + ompl::time::seconds(solver_config.planning_time);
   auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(simple_setup.getProblemDefinition());
 
+  // Seed the planners from the roadmap built by earlier requests, which is only validated again if it was built with
+  // other validation settings
+  std::unique_ptr<ompl::base::PlannerData> roadmap;
+  std::vector<ompl::base::PlannerPtr> roadmap_planners;
+  if (solver_config.roadmap_store != nullptr)
+  {
+    bool validated{ false };
+    OMPLRoadmap::ConstPtr stored = solver_config.roadmap_store->get(env, manip, validation_key, validated);
+    if (stored != nullptr)
+    {
+      roadmap = std::make_unique<ompl::base::PlannerData>(simple_setup.getSpaceInformation());
+      stored->toPlannerData(*roadmap, !validated);
+      if (roadmap->numVertices() == 0)
+        roadmap = nullptr;
+    }
+  }
+
   for (const auto& planner : solver_config.planners)
-    parallel_plan->addPlanner(planner->create(simple_setup.getSpaceInformation()));
+  {
+    ompl::base::PlannerPtr p = (roadmap != nullptr) ?
+                                   planner->createWithRoadmap(simple_setup.getSpaceInformation(), *roadmap) :
+                                   planner->create(simple_setup.getSpaceInformation());
+    if (solver_config.roadmap_store != nullptr && planner->providesRoadmap())
+      roadmap_planners.push_back(p);
+
+    parallel_plan->addPlanner(p);
+  }
 
   ompl::base::PlannerStatus status;
   if (!solver_config.optimize)
@@ -123,12 +184,13 @@ std::pair<bool, std::string> parallelPlan(ompl::geometric::SimpleSetup& simple_s
     // Solve problem. Results are stored in the response
     // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
     // and finishes at the end state.
-    status =
-        parallel_plan->solve(solver_config.planning_time, 1, static_cast<unsigned>(solver_config.max_solutions), false);
+    status = parallel_plan->solve(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0),
+                                  1,
+                                  static_cast<unsigned>(solver_config.max_solutions),
+                                  false);
   }
   else
   {
-    ompl::time::point end = ompl::time::now() + ompl::time::seconds(solver_config.planning_time);
     const ompl::base::ProblemDefinitionPtr& pdef = simple_setup.getProblemDefinition();
     while (ompl::time::now() < end)
     {
@@ -175,6 +237,10 @@ std::pair<bool, std::string> parallelPlan(ompl::geometric::SimpleSetup& simple_s
       reason = "Exceeded allowed time";
   }
 
+  // The roadmap is valid even if no solution was found so it is always stored
+  if (!roadmap_planners.empty())
+    storeRoadmap(roadmap_planners, solver_config, env, manip, validation_key);
+
   if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
     return std::make_pair(false, std::string(ERROR_FAILED_TO_FIND_VALID_SOLUTION) + reason);
 
@@ -283,6 +349,7 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
   long start_index{ 0 };
   std::size_t segment{ 1 };
   std::reference_wrapper<const InstructionPoly> start_instruction = move_instructions.front();
+  ProfileResolver<OMPLPlanProfile, OMPLRealVectorPlanProfile> plan_profiles(name_, *request.profiles);
   for (std::size_t i = 1; i < move_instructions.size(); ++i)
   {
     ++num_output_states;
@@ -294,10 +361,7 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
       continue;
 
     // Get Plan Profile
-    auto cur_plan_profile = getProfile<OMPLPlanProfile>(name_,
-                                                        end_move_instruction.getProfile(name_),
-                                                        *request.profiles,
-                                                        std::make_shared<OMPLRealVectorPlanProfile>());
+    const auto& cur_plan_profile = plan_profiles.get(end_move_instruction.getProfile(name_));
 
     if (!cur_plan_profile)
       throw std::runtime_error("OMPLMotionPlanner: Invalid profile");
@@ -324,7 +388,8 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
     }
 
     // Parallel Plan problem
-    auto status = parallelPlan(*simple_setup, *solver_config, num_output_states);
+    auto status = parallelPlan(
+        *simple_setup, *solver_config, num_output_states, *request.env, *manip, cur_plan_profile->getValidationKey());
     if (!status.first)
     {
       response.successful = false;
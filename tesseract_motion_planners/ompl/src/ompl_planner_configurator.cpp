@@ -28,6 +28,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
 #include <ompl/base/Planner.h>
+#include <ompl/base/PlannerData.h>
 
 #include <ompl/geometric/planners/sbl/SBL.h>
 #include <ompl/geometric/planners/est/EST.h>
@@ -41,6 +42,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/rrt/TRRT.h>
 #include <ompl/geometric/planners/prm/PRM.h>
 #include <ompl/geometric/planners/prm/PRMstar.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
 #include <ompl/geometric/planners/prm/SPARS.h>
 
@@ -52,6 +54,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+ompl::base::PlannerPtr OMPLPlannerConfigurator::createWithRoadmap(ompl::base::SpaceInformationPtr si,
+                                                                  const ompl::base::PlannerData& /*roadmap*/) const
+{
+  return create(std::move(si));
+}
+
+bool OMPLPlannerConfigurator::providesRoadmap() const { return false; }
+
 template <class Archive>
 void OMPLPlannerConfigurator::serialize(Archive& /*ar*/, const unsigned int /*version*/)
 {
@@ -270,6 +280,16 @@ ompl::base::PlannerPtr PRMConfigurator::create(ompl::base::SpaceInformationPtr s
   return planner;
 }
 
+ompl::base::PlannerPtr PRMConfigurator::createWithRoadmap(ompl::base::SpaceInformationPtr /*si*/,
+                                                          const ompl::base::PlannerData& roadmap) const
+{
+  auto planner = std::make_shared<ompl::geometric::PRM>(roadmap);
+  planner->setMaxNearestNeighbors(static_cast<unsigned>(max_nearest_neighbors));
+  return planner;
+}
+
+bool PRMConfigurator::providesRoadmap() const { return true; }
+
 OMPLPlannerType PRMConfigurator::getType() const { return OMPLPlannerType::PRM; }
 
 template <class Archive>
@@ -284,6 +304,17 @@ ompl::base::PlannerPtr PRMstarConfigurator::create(ompl::base::SpaceInformationP
   return std::make_shared<ompl::geometric::PRMstar>(si);
 }
 
+ompl::base::PlannerPtr PRMstarConfigurator::createWithRoadmap(ompl::base::SpaceInformationPtr /*si*/,
+                                                              const ompl::base::PlannerData& roadmap) const
+{
+  // PRMstar is PRM using the star strategy, which is the only way to construct it from a roadmap
+  auto planner = std::make_shared<ompl::geometric::PRM>(roadmap, true);
+  planner->setName("PRMstar");
+  return planner;
+}
+
+bool PRMstarConfigurator::providesRoadmap() const { return true; }
+
 OMPLPlannerType PRMstarConfigurator::getType() const { return OMPLPlannerType::PRMstar; }
 
 template <class Archive>
@@ -297,6 +328,15 @@ ompl::base::PlannerPtr LazyPRMstarConfigurator::create(ompl::base::SpaceInformat
   return std::make_shared<ompl::geometric::LazyPRMstar>(si);
 }
 
+ompl::base::PlannerPtr LazyPRMstarConfigurator::createWithRoadmap(ompl::base::SpaceInformationPtr /*si*/,
+                                                                  const ompl::base::PlannerData& roadmap) const
+{
+  // LazyPRMstar is LazyPRM using the star strategy, which is the only way to construct it from a roadmap
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(roadmap, true);
+  planner->setName("LazyPRMstar");
+  return planner;
+}
+
 OMPLPlannerType LazyPRMstarConfigurator::getType() const { return OMPLPlannerType::LazyPRMstar; }
 
 template <class Archive>
@@ -0,0 +1,291 @@
+/**
+ * @file ompl_roadmap_store.cpp
+ * @brief A persistent store of OMPL roadmaps shared across planning requests
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <ompl/base/PlannerData.h>
+#include <ompl/base/SpaceInformation.h>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/ompl/ompl_roadmap_store.h>
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_common/serialization.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief Get the values of the environment joints which are not part of the manipulator */
+std::map<std::string, double> getOtherJointValues(const tesseract_environment::Environment& env,
+                                                  const tesseract_kinematics::JointGroup& manip)
+{
+  const std::vector<std::string> joint_names = manip.getJointNames();
+  std::map<std::string, double> joint_values;
+  for (const auto& joint : env.getState().joints)
+  {
+    if (std::find(joint_names.begin(), joint_names.end(), joint.first) == joint_names.end())
+      joint_values.insert(joint);
+  }
+
+  return joint_values;
+}
+}  // namespace
+
+OMPLRoadmap OMPLRoadmap::fromPlannerData(const ompl::base::PlannerData& data)
+{
+  OMPLRoadmap roadmap;
+  const ompl::base::StateSpace& state_space = *data.getSpaceInformation()->getStateSpace();
+
+  roadmap.vertices.resize(data.numVertices());
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+    state_space.copyToReals(roadmap.vertices[i], data.getVertex(i).getState());
+
+  // The planner data stores every undirected edge in both directions
+  std::vector<unsigned> neighbors;
+  for (unsigned i = 0; i < data.numVertices(); ++i)
+  {
+    data.getEdges(i, neighbors);
+    for (unsigned j : neighbors)
+    {
+      if (i < j || !data.edgeExists(j, i))
+        roadmap.edges.emplace_back(std::min(i, j), std::max(i, j));
+    }
+  }
+
+  return roadmap;
+}
+
+void OMPLRoadmap::toPlannerData(ompl::base::PlannerData& data, bool validate) const
+{
+  const ompl::base::SpaceInformationPtr& si = data.getSpaceInformation();
+  const ompl::base::StateSpace& state_space = *si->getStateSpace();
+
+  // The roadmap may have been built with other validators, collision settings or environment than the space
+  // information, so unless the caller knows it is valid only the states and motions which are still valid are added
+  // and the edges are remapped to the indices of the remaining vertices.
+  std::vector<ompl::base::State*> states;
+  std::vector<unsigned> indices;
+  states.reserve(vertices.size());
+  indices.reserve(vertices.size());
+  for (const auto& vertex : vertices)
+  {
+    if (vertex.size() != si->getStateDimension())
+      throw std::runtime_error("OMPLRoadmap, vertex dimension does not match the state space");
+
+    ompl::base::State* state = si->allocState();
+    state_space.copyFromReals(state, vertex);
+    states.push_back(state);
+
+    if (!validate || (si->satisfiesBounds(state) && si->isValid(state)))
+      indices.push_back(data.addVertex(ompl::base::PlannerDataVertex(state)));
+    else
+      indices.push_back(ompl::base::PlannerData::INVALID_INDEX);
+  }
+
+  std::size_t valid_edges{ 0 };
+  for (const auto& edge : edges)
+  {
+    if (edge.first >= vertices.size() || edge.second >= vertices.size())
+      throw std::runtime_error("OMPLRoadmap, edge references a vertex which does not exist");
+
+    const unsigned first = indices[edge.first];
+    const unsigned second = indices[edge.second];
+    if (first == ompl::base::PlannerData::INVALID_INDEX || second == ompl::base::PlannerData::INVALID_INDEX)
+      continue;
+
+    if (validate && !si->checkMotion(states[edge.first], states[edge.second]))
+      continue;
+
+    data.addEdge(first, second);
+    data.addEdge(second, first);
+    ++valid_edges;
+  }
+
+  if (data.numVertices() != vertices.size() || valid_edges != edges.size())
+    CONSOLE_BRIDGE_logDebug("OMPLRoadmap, discarded %zu of %zu states and %zu of %zu motions which are invalid",
+                            vertices.size() - data.numVertices(),
+                            vertices.size(),
+                            edges.size() - valid_edges,
+                            edges.size());
+
+  // The planner data only references the states until it is decoupled, after which it owns copies of them
+  data.decoupleFromPlanner();
+  for (ompl::base::State* state : states)
+    si->freeState(state);
+}
+
+OMPLRoadmap OMPLRoadmap::truncated(std::size_t max_vertices) const
+{
+  OMPLRoadmap roadmap;
+  const auto size = static_cast<long>(std::min(max_vertices, vertices.size()));
+  roadmap.vertices.assign(vertices.begin(), vertices.begin() + size);
+  for (const auto& edge : edges)
+  {
+    if (edge.first < roadmap.vertices.size() && edge.second < roadmap.vertices.size())
+      roadmap.edges.push_back(edge);
+  }
+
+  return roadmap;
+}
+
+template <class Archive>
+void OMPLRoadmap::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_NVP(vertices);
+  ar& BOOST_SERIALIZATION_NVP(edges);
+}
+
+OMPLRoadmapStore::OMPLRoadmapStore(std::size_t max_vertices) : max_vertices_(max_vertices) {}
+
+OMPLRoadmap::ConstPtr OMPLRoadmapStore::get(const tesseract_environment::Environment& env,
+                                            const tesseract_kinematics::JointGroup& manip) const
+{
+  bool validated{ false };
+  return get(env, manip, "", validated);
+}
+
+OMPLRoadmap::ConstPtr OMPLRoadmapStore::get(const tesseract_environment::Environment& env,
+                                            const tesseract_kinematics::JointGroup& manip,
+                                            const std::string& validation_key,
+                                            bool& validated) const
+{
+  validated = false;
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(std::make_pair(env.getName(), manip.getName()));
+  if (it == entries_.end())
+    return nullptr;
+
+  if (it->second.revision != env.getRevision() || it->second.joint_values != getOtherJointValues(env, manip))
+  {
+    CONSOLE_BRIDGE_logDebug("OMPLRoadmapStore, discarding roadmap of '%s' since the environment changed",
+                            manip.getName().c_str());
+    entries_.erase(it);
+    return nullptr;
+  }
+
+  validated = (!validation_key.empty() && it->second.validation_key == validation_key);
+  return it->second.roadmap;
+}
+
+void OMPLRoadmapStore::put(const tesseract_environment::Environment& env,
+                           const tesseract_kinematics::JointGroup& manip,
+                           OMPLRoadmap::ConstPtr roadmap,
+                           std::string validation_key)
+{
+  if (roadmap == nullptr || roadmap->vertices.empty())
+    return;
+
+  if (roadmap->vertices.size() > max_vertices_)
+    roadmap = std::make_shared<const OMPLRoadmap>(roadmap->truncated(max_vertices_));
+
+  Entry entry;
+  entry.revision = env.getRevision();
+  entry.joint_values = getOtherJointValues(env, manip);
+  entry.roadmap = std::move(roadmap);
+  entry.validation_key = std::move(validation_key);
+
+  std::scoped_lock lock(mutex_);
+  auto key = std::make_pair(env.getName(), manip.getName());
+  auto it = entries_.find(key);
+  if (it != entries_.end() && it->second.revision == entry.revision &&
+      it->second.joint_values == entry.joint_values && it->second.validation_key == entry.validation_key &&
+      it->second.roadmap->vertices.size() > entry.roadmap->vertices.size())
+    return;
+
+  entries_[key] = std::move(entry);
+}
+
+void OMPLRoadmapStore::invalidate(const tesseract_environment::Environment& env)
+{
+  std::scoped_lock lock(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end();)
+    it = (it->first.first == env.getName()) ? entries_.erase(it) : std::next(it);
+}
+
+void OMPLRoadmapStore::clear()
+{
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+}
+
+std::size_t OMPLRoadmapStore::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t OMPLRoadmapStore::getMaxVertices() const { return max_vertices_; }
+
+bool OMPLRoadmapStore::save(const std::string& file_path) const
+{
+  std::scoped_lock lock(mutex_);
+  return tesseract_common::Serialization::toArchiveFileBinary<decltype(entries_)>(entries_, file_path, "roadmaps");
+}
+
+bool OMPLRoadmapStore::load(const std::string& file_path)
+{
+  decltype(entries_) entries;
+  try
+  {
+    entries = tesseract_common::Serialization::fromArchiveFileBinary<decltype(entries_)>(file_path);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("OMPLRoadmapStore, failed to load '%s': %s", file_path.c_str(), e.what());
+    return false;
+  }
+
+  std::scoped_lock lock(mutex_);
+  entries_ = std::move(entries);
+  return true;
+}
+
+template <class Archive>
+void OMPLRoadmapStore::Entry::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_NVP(revision);
+  ar& BOOST_SERIALIZATION_NVP(joint_values);
+
+  // The roadmap is immutable once stored so it is copied through the archive instead of tracked as a pointer
+  OMPLRoadmap data = (roadmap != nullptr) ? *roadmap : OMPLRoadmap();
+  ar& boost::serialization::make_nvp("roadmap", data);
+  if (Archive::is_loading::value)
+    roadmap = std::make_shared<const OMPLRoadmap>(std::move(data));
+}
+}  // namespace tesseract_planning
+
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::OMPLRoadmap)
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::OMPLRoadmapStore::Entry)
@@ -35,6 +35,8 @@ OMPLPlanProfile::OMPLPlanProfile() : Profile(OMPLPlanProfile::getStaticKey()) {}
 
 std::size_t OMPLPlanProfile::getStaticKey() { return std::type_index(typeid(OMPLPlanProfile)).hash_code(); }
 
+std::string OMPLPlanProfile::getValidationKey() const { return ""; }
+
 template <class Archive>
 void OMPLPlanProfile::serialize(Archive& ar, const unsigned int /*version*/)
 {
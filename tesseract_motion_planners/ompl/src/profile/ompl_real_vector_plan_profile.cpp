@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/goals/GoalStates.h>
 #include <boost/algorithm/string.hpp>
 #include <console_bridge/console.h>
+#include <typeinfo>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/vector.hpp>
@@ -56,6 +57,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/serialization.h>
+#include <tesseract_common/serialization.h>
 #include <tesseract_environment/environment.h>
 
 namespace tesseract_planning
@@ -66,6 +68,13 @@ OMPLRealVectorPlanProfile::OMPLRealVectorPlanProfile()
                              std::make_shared<const RRTConnectConfigurator>() };
 }
 
+std::string OMPLRealVectorPlanProfile::getValidationKey() const
+{
+  return std::string(typeid(*this).name()) + ";" +
+         tesseract_common::Serialization::toArchiveStringXML<tesseract_collision::CollisionCheckConfig>(
+             collision_check_config, "collision_check_config");
+}
+
 std::unique_ptr<OMPLSolverConfig> OMPLRealVectorPlanProfile::createSolverConfig() const
 {
   return std::make_unique<OMPLSolverConfig>(solver_config);
@@ -477,7 +486,8 @@ std::unique_ptr<ompl::base::MotionValidator> OMPLRealVectorPlanProfile::createMo
     }
 
     // Collision checking is preformed using the state validator which this calls.
-    return std::make_unique<DiscreteMotionValidator>(simple_setup.getSpaceInformation());
+    return std::make_unique<DiscreteMotionValidator>(
+        simple_setup.getSpaceInformation(), motion_validator_bisect, motion_validator_cache_size);
   }
 
   return nullptr;
@@ -498,6 +508,8 @@ void OMPLRealVectorPlanProfile::serialize(Archive& ar, const unsigned int /*vers
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(OMPLPlanProfile);
   ar& BOOST_SERIALIZATION_NVP(solver_config);
   ar& BOOST_SERIALIZATION_NVP(collision_check_config);
+  ar& BOOST_SERIALIZATION_NVP(motion_validator_bisect);
+  ar& BOOST_SERIALIZATION_NVP(motion_validator_cache_size);
 }
 
 }  // namespace tesseract_planning
@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/State.h>
 #include <ompl/geometric/PathGeometric.h>
 #include <memory>
+#include <queue>
 
 #ifndef OMPL_LESS_1_4_0
 #include <ompl/base/spaces/constraint/ProjectedStateSpace.h>
@@ -107,6 +108,33 @@ void processLongestValidSegment(const ompl::base::StateSpacePtr& state_space_ptr
   state_space_ptr->setLongestValidSegmentFraction(longest_valid_segment_fraction);
 }
 
+std::vector<unsigned> getBisectionOrder(unsigned first, unsigned last)
+{
+  std::vector<unsigned> order;
+  if (last < first)
+    return order;
+
+  order.reserve(last - first + 1);
+  std::queue<std::pair<unsigned, unsigned>> intervals;
+  intervals.emplace(first, last);
+  while (!intervals.empty())
+  {
+    const auto [lower, upper] = intervals.front();
+    intervals.pop();
+
+    const unsigned mid = lower + ((upper - lower) / 2);
+    order.push_back(mid);
+
+    if (mid > lower)
+      intervals.emplace(lower, mid - 1);
+
+    if (mid < upper)
+      intervals.emplace(mid + 1, upper);
+  }
+
+  return order;
+}
+
 bool checkStateInCollision(tesseract_collision::ContactResultMap& contact_map,
                            tesseract_collision::DiscreteContactManager& contact_checker,
                            const tesseract_kinematics::JointGroup& manip,
@@ -41,7 +41,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/prm/SPARS.h>
 
 #include <ompl/util/RandomNumbers.h>
+#include <ompl/base/PlannerData.h>
+#include <ompl/base/SpaceInformation.h>
+#include <ompl/base/spaces/RealVectorStateSpace.h>
 
+#include <algorithm>
 #include <functional>
 #include <cmath>
 #include <gtest/gtest.h>
@@ -49,6 +53,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
+#include <tesseract_common/utils.h>
 
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
@@ -62,6 +67,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_store.h>
+#include <tesseract_motion_planners/ompl/ompl_solver_config.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_real_vector_plan_profile.h>
 
 #include <tesseract_motion_planners/core/types.h>
@@ -569,6 +578,279 @@ TYPED_TEST(OMPLTestFixture, OMPLFreespaceCartesianStartPlannerUnit)  // NOLINT
 //  kin->getJointNames());
 //}
 
+TEST(OMPLUtilsUnit, BisectionOrder)  // NOLINT
+{
+  EXPECT_TRUE(getBisectionOrder(2, 1).empty());
+  EXPECT_EQ(getBisectionOrder(1, 1), std::vector<unsigned>({ 1 }));
+  EXPECT_EQ(getBisectionOrder(1, 2), std::vector<unsigned>({ 1, 2 }));
+  EXPECT_EQ(getBisectionOrder(1, 7), std::vector<unsigned>({ 4, 2, 6, 1, 3, 5, 7 }));
+
+  // Every index is visited exactly once
+  std::vector<unsigned> order = getBisectionOrder(1, 100);
+  std::sort(order.begin(), order.end());
+  ASSERT_EQ(order.size(), 100);
+  for (unsigned i = 0; i < 100; ++i)
+    EXPECT_EQ(order[i], i + 1);
+}
+
+TEST(OMPLDiscreteMotionValidatorUnit, BisectAndCache)  // NOLINT
+{
+  auto state_space = std::make_shared<ompl::base::RealVectorStateSpace>(1);
+  state_space->setBounds(0, 1);
+  state_space->setLongestValidSegmentFraction(0.01);
+
+  // The motion is in collision in a small region close to the middle
+  auto si = std::make_shared<ompl::base::SpaceInformation>(state_space);
+  int n_checks{ 0 };
+  si->setStateValidityChecker([&n_checks](const ompl::base::State* state) {
+    ++n_checks;
+    const double value = state->as<ompl::base::RealVectorStateSpace::StateType>()->values[0];
+    return (value < 0.48 || value > 0.52);
+  });
+  si->setup();
+
+  ompl::base::ScopedState<ompl::base::RealVectorStateSpace> start(state_space);
+  ompl::base::ScopedState<ompl::base::RealVectorStateSpace> end(state_space);
+  start[0] = 0;
+  end[0] = 1;
+
+  DiscreteMotionValidator sequential(si);
+  EXPECT_FALSE(sequential.checkMotion(start.get(), end.get()));
+  const int sequential_checks = n_checks;
+  EXPECT_GT(sequential_checks, 40);
+
+  n_checks = 0;
+  DiscreteMotionValidator bisect(si, true);
+  EXPECT_FALSE(bisect.checkMotion(start.get(), end.get()));
+  EXPECT_LT(n_checks, sequential_checks);
+  EXPECT_LT(n_checks, 10);
+
+  // The last valid state is still the one before the first invalid state
+  std::pair<ompl::base::State*, double> last_valid = { nullptr, 0.0 };
+  EXPECT_FALSE(bisect.checkMotion(start.get(), end.get(), last_valid));
+  EXPECT_NEAR(last_valid.second, 0.48, 0.011);
+
+  // A cached motion or state is not checked again
+  DiscreteMotionValidator cached(si, true, 100);
+  n_checks = 0;
+  EXPECT_FALSE(cached.checkMotion(start.get(), end.get()));
+  EXPECT_GT(n_checks, 0);
+  n_checks = 0;
+  EXPECT_FALSE(cached.checkMotion(start.get(), end.get()));
+  EXPECT_EQ(n_checks, 0);
+
+  end[0] = 0.25;
+  EXPECT_TRUE(cached.checkMotion(start.get(), end.get()));
+  n_checks = 0;
+  EXPECT_TRUE(cached.checkMotion(start.get(), end.get()));
+  EXPECT_TRUE(cached.checkMotion(start.get(), end.get(), last_valid));
+  EXPECT_EQ(n_checks, 0);
+}
+
+TEST(OMPLRoadmapStoreUnit, RevalidateRoadmap)  // NOLINT
+{
+  auto state_space = std::make_shared<ompl::base::RealVectorStateSpace>(1);
+  state_space->setBounds(0, 1);
+  state_space->setLongestValidSegmentFraction(0.01);
+
+  OMPLRoadmap roadmap;
+  roadmap.vertices = { { 0.1 }, { 0.3 }, { 0.5 }, { 0.7 }, { 0.9 } };
+  roadmap.edges = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 } };
+
+  // Every state and motion is valid with the settings the roadmap was built with
+  auto si = std::make_shared<ompl::base::SpaceInformation>(state_space);
+  si->setStateValidityChecker([](const ompl::base::State*) { return true; });
+  si->setup();
+
+  ompl::base::PlannerData data(si);
+  roadmap.toPlannerData(data);
+  EXPECT_EQ(data.numVertices(), 5);
+  EXPECT_EQ(data.numEdges(), 8);
+
+  // Stricter settings invalidate the state at 0.5 and the motion between 0.1 and 0.3
+  auto strict_si = std::make_shared<ompl::base::SpaceInformation>(state_space);
+  strict_si->setStateValidityChecker([](const ompl::base::State* state) {
+    const double value = state->as<ompl::base::RealVectorStateSpace::StateType>()->values[0];
+    return (value < 0.18 || value > 0.22) && (value < 0.45 || value > 0.55);
+  });
+  strict_si->setup();
+
+  ompl::base::PlannerData strict_data(strict_si);
+  roadmap.toPlannerData(strict_data);
+  ASSERT_EQ(strict_data.numVertices(), 4);
+  EXPECT_EQ(strict_data.numEdges(), 2);
+
+  // The edges reference the remaining vertices
+  std::vector<unsigned> neighbors;
+  for (unsigned i = 0; i < strict_data.numVertices(); ++i)
+  {
+    const auto* state = strict_data.getVertex(i).getState()->as<ompl::base::RealVectorStateSpace::StateType>();
+    strict_data.getEdges(i, neighbors);
+    if (std::abs(state->values[0] - 0.7) < 1e-6 || std::abs(state->values[0] - 0.9) < 1e-6)
+      EXPECT_EQ(neighbors.size(), 1);
+    else
+      EXPECT_TRUE(neighbors.empty());
+  }
+
+  // A roadmap which is known to be valid is added without checking it
+  ompl::base::PlannerData unvalidated_data(strict_si);
+  roadmap.toPlannerData(unvalidated_data, false);
+  EXPECT_EQ(unvalidated_data.numVertices(), 5);
+  EXPECT_EQ(unvalidated_data.numEdges(), 8);
+
+  // Truncating a roadmap removes the edges to the removed vertices
+  OMPLRoadmap truncated = roadmap.truncated(3);
+  EXPECT_EQ(truncated.vertices.size(), 3);
+  EXPECT_EQ(truncated.edges.size(), 2);
+  EXPECT_EQ(roadmap.truncated(10).vertices.size(), 5);
+
+  // An edge to a vertex which does not exist is rejected
+  roadmap.edges.emplace_back(4, 5);
+  ompl::base::PlannerData invalid_data(si);
+  EXPECT_ANY_THROW(roadmap.toPlannerData(invalid_data));  // NOLINT
+}
+
+TEST(OMPLRoadmapStoreUnit, PersistAcrossRequests)  // NOLINT
+{
+  auto locator = std::make_shared<tesseract_common::GeneralResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(
+      locator->locateResource("package://tesseract_support/urdf/lbr_iiwa_14_r820.urdf")->getFilePath());
+  tesseract_common::fs::path srdf_path(
+      locator->locateResource("package://tesseract_support/urdf/lbr_iiwa_14_r820.srdf")->getFilePath());
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+  addBox(*env);
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+  auto joint_group = env->getJointGroup(manip.manipulator);
+
+  JointWaypointPoly wp1{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()))) };
+  JointWaypointPoly wp2{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()))) };
+
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  auto roadmap_store = std::make_shared<OMPLRoadmapStore>();
+  auto plan_profile = std::make_shared<OMPLRealVectorPlanProfile>();
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.1;
+  plan_profile->solver_config.planning_time = 10;
+  plan_profile->solver_config.optimize = false;
+  plan_profile->solver_config.planners = { std::make_shared<PRMConfigurator>(),
+                                           std::make_shared<LazyPRMstarConfigurator>() };
+  plan_profile->solver_config.roadmap_store = roadmap_store;
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.profiles = profiles;
+
+  // The first request builds the roadmap
+  OMPLMotionPlanner ompl_planner(OMPL_DEFAULT_NAMESPACE);
+  PlannerResponse planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(roadmap_store->size(), 1);
+  OMPLRoadmap::ConstPtr roadmap = roadmap_store->get(*env, *joint_group);
+  ASSERT_TRUE(roadmap != nullptr);
+  EXPECT_FALSE(roadmap->vertices.empty());
+  EXPECT_FALSE(roadmap->edges.empty());
+  for (const auto& vertex : roadmap->vertices)
+    EXPECT_EQ(vertex.size(), joint_group->getJointNames().size());
+
+  // The roadmap is stored with the validation key of the profile
+  bool validated{ false };
+  EXPECT_FALSE(plan_profile->getValidationKey().empty());
+  EXPECT_TRUE(roadmap_store->get(*env, *joint_group, plan_profile->getValidationKey(), validated) != nullptr);
+  EXPECT_TRUE(validated);
+  EXPECT_TRUE(roadmap_store->get(*env, *joint_group, "", validated) != nullptr);
+  EXPECT_FALSE(validated);
+
+  // The second request starts from it
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  OMPLRoadmap::ConstPtr extended = roadmap_store->get(*env, *joint_group);
+  ASSERT_TRUE(extended != nullptr);
+  EXPECT_GE(extended->vertices.size(), roadmap->vertices.size());
+
+  // The roadmap is reused as is with the profile it was built with
+  MoveInstruction start_instruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction end_instruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  auto simple_setup = plan_profile->createSimpleSetup(start_instruction, end_instruction, manip, env);
+  simple_setup->setup();
+  ompl::base::PlannerData seed(simple_setup->getSpaceInformation());
+  extended->toPlannerData(seed);
+  EXPECT_EQ(seed.numVertices(), extended->vertices.size());
+  EXPECT_TRUE(roadmap_store->get(*env, *joint_group, plan_profile->getValidationKey(), validated) != nullptr);
+  EXPECT_TRUE(validated);
+
+  // A profile with a larger collision margin does not reuse the states which are too close
+  OMPLRealVectorPlanProfile strict_profile;
+  strict_profile.collision_check_config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  strict_profile.collision_check_config.longest_valid_segment_length = 0.1;
+  strict_profile.collision_check_config.contact_manager_config.margin_data_override_type =
+      tesseract_collision::CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN;
+  strict_profile.collision_check_config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.5);
+  auto strict_setup = strict_profile.createSimpleSetup(start_instruction, end_instruction, manip, env);
+  strict_setup->setup();
+  ompl::base::PlannerData strict_seed(strict_setup->getSpaceInformation());
+  extended->toPlannerData(strict_seed);
+  EXPECT_LT(strict_seed.numVertices(), extended->vertices.size());
+  for (unsigned i = 0; i < strict_seed.numVertices(); ++i)
+    EXPECT_TRUE(strict_setup->getSpaceInformation()->isValid(strict_seed.getVertex(i).getState()));
+
+  // and it has another validation key so the roadmap is validated again
+  EXPECT_NE(strict_profile.getValidationKey(), plan_profile->getValidationKey());
+  EXPECT_TRUE(roadmap_store->get(*env, *joint_group, strict_profile.getValidationKey(), validated) != nullptr);
+  EXPECT_FALSE(validated);
+
+  // The store persists to disk
+  const std::string file_path = tesseract_common::getTempPath() + "OMPLRoadmapStoreUnit.bin";
+  EXPECT_TRUE(roadmap_store->save(file_path));
+  OMPLRoadmapStore loaded_store;
+  EXPECT_TRUE(loaded_store.load(file_path));
+  OMPLRoadmap::ConstPtr loaded = loaded_store.get(*env, *joint_group);
+  ASSERT_TRUE(loaded != nullptr);
+  EXPECT_EQ(loaded->vertices, extended->vertices);
+  EXPECT_EQ(loaded->edges, extended->edges);
+  EXPECT_TRUE(loaded_store.get(*env, *joint_group, plan_profile->getValidationKey(), validated) != nullptr);
+  EXPECT_FALSE(validated);
+  EXPECT_FALSE(loaded_store.load(tesseract_common::getTempPath() + "OMPLRoadmapStoreUnitMissing.bin"));
+
+  // The number of vertices of a stored roadmap is capped
+  OMPLRoadmapStore capped_store(2);
+  EXPECT_EQ(capped_store.getMaxVertices(), 2);
+  capped_store.put(*env, *joint_group, extended, plan_profile->getValidationKey());
+  OMPLRoadmap::ConstPtr capped = capped_store.get(*env, *joint_group);
+  ASSERT_TRUE(capped != nullptr);
+  EXPECT_EQ(capped->vertices.size(), 2);
+  for (const auto& edge : capped->edges)
+    EXPECT_TRUE(edge.first < 2 && edge.second < 2);
+
+  // Changing the environment invalidates the roadmap
+  Link link("roadmap_store_link");
+  Joint joint("roadmap_store_joint");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = link.getName();
+  joint.type = JointType::FIXED;
+  env->applyCommand(std::make_shared<AddLinkCommand>(link, joint));
+  EXPECT_TRUE(roadmap_store->get(*env, *joint_group) == nullptr);
+  EXPECT_EQ(roadmap_store->size(), 0);
+
+  loaded_store.invalidate(*env);
+  EXPECT_EQ(loaded_store.size(), 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
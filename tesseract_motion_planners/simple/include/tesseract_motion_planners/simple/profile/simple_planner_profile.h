@@ -97,6 +97,15 @@ public:
    */
   static std::size_t getStaticKey();
 
+  /**
+   * @brief The number of threads used to seed the child composites of the program, for example the rasters
+   * @details If greater than one, the state at the start of each child composite is resolved first and then the
+   * children are seeded concurrently. A child whose start state depends on the seed of the previous child is seeded
+   * with it, and any child started from a state which does not match the serial result is seeded again, so the results
+   * are identical to seeding on a single thread.
+   */
+  int num_threads{ 1 };
+
   // This contains functions for composite processing. Get start for example
 protected:
   friend class boost::serialization::access;
@@ -107,5 +116,6 @@ protected:
 }  // namespace tesseract_planning
 
 BOOST_CLASS_EXPORT_KEY(tesseract_planning::SimplePlannerPlanProfile)
+BOOST_CLASS_EXPORT_KEY(tesseract_planning::SimplePlannerCompositeProfile)
 
 #endif  // TESSERACT_MOTION_PLANNERS_SIMPLE_PROFILE_H
@@ -72,6 +72,20 @@ protected:
                                                    const CompositeInstruction& instructions,
                                                    const tesseract_scene_graph::SceneState& start_state,
                                                    const PlannerRequest& request) const;
+
+  /**
+   * @brief Seed the child composites of the program concurrently
+   * @details The results are identical to processCompositeInstruction, see SimplePlannerCompositeProfile::num_threads
+   * @param instructions The program, which must only contain child composites and non move instructions
+   * @param start_state The start state
+   * @param request The planning request
+   * @param num_threads The number of threads
+   * @return The seed
+   */
+  CompositeInstruction processCompositeInstructionParallel(const CompositeInstruction& instructions,
+                                                           const tesseract_scene_graph::SceneState& start_state,
+                                                           const PlannerRequest& request,
+                                                           int num_threads) const;
 };
 
 }  // namespace tesseract_planning
@@ -1331,11 +1331,13 @@ CompositeInstruction generateInterpolatedProgram(const CompositeInstruction& ins
                                                                    min_steps);
 
   // Create profile dictionary
-  auto profiles = std::make_shared<ProfileDictionary>();
-  profiles->addProfile(planner.getName(), instructions.getProfile(), profile);
+  std::vector<std::string> profile_names{ instructions.getProfile() };
   auto flat = instructions.flatten(&moveFilter);
   for (const auto& i : flat)
-    profiles->addProfile(planner.getName(), i.get().as<MoveInstructionPoly>().getProfile(), profile);
+    profile_names.push_back(i.get().as<MoveInstructionPoly>().getProfile());
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile(planner.getName(), profile_names, profile);
 
   // Assign profile dictionary
   request.profiles = profiles;
@@ -1343,7 +1345,7 @@ CompositeInstruction generateInterpolatedProgram(const CompositeInstruction& ins
   // Solve
   PlannerResponse response = planner.solve(request);
 
-  return response.results;
+  return std::move(response.results);
 }
 
 }  // namespace tesseract_planning
@@ -56,6 +56,7 @@ template <class Archive>
 void SimplePlannerCompositeProfile::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(Profile);
+  ar& BOOST_SERIALIZATION_NVP(num_threads);
 }
 
 }  // namespace tesseract_planning
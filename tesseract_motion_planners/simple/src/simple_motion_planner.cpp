@@ -28,6 +28,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
@@ -57,6 +61,44 @@ constexpr auto FAILED_TO_FIND_VALID_SOLUTION{ "Failed to find valid solution: "
 
 namespace tesseract_planning
 {
+namespace
+{
+/** @brief The previous instruction and seed threaded from one child composite to the next */
+struct SeedBoundary
+{
+  MoveInstructionPoly instruction;
+  MoveInstructionPoly seed;
+};
+
+bool isEqual(const MoveInstructionPoly& lhs, const MoveInstructionPoly& rhs)
+{
+  if (lhs.isNull() || rhs.isNull())
+    return (lhs.isNull() && rhs.isNull());
+
+  return (lhs == rhs);
+}
+
+bool isEqual(const SeedBoundary& lhs, const SeedBoundary& rhs)
+{
+  return (isEqual(lhs.instruction, rhs.instruction) && isEqual(lhs.seed, rhs.seed));
+}
+
+/** @brief The children can only be seeded concurrently if the program has no move instructions at the top level */
+bool canProcessInParallel(const CompositeInstruction& instructions)
+{
+  long composite_count{ 0 };
+  for (const auto& instruction : instructions)
+  {
+    if (instruction.isMoveInstruction())
+      return false;
+
+    if (instruction.isCompositeInstruction())
+      ++composite_count;
+  }
+  return (composite_count > 1);
+}
+}  // namespace
+
 SimpleMotionPlanner::SimpleMotionPlanner(std::string name) : MotionPlanner(std::move(name)) {}
 
 bool SimpleMotionPlanner::terminate()
@@ -92,6 +134,13 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   // Start State
   tesseract_scene_graph::SceneState start_state = request.env->getState();
 
+  // Get the composite profile
+  auto composite_profile =
+      getProfile<SimplePlannerCompositeProfile>(name_,
+                                                request.instructions.getProfile(name_),
+                                                *request.profiles,
+                                                std::make_shared<SimplePlannerCompositeProfile>());
+
   // Create seed
   CompositeInstruction seed;
 
@@ -101,10 +150,18 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   // Process the instructions into the seed
   try
   {
-    MoveInstructionPoly start_instruction_copy = null_instruction;
-    MoveInstructionPoly start_instruction_seed_copy = null_instruction;
-    seed = processCompositeInstruction(
-        start_instruction_copy, start_instruction_seed_copy, request.instructions, start_state, request);
+    if (composite_profile->num_threads > 1 && canProcessInParallel(request.instructions))
+    {
+      seed = processCompositeInstructionParallel(
+          request.instructions, start_state, request, composite_profile->num_threads);
+    }
+    else
+    {
+      MoveInstructionPoly start_instruction_copy = null_instruction;
+      MoveInstructionPoly start_instruction_seed_copy = null_instruction;
+      seed = processCompositeInstruction(
+          start_instruction_copy, start_instruction_seed_copy, request.instructions, start_state, request);
+    }
   }
   catch (std::exception& e)
   {
@@ -115,7 +172,7 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   }
 
   // Fill out the response
-  response.results = seed;
+  response.results = std::move(seed);
 
   // Enforce limits
   const Eigen::MatrixX2d joint_limits = manip->getLimits().joint_limits;
@@ -263,4 +320,125 @@ SimpleMotionPlanner::processCompositeInstruction(MoveInstructionPoly& prev_instr
   return seed;
 }
 
+CompositeInstruction
+SimpleMotionPlanner::processCompositeInstructionParallel(const CompositeInstruction& instructions,
+                                                         const tesseract_scene_graph::SceneState& start_state,
+                                                         const PlannerRequest& request,
+                                                         int num_threads) const
+{
+  std::vector<std::size_t> children;
+  for (std::size_t i = 0; i < instructions.size(); ++i)
+  {
+    if (instructions[i].isCompositeInstruction())
+      children.push_back(i);
+  }
+
+  // Resolve the boundary at the start of each child. The seed of a move instruction with a joint or state waypoint, or
+  // a Cartesian waypoint which is already seeded, is the instruction itself, so the boundary after a child ending in
+  // one is known without seeding the child. Children which start from an unknown boundary are seeded after the
+  // previous child by the same job.
+  std::vector<std::size_t> group_starts;
+  std::vector<SeedBoundary> group_boundaries;
+  SeedBoundary boundary;
+  bool known{ true };
+  for (std::size_t c = 0; c < children.size(); ++c)
+  {
+    if (known)
+    {
+      group_starts.push_back(c);
+      group_boundaries.push_back(boundary);
+    }
+
+    const auto* last = instructions[children[c]].as<CompositeInstruction>().getLastMoveInstruction();
+    if (last == nullptr)
+      continue;
+
+    const auto& waypoint = last->getWaypoint();
+    known = (waypoint.isJointWaypoint() || waypoint.isStateWaypoint() ||
+             (waypoint.isCartesianWaypoint() && waypoint.as<CartesianWaypointPoly>().hasSeed()));
+    if (known)
+      boundary = SeedBoundary{ *last, *last };
+  }
+
+  struct GroupResult
+  {
+    std::vector<CompositeInstruction> seeds;
+    SeedBoundary boundary;
+    std::exception_ptr error;
+  };
+
+  const std::size_t group_count = group_starts.size();
+  std::vector<GroupResult> results(group_count);
+  auto process_group = [&](std::size_t g, SeedBoundary group_boundary) {
+    const std::size_t end = (g + 1 < group_count) ? group_starts[g + 1] : children.size();
+    GroupResult& result = results[g];
+    result.seeds.clear();
+    result.error = nullptr;
+    try
+    {
+      for (std::size_t c = group_starts[g]; c < end; ++c)
+      {
+        result.seeds.push_back(processCompositeInstruction(group_boundary.instruction,
+                                                           group_boundary.seed,
+                                                           instructions[children[c]].as<CompositeInstruction>(),
+                                                           start_state,
+                                                           request));
+      }
+      result.boundary = std::move(group_boundary);
+    }
+    catch (...)
+    {
+      result.error = std::current_exception();
+    }
+  };
+
+  std::atomic<std::size_t> next_group{ 0 };
+  auto worker = [&]() {
+    for (std::size_t g = next_group++; g < group_count; g = next_group++)
+      process_group(g, group_boundaries[g]);
+  };
+
+  std::vector<std::thread> threads;
+  const std::size_t thread_count = std::min(static_cast<std::size_t>(num_threads), group_count);
+  for (std::size_t i = 1; i < thread_count; ++i)
+    threads.emplace_back(worker);
+
+  worker();
+  for (auto& thread : threads)
+    thread.join();
+
+  // In order, check that each group started from the boundary the previous group ended with and seed it again if not,
+  // which makes the results and errors identical to seeding on a single thread
+  for (std::size_t g = 0; g < group_count; ++g)
+  {
+    if (g > 0 && !isEqual(results[g - 1].boundary, group_boundaries[g]))
+      process_group(g, results[g - 1].boundary);
+
+    if (results[g].error != nullptr)
+      std::rethrow_exception(results[g].error);
+  }
+
+  CompositeInstruction seed(instructions);
+  seed.clear();
+
+  std::size_t g{ 0 };
+  std::size_t s{ 0 };
+  for (const auto& instruction : instructions)
+  {
+    if (!instruction.isCompositeInstruction())
+    {
+      seed.push_back(instruction);
+      continue;
+    }
+
+    if (s == results[g].seeds.size())
+    {
+      ++g;
+      s = 0;
+    }
+    seed.push_back(std::move(results[g].seeds[s++]));
+  }
+  return seed;
+}
+
 }  // namespace tesseract_planning
@@ -26,6 +26,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
@@ -35,6 +39,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_lvs_plan_profile.h>
+#include <tesseract_motion_planners/simple/profile/simple_planner_lvs_no_ik_plan_profile.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/profile_dictionary.h>
 #include <tesseract_command_language/joint_waypoint.h>
 #include <tesseract_command_language/cartesian_waypoint.h>
 #include <tesseract_command_language/move_instruction.h>
@@ -547,6 +555,159 @@ TEST_F(TesseractPlanningSimplePlannerLVSInterpolationUnit, InterpolateStateWaypo
   EXPECT_EQ(crl.size(), rot_steps);
 }
 
+/** @brief A profile which moves the seed of the last instruction, so the raster boundaries differ from the input */
+class OffsetSeedPlanProfile : public SimplePlannerLVSNoIKPlanProfile
+{
+public:
+  std::vector<MoveInstructionPoly> generate(const MoveInstructionPoly& prev_instruction,
+                                            const MoveInstructionPoly& prev_seed,
+                                            const MoveInstructionPoly& base_instruction,
+                                            const InstructionPoly& next_instruction,
+                                            const std::shared_ptr<const Environment>& env,
+                                            const tesseract_common::ManipulatorInfo& global_manip_info) const override
+  {
+    auto seed = SimplePlannerLVSNoIKPlanProfile::generate(
+        prev_instruction, prev_seed, base_instruction, next_instruction, env, global_manip_info);
+    if (seed.back().getWaypoint().isJointWaypoint())
+    {
+      auto& jwp = seed.back().getWaypoint().as<JointWaypointPoly>();
+      jwp.setPosition(jwp.getPosition() + Eigen::VectorXd::Constant(jwp.getPosition().size(), 0.01));
+    }
+    return seed;
+  }
+};
+
+/** @brief A profile which records the threads seeding the program and is slow enough for the rasters to overlap */
+class ThreadRecordingPlanProfile : public SimplePlannerLVSNoIKPlanProfile
+{
+public:
+  using SimplePlannerLVSNoIKPlanProfile::SimplePlannerLVSNoIKPlanProfile;
+
+  std::vector<MoveInstructionPoly> generate(const MoveInstructionPoly& prev_instruction,
+                                            const MoveInstructionPoly& prev_seed,
+                                            const MoveInstructionPoly& base_instruction,
+                                            const InstructionPoly& next_instruction,
+                                            const std::shared_ptr<const Environment>& env,
+                                            const tesseract_common::ManipulatorInfo& global_manip_info) const override
+  {
+    {
+      std::scoped_lock lock(mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return SimplePlannerLVSNoIKPlanProfile::generate(
+        prev_instruction, prev_seed, base_instruction, next_instruction, env, global_manip_info);
+  }
+
+  mutable std::mutex mutex;
+  mutable std::set<std::thread::id> thread_ids;
+};
+
+TEST_F(TesseractPlanningSimplePlannerLVSInterpolationUnit, ParallelSeedMatchesSerial)  // NOLINT
+{
+  CompositeInstruction program("TEST_PROFILE", manip_info_);
+  for (int r = 0; r < 10; ++r)
+  {
+    CompositeInstruction raster("TEST_PROFILE");
+    for (int i = 0; i < 3; ++i)
+    {
+      const double sign = (i % 2 == 0) ? 1 : -1;
+      const Eigen::VectorXd position = Eigen::VectorXd::Constant(7, sign * 0.05 * ((r * 3) + i));
+      if (r % 3 == 2 && i == 2)
+      {
+        StateWaypointPoly wp{ StateWaypoint(joint_names_, position) };
+        raster.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "TEST_PROFILE", manip_info_));
+      }
+      else
+      {
+        JointWaypointPoly wp{ JointWaypoint(joint_names_, position) };
+        raster.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "TEST_PROFILE", manip_info_));
+      }
+    }
+    program.push_back(raster);
+  }
+
+  auto solve = [this, &program](int num_threads, const SimplePlannerPlanProfile::ConstPtr& plan_profile) {
+    auto composite_profile = std::make_shared<SimplePlannerCompositeProfile>();
+    composite_profile->num_threads = num_threads;
+
+    auto profiles = std::make_shared<ProfileDictionary>();
+    profiles->addProfile("SIMPLE", "TEST_PROFILE", composite_profile);
+    profiles->addProfile("SIMPLE", "TEST_PROFILE", plan_profile);
+
+    PlannerRequest request;
+    request.env = env_;
+    request.profiles = profiles;
+    request.instructions = program;
+
+    SimpleMotionPlanner planner("SIMPLE");
+    PlannerResponse response = planner.solve(request);
+    EXPECT_TRUE(response.successful);
+    return response.results;
+  };
+
+  // The boundaries are known from the waypoints
+  auto lvs_profile = std::make_shared<SimplePlannerLVSNoIKPlanProfile>(0.1, 0.1, 0.1, 3);
+  CompositeInstruction serial = solve(1, lvs_profile);
+  EXPECT_EQ(serial.size(), program.size());
+  EXPECT_EQ(solve(4, lvs_profile), serial);
+  EXPECT_EQ(solve(64, lvs_profile), serial);
+
+  // The boundaries differ from the waypoints so every raster is seeded again after the previous one
+  auto offset_profile = std::make_shared<OffsetSeedPlanProfile>();
+  CompositeInstruction offset_serial = solve(1, offset_profile);
+  EXPECT_NE(offset_serial, serial);
+  EXPECT_EQ(solve(4, offset_profile), offset_serial);
+}
+
+TEST_F(TesseractPlanningSimplePlannerLVSInterpolationUnit, ParallelSeedCartesianMatchesSerial)  // NOLINT
+{
+  tesseract_kinematics::JointGroup::ConstPtr manip = env_->getJointGroup(manip_info_.manipulator);
+  CompositeInstruction program("TEST_PROFILE", manip_info_);
+  for (int r = 0; r < 10; ++r)
+  {
+    CompositeInstruction raster("TEST_PROFILE");
+    for (int i = 0; i < 3; ++i)
+    {
+      const double sign = (i % 2 == 0) ? 1 : -1;
+      const Eigen::VectorXd position = Eigen::VectorXd::Constant(7, sign * 0.05 * ((r * 3) + i));
+      CartesianWaypointPoly wp{ CartesianWaypoint(manip->calcFwdKin(position).at(manip_info_.tcp_frame)) };
+      wp.setSeed(tesseract_common::JointState(joint_names_, position));
+      raster.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "TEST_PROFILE", manip_info_));
+    }
+    program.push_back(raster);
+  }
+
+  auto solve = [this, &program](int num_threads, const SimplePlannerPlanProfile::ConstPtr& plan_profile) {
+    auto composite_profile = std::make_shared<SimplePlannerCompositeProfile>();
+    composite_profile->num_threads = num_threads;
+
+    auto profiles = std::make_shared<ProfileDictionary>();
+    profiles->addProfile("SIMPLE", "TEST_PROFILE", composite_profile);
+    profiles->addProfile("SIMPLE", "TEST_PROFILE", plan_profile);
+
+    PlannerRequest request;
+    request.env = env_;
+    request.profiles = profiles;
+    request.instructions = program;
+
+    SimpleMotionPlanner planner("SIMPLE");
+    PlannerResponse response = planner.solve(request);
+    EXPECT_TRUE(response.successful);
+    return response.results;
+  };
+
+  auto lvs_profile = std::make_shared<SimplePlannerLVSNoIKPlanProfile>(0.1, 0.1, 0.1, 3);
+  CompositeInstruction serial = solve(1, lvs_profile);
+  EXPECT_EQ(serial.size(), program.size());
+  EXPECT_EQ(solve(4, lvs_profile), serial);
+
+  // The seeded Cartesian waypoints ending each raster are known boundaries, so the rasters are seeded concurrently
+  auto recording_profile = std::make_shared<ThreadRecordingPlanProfile>(0.1, 0.1, 0.1, 3);
+  EXPECT_EQ(solve(4, recording_profile), serial);
+  EXPECT_GT(recording_profile->thread_ids.size(), 1);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
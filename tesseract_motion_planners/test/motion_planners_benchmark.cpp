@@ -0,0 +1,504 @@
+/**
+ * @file motion_planners_benchmark.cpp
+ * @brief Benchmark every motion planner on the example scenes
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_scene_graph/link.h>
+#include <tesseract_scene_graph/joint.h>
+#include <tesseract_state_solver/state_solver.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands/add_link_command.h>
+#include <tesseract_geometry/impl/box.h>
+#include <tesseract_geometry/impl/convex_mesh.h>
+#include <tesseract_geometry/impl/sphere.h>
+#include <tesseract_geometry/mesh_parser.h>
+
+#include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/utils.h>
+
+#include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/simple/simple_motion_planner.h>
+#include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/profile/ompl_real_vector_plan_profile.h>
+#include <tesseract_motion_planners/descartes/descartes_motion_planner.h>
+#include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_motion_planner.h>
+#include "benchmark_utils.hpp"
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+using namespace tesseract_scene_graph;
+using tesseract_common::ManipulatorInfo;
+
+static const std::string SIMPLE_DEFAULT_NAMESPACE = "SimpleMotionPlannerTask";
+static const std::string OMPL_DEFAULT_NAMESPACE = "OMPLMotionPlannerTask";
+static const std::string DESCARTES_DEFAULT_NAMESPACE = "DescartesMotionPlannerTask";
+static const std::string TRAJOPT_DEFAULT_NAMESPACE = "TrajOptMotionPlannerTask";
+static const std::string TRAJOPT_IFOPT_DEFAULT_NAMESPACE = "TrajOptIfoptMotionPlannerTask";
+
+/**
+ * @brief The environment and program of one of the tesseract_examples
+ * @details The examples can not be linked here since they depend on this package, so their setups are repeated. The
+ * planners use their default profiles, except OMPL which is limited to a single RRTConnect planner.
+ */
+struct Scene
+{
+  std::string name;
+  std::shared_ptr<Environment> env;
+  std::shared_ptr<ProfileDictionary> profiles;
+  CompositeInstruction program;
+
+  /** @brief The program only contains freespace motions, so it is planned with OMPL */
+  bool freespace{ false };
+
+  /** @brief The program contains Cartesian waypoints, so it is planned with Descartes */
+  bool cartesian{ false };
+};
+
+/** @brief A motion planner and how its request is constructed */
+struct PlannerSetup
+{
+  std::string name;
+  std::function<std::unique_ptr<MotionPlanner>()> create;
+  std::function<bool(const Scene&)> supports;
+
+  /** @brief The program is seeded by the simple planner first, the same as the task composer pipelines */
+  bool seeded{ true };
+};
+
+std::shared_ptr<Environment> createEnvironment(const std::string& name)
+{
+  auto locator = std::make_shared<tesseract_common::GeneralResourceLocator>();
+  tesseract_common::fs::path urdf_path =
+      locator->locateResource("package://tesseract_support/urdf/" + name + ".urdf")->getFilePath();
+  tesseract_common::fs::path srdf_path =
+      locator->locateResource("package://tesseract_support/urdf/" + name + ".srdf")->getFilePath();
+  auto env = std::make_shared<Environment>();
+  if (!env->init(urdf_path, srdf_path, locator))
+    throw std::runtime_error("Failed to initialize the environment for " + name);
+
+  return env;
+}
+
+Command::Ptr addObstacle(const std::string& name,
+                         const tesseract_geometry::Geometry::Ptr& geometry,
+                         const Eigen::Vector3d& translation)
+{
+  Link link(name);
+
+  auto visual = std::make_shared<Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = translation;
+  visual->geometry = geometry;
+  link.visual.push_back(visual);
+
+  auto collision = std::make_shared<Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link.collision.push_back(collision);
+
+  Joint joint("joint_" + name);
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = link.getName();
+  joint.type = JointType::FIXED;
+
+  return std::make_shared<AddLinkCommand>(link, joint);
+}
+
+std::vector<std::string> getIiwaJointNames()
+{
+  return { "joint_a1", "joint_a2", "joint_a3", "joint_a4", "joint_a5", "joint_a6", "joint_a7" };
+}
+
+std::shared_ptr<ProfileDictionary> createProfiles(const std::string& freespace_profile)
+{
+  auto ompl_profile = std::make_shared<OMPLRealVectorPlanProfile>();
+  ompl_profile->solver_config.planners = { std::make_shared<const RRTConnectConfigurator>() };
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile(OMPL_DEFAULT_NAMESPACE, freespace_profile, ompl_profile);
+  return profiles;
+}
+
+/** @brief The freespace_ompl example, a freespace motion around a sphere */
+Scene createFreespaceOMPLScene()
+{
+  Scene scene;
+  scene.name = "freespace_ompl";
+  scene.env = createEnvironment("lbr_iiwa_14_r820");
+  auto sphere = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  scene.env->applyCommand(addObstacle("sphere_attached", sphere, Eigen::Vector3d(0.5, 0, 0.55)));
+  scene.profiles = createProfiles("FREESPACE");
+  scene.freespace = true;
+
+  std::vector<std::string> joint_names = getIiwaJointNames();
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  scene.env->setState(joint_names, joint_start_pos);
+
+  scene.program = CompositeInstruction("FREESPACE", ManipulatorInfo("manipulator", "base_link", "tool0"));
+  StateWaypointPoly wp0{ StateWaypoint(joint_names, joint_start_pos) };
+  StateWaypointPoly wp1{ StateWaypoint(joint_names, joint_end_pos) };
+  scene.program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "FREESPACE"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "FREESPACE"));
+  return scene;
+}
+
+/** @brief The basic_cartesian example, with a solid box in place of the point cloud octree */
+Scene createBasicCartesianScene()
+{
+  Scene scene;
+  scene.name = "basic_cartesian";
+  scene.env = createEnvironment("lbr_iiwa_14_r820");
+  scene.env->applyCommand(
+      addObstacle("octomap_attached", std::make_shared<tesseract_geometry::Box>(1, 1, 1), Eigen::Vector3d(1, 0, 0)));
+  scene.profiles = createProfiles("freespace_profile");
+  scene.cartesian = true;
+
+  std::vector<std::string> joint_names = getIiwaJointNames();
+  Eigen::VectorXd joint_pos(7);
+  joint_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  scene.env->setState(joint_names, joint_pos);
+
+  scene.program = CompositeInstruction("cartesian_program", ManipulatorInfo("manipulator", "base_link", "tool0"));
+  StateWaypointPoly wp0{ StateWaypoint(joint_names, joint_pos) };
+  CartesianWaypointPoly wp1{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.5, -0.2, 0.62) *
+                                               Eigen::Quaterniond(0, 0, 1.0, 0)) };
+  CartesianWaypointPoly wp2{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.5, 0.3, 0.62) *
+                                               Eigen::Quaterniond(0, 0, 1.0, 0)) };
+  scene.program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "freespace_profile"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "freespace_profile"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::LINEAR, "RASTER"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "freespace_profile"));
+  return scene;
+}
+
+/** @brief The car_seat example, the freespace motion from home to picking up the first seat */
+Scene createCarSeatScene()
+{
+  Scene scene;
+  scene.name = "car_seat";
+  scene.env = createEnvironment("car_seat_demo");
+  scene.profiles = createProfiles("FREESPACE");
+  scene.freespace = true;
+
+  // The seats, where the collision meshes are already a convex decomposition
+  auto locator = scene.env->getResourceLocator();
+  for (int i = 0; i < 3; ++i)
+  {
+    Link link_seat("seat_" + std::to_string(i + 1));
+    for (int m = 1; m <= 10; ++m)
+    {
+      auto meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::ConvexMesh>(
+          locator->locateResource("package://tesseract_support/meshes/car_seat/collision/seat_" + std::to_string(m) +
+                                  ".stl"));
+      for (auto& mesh : meshes)
+      {
+        auto collision = std::make_shared<Collision>();
+        collision->geometry = mesh;
+        link_seat.collision.push_back(collision);
+      }
+    }
+
+    Joint joint_seat("joint_seat_" + std::to_string(i + 1));
+    joint_seat.parent_link_name = "world";
+    joint_seat.child_link_name = link_seat.getName();
+    joint_seat.type = JointType::FIXED;
+    joint_seat.parent_to_joint_origin_transform = Eigen::AngleAxisd(3.14159, Eigen::Vector3d::UnitZ());
+    joint_seat.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0.5 + i, 2.15, 0.45);
+    scene.env->applyCommand(std::make_shared<AddLinkCommand>(link_seat, joint_seat));
+  }
+
+  std::unordered_map<std::string, double> home{ { "carriage_rail", 0.0 }, { "joint_b", 0.0 }, { "joint_e", 0.0 },
+                                                { "joint_l", 0.0 },       { "joint_r", 0.0 }, { "joint_s", 0.0 },
+                                                { "joint_t", 0.0 },       { "joint_u", 0.0 } };
+  std::unordered_map<std::string, double> pick1{ { "carriage_rail", 2.22 }, { "joint_b", 0.39 }, { "joint_e", 0.0 },
+                                                 { "joint_l", 0.5 },        { "joint_r", 0.0 },  { "joint_s", -3.14 },
+                                                 { "joint_t", -0.29 },      { "joint_u", -1.45 } };
+  scene.env->setState(home);
+
+  auto joint_group = scene.env->getJointGroup("manipulator");
+  const std::vector<std::string> joint_names = joint_group->getJointNames();
+  Eigen::VectorXd start_pos(static_cast<Eigen::Index>(joint_names.size()));
+  Eigen::VectorXd pick_pos(static_cast<Eigen::Index>(joint_names.size()));
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    start_pos(static_cast<Eigen::Index>(i)) = home.at(joint_names[i]);
+    pick_pos(static_cast<Eigen::Index>(i)) = pick1.at(joint_names[i]);
+  }
+
+  scene.program = CompositeInstruction("FREESPACE", ManipulatorInfo("manipulator", "world", "end_effector"));
+  StateWaypointPoly wp0{ StateWaypoint(joint_names, start_pos) };
+  StateWaypointPoly wp1{ StateWaypoint(joint_names, pick_pos) };
+  scene.program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "FREESPACE"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "FREESPACE"));
+  return scene;
+}
+
+/** @brief The puzzle_piece example, a Cartesian tool path over the part */
+Scene createPuzzlePieceScene()
+{
+  Scene scene;
+  scene.name = "puzzle_piece";
+  scene.env = createEnvironment("puzzle_piece_workcell");
+  scene.profiles = createProfiles("DEFAULT");
+  scene.cartesian = true;
+
+  std::vector<std::string> joint_names = getIiwaJointNames();
+  Eigen::VectorXd joint_pos(7);
+  joint_pos << -0.785398, 0.4, 0.0, -1.9, 0.0, 1.0, 0.0;
+  scene.env->setState(joint_names, joint_pos);
+
+  ManipulatorInfo mi("manipulator", "part", "grinder_frame");
+  scene.program = CompositeInstruction("DEFAULT", mi);
+
+  // The tool path is exported in millimeters as a position and a normal per row, after two header rows
+  auto resource = scene.env->getResourceLocator()->locateResource("package://tesseract_support/urdf/puzzle_bent.csv");
+  std::ifstream indata(resource->getFilePath());
+  std::string line;
+  int lnum = 0;
+  while (std::getline(indata, line))
+  {
+    if (++lnum < 3)
+      continue;
+
+    std::stringstream line_stream(line);
+    std::string cell;
+    Eigen::Matrix<double, 6, 1> xyzijk = Eigen::Matrix<double, 6, 1>::Zero();
+    std::getline(line_stream, cell, ',');
+    for (int i = 0; i < 6 && std::getline(line_stream, cell, ','); ++i)
+      xyzijk(i) = std::stod(cell);
+
+    Eigen::Vector3d pos = xyzijk.head<3>() / 1000.0;
+    Eigen::Vector3d norm = xyzijk.tail<3>().normalized();
+    Eigen::Vector3d temp_x = (-1 * pos).normalized();
+    Eigen::Vector3d y_axis = (norm.cross(temp_x)).normalized();
+    Eigen::Vector3d x_axis = (y_axis.cross(norm)).normalized();
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.matrix().col(0).head<3>() = x_axis;
+    pose.matrix().col(1).head<3>() = y_axis;
+    pose.matrix().col(2).head<3>() = norm;
+    pose.matrix().col(3).head<3>() = pos;
+
+    CartesianWaypointPoly wp{ CartesianWaypoint(pose) };
+    scene.program.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "CARTESIAN"));
+  }
+
+  assignCurrentStateAsSeed(scene.program, *scene.env);
+  return scene;
+}
+
+/** @brief The glass_upright example, a linear joint motion around a sphere */
+Scene createGlassUprightScene()
+{
+  Scene scene;
+  scene.name = "glass_upright";
+  scene.env = createEnvironment("lbr_iiwa_14_r820");
+  auto sphere = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  scene.env->applyCommand(addObstacle("sphere_attached", sphere, Eigen::Vector3d(0.5, 0, 0.55)));
+  scene.profiles = createProfiles("UPRIGHT");
+
+  std::vector<std::string> joint_names = getIiwaJointNames();
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  scene.env->setState(joint_names, joint_start_pos);
+
+  scene.program = CompositeInstruction("UPRIGHT", ManipulatorInfo("manipulator", "base_link", "tool0"));
+  StateWaypointPoly wp0{ StateWaypoint(joint_names, joint_start_pos) };
+  StateWaypointPoly wp1{ StateWaypoint(joint_names, joint_end_pos) };
+  scene.program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::LINEAR, "UPRIGHT"));
+  scene.program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::LINEAR, "UPRIGHT"));
+  return scene;
+}
+
+/** @brief Problem construction, building the request and seeding it the same way the pipelines do */
+PlannerRequest constructRequest(const Scene& scene, const PlannerSetup& setup, const MotionPlanner& planner)
+{
+  PlannerRequest request;
+  request.name = planner.getName();
+  request.env = scene.env;
+  request.profiles = scene.profiles;
+  request.instructions = scene.program;
+
+  if (setup.seeded)
+  {
+    SimpleMotionPlanner simple_planner(SIMPLE_DEFAULT_NAMESPACE);
+    PlannerRequest seed_request = request;
+    seed_request.format_result_as_input = true;
+    request.instructions = simple_planner.solve(seed_request).results;
+  }
+
+  // TrajOpt is the only planner which exposes its problem, the others construct it as part of solve
+  if (const auto* trajopt_planner = dynamic_cast<const TrajOptMotionPlanner*>(&planner))
+    request.data = trajopt_planner->createProblem(request);
+
+  return request;
+}
+
+/** @brief Post-processing, extracting the trajectory and checking it for collisions */
+bool postProcess(const CompositeInstruction& results,
+                 tesseract_collision::DiscreteContactManager& manager,
+                 const tesseract_scene_graph::StateSolver& state_solver)
+{
+  tesseract_collision::CollisionCheckConfig config;
+  config.type = tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE;
+
+  tesseract_common::JointTrajectory trajectory = toJointTrajectory(results);
+  benchmark::DoNotOptimize(trajectory);
+
+  std::vector<tesseract_collision::ContactResultMap> contacts;
+  return !contactCheckProgram(contacts, manager, state_solver, results, config);
+}
+
+void registerBenchmarks(const std::shared_ptr<const Scene>& scene, const PlannerSetup& setup)
+{
+  const std::string prefix = setup.name + "/" + scene->name + "/";
+
+  benchmark::RegisterBenchmark((prefix + "Construction").c_str(), [scene, setup](benchmark::State& state) {
+    auto planner = setup.create();
+    for (auto _ : state)
+    {
+      PlannerRequest request = constructRequest(*scene, setup, *planner);
+      benchmark::DoNotOptimize(request);
+    }
+  })->Unit(benchmark::kMillisecond);
+
+  benchmark::RegisterBenchmark((prefix + "Solve").c_str(), [scene, setup](benchmark::State& state) {
+    auto planner = setup.create();
+    const PlannerRequest request = constructRequest(*scene, setup, *planner);
+    std::size_t successful{ 0 };
+    for (auto _ : state)
+    {
+      PlannerResponse response = planner->solve(request);
+      successful += static_cast<std::size_t>(response.successful);
+      benchmark::DoNotOptimize(response);
+    }
+    state.counters["success_rate"] =
+        benchmark::Counter(static_cast<double>(successful), benchmark::Counter::kAvgIterations);
+  })->Unit(benchmark::kMillisecond);
+
+  benchmark::RegisterBenchmark((prefix + "PostProcessing").c_str(), [scene, setup](benchmark::State& state) {
+    auto planner = setup.create();
+    const PlannerResponse response = planner->solve(constructRequest(*scene, setup, *planner));
+    if (!response.successful)
+    {
+      state.SkipWithError(("Planning failed: " + response.message).c_str());
+      return;
+    }
+
+    auto joint_group = scene->env->getJointGroup(scene->program.getManipulatorInfo().manipulator);
+    auto manager = scene->env->getDiscreteContactManager();
+    manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+    auto state_solver = scene->env->getStateSolver();
+
+    std::size_t collision_free{ 0 };
+    for (auto _ : state)
+      collision_free += static_cast<std::size_t>(postProcess(response.results, *manager, *state_solver));
+
+    state.counters["collision_free_rate"] =
+        benchmark::Counter(static_cast<double>(collision_free), benchmark::Counter::kAvgIterations);
+  })->Unit(benchmark::kMillisecond);
+}
+
+/**
+ * @brief Runs the benchmarks, writing the results as JSON
+ * @details Unless --benchmark_out is provided the results are written to motion_planners_benchmark.json in the
+ * working directory, so planning latency can be tracked per commit.
+ */
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_ERROR);
+
+  std::vector<std::shared_ptr<const Scene>> scenes;
+  try
+  {
+    scenes.push_back(std::make_shared<const Scene>(createFreespaceOMPLScene()));
+    scenes.push_back(std::make_shared<const Scene>(createBasicCartesianScene()));
+    scenes.push_back(std::make_shared<const Scene>(createCarSeatScene()));
+    scenes.push_back(std::make_shared<const Scene>(createPuzzlePieceScene()));
+    scenes.push_back(std::make_shared<const Scene>(createGlassUprightScene()));
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Failed to create the benchmark scenes: %s", e.what());
+    return 1;
+  }
+
+  const auto all = [](const Scene&) { return true; };
+  std::vector<PlannerSetup> setups;
+  setups.push_back({ "SimpleMotionPlanner",
+                     [] { return std::make_unique<SimpleMotionPlanner>(SIMPLE_DEFAULT_NAMESPACE); },
+                     all,
+                     false });
+  setups.push_back({ "OMPLMotionPlanner",
+                     [] { return std::make_unique<OMPLMotionPlanner>(OMPL_DEFAULT_NAMESPACE); },
+                     [](const Scene& scene) { return scene.freespace; },
+                     true });
+  setups.push_back({ "DescartesMotionPlanner",
+                     [] { return std::make_unique<DescartesMotionPlannerD>(DESCARTES_DEFAULT_NAMESPACE); },
+                     [](const Scene& scene) { return scene.cartesian; },
+                     true });
+  setups.push_back({ "TrajOptMotionPlanner",
+                     [] { return std::make_unique<TrajOptMotionPlanner>(TRAJOPT_DEFAULT_NAMESPACE); },
+                     all,
+                     true });
+  setups.push_back({ "TrajOptIfoptMotionPlanner",
+                     [] { return std::make_unique<TrajOptIfoptMotionPlanner>(TRAJOPT_IFOPT_DEFAULT_NAMESPACE); },
+                     all,
+                     true });
+
+  for (const auto& setup : setups)
+  {
+    for (const auto& scene : scenes)
+    {
+      if (setup.supports(*scene))
+        registerBenchmarks(scene, setup);
+    }
+  }
+
+  return tesseract_planning::test_suite::runBenchmarks(argc, argv, "motion_planners_benchmark.json");
+}
@@ -223,13 +223,14 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
   std::vector<Eigen::VectorXd> seed_states;
   seed_states.reserve(move_instructions.size());
 
+  ProfileResolver<TrajOptPlanProfile, TrajOptDefaultPlanProfile> plan_profiles(name_, *request.profiles);
+
   for (int i = 0; i < static_cast<Eigen::Index>(move_instructions.size()); ++i)
   {
     const auto& move_instruction = move_instructions[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>();
 
     // Get Plan Profile
-    TrajOptPlanProfile::ConstPtr cur_plan_profile = getProfile<TrajOptPlanProfile>(
-        name_, move_instruction.getProfile(name_), *request.profiles, std::make_shared<TrajOptDefaultPlanProfile>());
+    const TrajOptPlanProfile::ConstPtr& cur_plan_profile = plan_profiles.get(move_instruction.getProfile(name_));
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
 
@@ -97,16 +97,13 @@ PlannerResponse TrajOptIfoptMotionPlanner::solve(const PlannerRequest& request)
   // ----------------
   // Transform plan instructions into trajopt cost and constraints
   std::vector<std::shared_ptr<const trajopt_ifopt::JointPosition>> vars;
+  ProfileResolver<TrajOptIfoptPlanProfile, TrajOptIfoptDefaultPlanProfile> plan_profiles(name_, *request.profiles);
   for (int i = 0; i < move_instructions.size(); ++i)
   {
     const auto& move_instruction = move_instructions[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>();
 
     // Get Plan Profile
-    TrajOptIfoptPlanProfile::ConstPtr cur_plan_profile =
-        getProfile<TrajOptIfoptPlanProfile>(name_,
-                                            move_instruction.getProfile(name_),
-                                            *request.profiles,
-                                            std::make_shared<TrajOptIfoptDefaultPlanProfile>());
+    const TrajOptIfoptPlanProfile::ConstPtr& cur_plan_profile = plan_profiles.get(move_instruction.getProfile(name_));
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptIfoptMotionPlanner: Invalid profile");
 
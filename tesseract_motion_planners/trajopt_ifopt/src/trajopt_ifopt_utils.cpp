@@ -154,82 +154,55 @@ createCollisionConstraints(const std::vector<std::shared_ptr<const trajopt_ifopt
   if (config->type == tesseract_collision::CollisionEvaluatorType::NONE)
     return constraints;
 
-  // Add a collision cost for all steps
+  constraints.reserve(vars.size());
+
+  // The manipulator, collision pairs and fixed indices are the same for every step so they are only computed once
+  std::shared_ptr<const tesseract_kinematics::JointGroup> manip = env->getJointGroup(manip_info.manipulator);
+  auto validator = env->getDiscreteContactManager()->getContactAllowedValidator();
+  auto cp = tesseract_collision::getCollisionObjectPairs(
+      manip->getActiveLinkNames(), manip->getStaticLinkNames(), validator);
+  const int max_num_cnt = std::min(config->max_num_cnt, static_cast<int>(cp.size()));
+
+  std::vector<bool> fixed(vars.size(), false);
+  for (int index : fixed_indices)
+  {
+    if (index >= 0 && static_cast<std::size_t>(index) < vars.size())
+      fixed[static_cast<std::size_t>(index)] = true;
+  }
+
+  // A single evaluator is shared by all steps. The constraints are evaluated sequentially by the solver and the
+  // evaluator only depends on the joint values provided so this avoids cloning a contact manager per step.
   auto collision_cache = std::make_shared<trajopt_ifopt::CollisionCache>(vars.size());
-  std::unordered_map<std::string, std::shared_ptr<const tesseract_kinematics::JointGroup>> manipulators;
   if (config->type == tesseract_collision::CollisionEvaluatorType::DISCRETE)
   {
+    auto collision_evaluator =
+        std::make_shared<trajopt_ifopt::SingleTimestepCollisionEvaluator>(collision_cache, manip, env, config);
+
     for (std::size_t i = 0; i < vars.size(); ++i)
     {
-      if (std::find(fixed_indices.begin(), fixed_indices.end(), i) != fixed_indices.end())
+      if (fixed[i])
         continue;
 
-      std::shared_ptr<const tesseract_kinematics::JointGroup> manip;
-      auto it = manipulators.find(manip_info.manipulator);
-      if (it != manipulators.end())
-      {
-        manip = it->second;
-      }
-      else
-      {
-        manip = env->getJointGroup(manip_info.manipulator);
-        manipulators[manip_info.manipulator] = manip;
-      }
-
-      auto collision_evaluator =
-          std::make_shared<trajopt_ifopt::SingleTimestepCollisionEvaluator>(collision_cache, manip, env, config);
-
-      auto active_link_names = manip->getActiveLinkNames();
-      auto static_link_names = manip->getStaticLinkNames();
-      auto cp = tesseract_collision::getCollisionObjectPairs(
-          active_link_names, static_link_names, env->getDiscreteContactManager()->getContactAllowedValidator());
-
       constraints.push_back(std::make_shared<trajopt_ifopt::DiscreteCollisionConstraint>(
-          collision_evaluator,
-          vars[i],
-          std::min(config->max_num_cnt, static_cast<int>(cp.size())),
-          fixed_sparsity,
-          "DiscreteCollision_" + std::to_string(i)));
+          collision_evaluator, vars[i], max_num_cnt, fixed_sparsity, "DiscreteCollision_" + std::to_string(i)));
     }
   }
   else if (config->type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
-    bool time0_fixed = (std::find(fixed_indices.begin(), fixed_indices.end(), 0) != fixed_indices.end());
+    auto collision_evaluator =
+        std::make_shared<trajopt_ifopt::LVSDiscreteCollisionEvaluator>(collision_cache, manip, env, config);
+
     for (std::size_t i = 1; i < vars.size(); ++i)
     {
-      bool time1_fixed = (std::find(fixed_indices.begin(), fixed_indices.end(), i) != fixed_indices.end());
-
-      std::shared_ptr<const tesseract_kinematics::JointGroup> manip;
-      auto it = manipulators.find(manip_info.manipulator);
-      if (it != manipulators.end())
-      {
-        manip = it->second;
-      }
-      else
-      {
-        manip = env->getJointGroup(manip_info.manipulator);
-        manipulators[manip_info.manipulator] = manip;
-      }
-
-      auto collision_evaluator =
-          std::make_shared<trajopt_ifopt::LVSDiscreteCollisionEvaluator>(collision_cache, manip, env, config);
-
-      auto active_link_names = manip->getActiveLinkNames();
-      auto static_link_names = manip->getStaticLinkNames();
-      auto cp = tesseract_collision::getCollisionObjectPairs(
-          active_link_names, static_link_names, env->getDiscreteContactManager()->getContactAllowedValidator());
-
       std::array<trajopt_ifopt::JointPosition::ConstPtr, 2> position_vars{ vars[i - 1], vars[i] };
-      std::array<bool, 2> position_vars_fixed{ time0_fixed, time1_fixed };
-      constraints.push_back(std::make_shared<trajopt_ifopt::ContinuousCollisionConstraint>(
-          collision_evaluator,
-          position_vars,
-          position_vars_fixed,
-          std::min(config->max_num_cnt, static_cast<int>(cp.size())),
-          fixed_sparsity,
-          "LVSDiscreteCollision_" + std::to_string(i)));
-
-      time0_fixed = time1_fixed;
+      std::array<bool, 2> position_vars_fixed{ fixed[i - 1], fixed[i] };
+      constraints.push_back(
+          std::make_shared<trajopt_ifopt::ContinuousCollisionConstraint>(collision_evaluator,
+                                                                         position_vars,
+                                                                         position_vars_fixed,
+                                                                         max_num_cnt,
+                                                                         fixed_sparsity,
+                                                                         "LVSDiscreteCollision_" + std::to_string(i)));
     }
   }
   else
@@ -241,42 +214,19 @@ createCollisionConstraints(const std::vector<std::shared_ptr<const trajopt_ifopt
                                                                                                                "Continu"
                                                                                                                "ousColl"
                                                                                                                "ision_";
-    bool time0_fixed = (std::find(fixed_indices.begin(), fixed_indices.end(), 0) != fixed_indices.end());
+    auto collision_evaluator =
+        std::make_shared<trajopt_ifopt::LVSContinuousCollisionEvaluator>(collision_cache, manip, env, config);
+
     for (std::size_t i = 1; i < vars.size(); ++i)
     {
-      bool time1_fixed = (std::find(fixed_indices.begin(), fixed_indices.end(), i) != fixed_indices.end());
-
-      std::shared_ptr<const tesseract_kinematics::JointGroup> manip;
-      auto it = manipulators.find(manip_info.manipulator);
-      if (it != manipulators.end())
-      {
-        manip = it->second;
-      }
-      else
-      {
-        manip = env->getJointGroup(manip_info.manipulator);
-        manipulators[manip_info.manipulator] = manip;
-      }
-
-      auto collision_evaluator =
-          std::make_shared<trajopt_ifopt::LVSContinuousCollisionEvaluator>(collision_cache, manip, env, config);
-
-      auto active_link_names = manip->getActiveLinkNames();
-      auto static_link_names = manip->getStaticLinkNames();
-      auto cp = tesseract_collision::getCollisionObjectPairs(
-          active_link_names, static_link_names, env->getDiscreteContactManager()->getContactAllowedValidator());
-
       std::array<trajopt_ifopt::JointPosition::ConstPtr, 2> position_vars{ vars[i - 1], vars[i] };
-      std::array<bool, 2> position_vars_fixed{ time0_fixed, time1_fixed };
-      constraints.push_back(std::make_shared<trajopt_ifopt::ContinuousCollisionConstraint>(
-          collision_evaluator,
-          position_vars,
-          position_vars_fixed,
-          std::min(config->max_num_cnt, static_cast<int>(cp.size())),
-          fixed_sparsity,
-          prefix + std::to_string(i)));
-
-      time0_fixed = time1_fixed;
+      std::array<bool, 2> position_vars_fixed{ fixed[i - 1], fixed[i] };
+      constraints.push_back(std::make_shared<trajopt_ifopt::ContinuousCollisionConstraint>(collision_evaluator,
+                                                                                           position_vars,
+                                                                                           position_vars_fixed,
+                                                                                           max_num_cnt,
+                                                                                           fixed_sparsity,
+                                                                                           prefix + std::to_string(i)));
     }
   }
 
@@ -33,10 +33,18 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_task.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
 
 namespace tesseract_planning
 {
 class TaskComposerPluginFactory;
+
+/**
+ * @brief Remaps data from the input keys to the output keys
+ * @details By default the data is moved. With 'copy' the input keys keep their data and the output keys get a copy,
+ * while with 'alias' both keys reference the same immutable payload so large programs are not copied. Aliased data is
+ * only copied when a task gets it to modify it.
+ */
 class RemapTask : public TaskComposerTask
 {
 public:
@@ -53,6 +61,10 @@ public:
                      const std::map<std::string, std::string>& remap,
                      bool copy = false,
                      bool is_conditional = false);
+  explicit RemapTask(std::string name,
+                     const std::map<std::string, std::string>& remap,
+                     TaskComposerDataStorage::RemapMode mode,
+                     bool is_conditional = false);
   explicit RemapTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~RemapTask() override = default;
 
@@ -61,6 +73,7 @@ public:
 
 protected:
   bool copy_{ false };
+  bool alias_{ false };
 
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_node_types.h>
 
 namespace boost::uuids
 {
@@ -45,6 +46,8 @@ namespace tesseract_planning
 {
 class TaskComposerDataStorage;
 class TaskComposerNode;
+class TaskComposerLogWriter;
+class TaskComposerTraceWriter;
 
 /**
  * @brief This class is passed as an input to each process in the decision tree
@@ -80,6 +83,9 @@ public:
   /** @brief Indicate if dotgraph should be provided */
   bool dotgraph{ false };
 
+  /** @brief The priority class the request was submitted with, dynamic tasks inherit it */
+  TaskComposerPriority priority{ TaskComposerPriority::NORMAL };
+
   /**
    * @brief The location data is stored and retrieved during execution
    * @details The problem input data is copied into this structure when constructed
@@ -89,6 +95,18 @@ public:
   /** @brief Container for meta-data generated by task(s) during execution */
   TaskComposerNodeInfoContainer task_infos;
 
+  /**
+   * @brief An optional streaming log writer
+   * @details If set each task records its inputs, outputs and node info as it executes. This is not serialized.
+   */
+  std::shared_ptr<TaskComposerLogWriter> log_writer;
+
+  /**
+   * @brief An optional trace writer
+   * @details If set each node writes its trace events as it finishes. This is not serialized.
+   */
+  std::shared_ptr<TaskComposerTraceWriter> trace_writer;
+
   /**
    * @brief Check if process has been aborted
    * @details This accesses the internal process interface class
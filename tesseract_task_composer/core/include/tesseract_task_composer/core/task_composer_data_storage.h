@@ -28,10 +28,14 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <unordered_map>
 #include <shared_mutex>
+#include <vector>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/export.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -40,7 +44,18 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-/** @brief A thread save data storage */
+/**
+ * @brief A thread save data storage
+ * @details Data is stored in chunks of slots indexed by the slot id of its key (see TaskComposerKeys::intern), each
+ * slot having its own lock. The string key methods look up the slot id of the key, while nodes use the slot ids
+ * resolved by their TaskComposerKeys so accessing data does not hash the key or lock the whole storage. The chunks of
+ * the first slot ids are indexed directly, the chunks of higher slot ids are looked up in a map so the number of keys
+ * is not limited.
+ *
+ * The data of a slot is an immutable shared payload, it is never modified in place but replaced by setData. This allows
+ * several keys and copies of the storage to reference the same payload, while getData returns a copy so the first
+ * mutable access to aliased data copies it and writing it back with setData does not affect the other references.
+ */
 class TaskComposerDataStorage
 {
 public:
@@ -49,9 +64,28 @@ public:
   using UPtr = std::unique_ptr<TaskComposerDataStorage>;
   using ConstUPtr = std::unique_ptr<const TaskComposerDataStorage>;
 
-  TaskComposerDataStorage() = default;
-  ~TaskComposerDataStorage() = default;
+  /** @brief How remapData treats the data of the source key */
+  enum class RemapMode
+  {
+    /** @brief The data is moved and the source key is removed */
+    MOVE,
+    /** @brief The data is copied and the source key keeps its data */
+    COPY,
+    /** @brief Both keys reference the same immutable payload, nothing is copied */
+    ALIAS
+  };
+
+  TaskComposerDataStorage();
+  ~TaskComposerDataStorage();
+
+  /**
+   * @brief Copy the keys of another data storage
+   * @details The payloads are shared with the other storage instead of copied, which is safe since they are immutable.
+   * Setting or removing data in either storage replaces its own reference only, so it never shows through the other.
+   */
   TaskComposerDataStorage(const TaskComposerDataStorage&);
+
+  /** @brief Copy the keys of another data storage, sharing the payloads the same way as the copy constructor */
   TaskComposerDataStorage& operator=(const TaskComposerDataStorage&);
   TaskComposerDataStorage(TaskComposerDataStorage&&) noexcept;
   TaskComposerDataStorage& operator=(TaskComposerDataStorage&&) noexcept;
@@ -91,12 +125,56 @@ public:
    */
   tesseract_common::AnyPoly getData(const std::string& key) const;
 
+  /**
+   * @brief Get the immutable payload for the provided key without copying it
+   * @details If the key does not exist it will be a nullptr
+   * @param key The key to retreive the data
+   * @return The payload associated with the key
+   */
+  std::shared_ptr<const tesseract_common::AnyPoly> getSharedData(const std::string& key) const;
+
   /**
    * @brief Remove data for the provide key
    * @param key The key to remove data for
    */
   void removeData(const std::string& key);
 
+  /**
+   * @brief Check if data exists for the provided slot id
+   * @param slot The slot id of the key
+   * @return True if the data exist, otherwise false
+   */
+  bool hasKey(std::size_t slot) const;
+
+  /**
+   * @brief Set data for the provided slot id
+   * @param slot The slot id of the key
+   * @param data The data to assign to the provided slot
+   */
+  void setData(std::size_t slot, tesseract_common::AnyPoly data);
+
+  /**
+   * @brief Get the data for the provided slot id
+   * @details If the slot has no data it will be null
+   * @param slot The slot id of the key
+   * @return The data associated with the slot
+   */
+  tesseract_common::AnyPoly getData(std::size_t slot) const;
+
+  /**
+   * @brief Get the immutable payload for the provided slot id without copying it
+   * @details If the slot has no data it will be a nullptr
+   * @param slot The slot id of the key
+   * @return The payload associated with the slot
+   */
+  std::shared_ptr<const tesseract_common::AnyPoly> getSharedData(std::size_t slot) const;
+
+  /**
+   * @brief Remove data for the provided slot id
+   * @param slot The slot id of the key
+   */
+  void removeData(std::size_t slot);
+
   /**
    * @brief Get all data stored
    * @return A copy of the data
@@ -105,12 +183,22 @@ public:
 
   /**
    * @brief Remap data from one key to another
+   * @details Each entry is remapped atomically, but not the remapping as a whole
    * @param remapping The key value pairs to remap data from the first to the second
    * @param copy Default behavior is not move the data, but if copy is desired set this to true
    * @return True if successful, otherwise false
    */
   bool remapData(const std::map<std::string, std::string>& remapping, bool copy = false);
 
+  /**
+   * @brief Remap data from one key to another
+   * @details Each entry is remapped atomically, but not the remapping as a whole
+   * @param remapping The key value pairs to remap data from the first to the second
+   * @param mode Indicate if the data is moved, copied or aliased
+   * @return True if successful, otherwise false
+   */
+  bool remapData(const std::map<std::string, std::string>& remapping, RemapMode mode);
+
   bool operator==(const TaskComposerDataStorage& rhs) const;
   bool operator!=(const TaskComposerDataStorage& rhs) const;
 
@@ -121,9 +209,57 @@ protected:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
+  /** @brief The number of slots allocated at once */
+  static constexpr std::size_t CHUNK_SIZE{ 64 };
+
+  /** @brief The number of chunks indexed directly, the chunks of higher slot ids are looked up in a map */
+  static constexpr std::size_t DIRECT_CHUNKS{ 8 };
+
+  struct Slot;
+  struct Chunk;
+
+  /** @brief Protects the name */
   mutable std::shared_mutex mutex_;
   std::string name_;
-  std::unordered_map<std::string, tesseract_common::AnyPoly> data_;
+
+  /** @brief The lazily allocated chunks of the first slots, a chunk is never released until the storage is destroyed */
+  std::array<std::atomic<Chunk*>, DIRECT_CHUNKS> chunks_{};
+
+  /** @brief Protects the overflow chunks */
+  mutable std::shared_mutex overflow_mutex_;
+
+  /** @brief The lazily allocated chunks beyond the direct chunks by chunk index, never released until destroyed */
+  std::map<std::size_t, std::unique_ptr<Chunk>> overflow_chunks_;
+
+  /** @brief Get a chunk if it was allocated, otherwise nullptr */
+  Chunk* findChunk(std::size_t index) const;
+
+  /** @brief Get a chunk allocating it if needed */
+  Chunk& getChunk(std::size_t index);
+
+  /** @brief Get the indices of the allocated chunks in increasing order */
+  std::vector<std::size_t> getChunkIndices() const;
+
+  /** @brief Get a slot if its chunk was allocated, otherwise nullptr */
+  Slot* findSlot(std::size_t slot) const;
+
+  /** @brief Get a slot allocating its chunk if needed */
+  Slot& getSlot(std::size_t slot);
+
+  /** @brief Set the payload of a slot, a nullptr removes the data */
+  void setPayload(std::size_t slot, std::shared_ptr<const tesseract_common::AnyPoly> payload);
+
+  /** @brief Call the function for each slot which has data */
+  void forEachSlot(const std::function<void(std::size_t, Slot&)>& fn) const;
+
+  /** @brief Remove all data and share the payloads of another storage */
+  void copyFrom(const TaskComposerDataStorage& other);
+
+  /** @brief Remove all data and take the chunks of another storage */
+  void moveFrom(TaskComposerDataStorage& other);
+
+  /** @brief Release all chunks */
+  void clear();
 };
 
 }  // namespace tesseract_planning
@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/fwd.h>
+#include <tesseract_task_composer/core/task_composer_node_types.h>
 
 namespace tesseract_planning
 {
@@ -42,6 +43,36 @@ class TaskComposerContext;
 class TaskComposerDataStorage;
 class TaskComposerFuture;
 class TaskComposerNode;
+class TaskComposerLogWriter;
+class TaskComposerTraceWriter;
+
+/** @brief The admission and timing metrics of a priority class */
+struct TaskComposerExecutorMetrics
+{
+  /** @brief The number of requests admitted, including the ones which were deferred */
+  std::size_t admitted{ 0 };
+
+  /** @brief The number of requests which were deferred because the class was at capacity */
+  std::size_t deferred{ 0 };
+
+  /** @brief The number of requests which were rejected because the class was at capacity */
+  std::size_t rejected{ 0 };
+
+  /** @brief The number of requests which finished */
+  std::size_t completed{ 0 };
+
+  /** @brief The accumulated time in seconds between submission and the start of execution */
+  double queue_wait_time{ 0 };
+
+  /** @brief The largest time in seconds between submission and the start of execution */
+  double max_queue_wait_time{ 0 };
+
+  /** @brief The accumulated time in seconds between the start and the end of execution */
+  double execution_time{ 0 };
+
+  /** @brief The largest time in seconds between the start and the end of execution */
+  double max_execution_time{ 0 };
+};
 
 class TaskComposerExecutor
 {
@@ -68,12 +99,82 @@ public:
                                           std::shared_ptr<TaskComposerDataStorage> data_storage,
                                           bool dotgraph = false);
 
+  /**
+   * @brief Execute the provided node with a priority class
+   * @details The executor may throw if the priority class is at capacity and its admission policy rejects new requests
+   * @param node The node to execute
+   * @param data_storage The data storage object to leverage
+   * @param priority The priority class of the request
+   * @param dotgraph Indicate if dotgraph should be generated
+   * @return The future associated with execution
+   */
+  std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
+                                          std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                          TaskComposerPriority priority,
+                                          bool dotgraph = false);
+
+  /**
+   * @brief Execute the provided node while streaming a log
+   * @details The initial data is recorded before execution starts, each task records its inputs, outputs and node
+   * info as it executes. Call TaskComposerLogWriter::writeContext and close once the future is ready.
+   * @param node The node to execute
+   * @param data_storage The data storage object to leverage
+   * @param log_writer The streaming log writer
+   * @param dotgraph Indicate if dotgraph should be generated
+   * @return The future associated with execution
+   */
+  std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
+                                          std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                          std::shared_ptr<TaskComposerLogWriter> log_writer,
+                                          bool dotgraph = false);
+
+  /**
+   * @brief Execute the provided node while streaming trace events
+   * @details Each node writes its trace events as it finishes. Call TaskComposerTraceWriter::close once the future is
+   * ready.
+   * @param node The node to execute
+   * @param data_storage The data storage object to leverage
+   * @param trace_writer The trace writer
+   * @param dotgraph Indicate if dotgraph should be generated
+   * @return The future associated with execution
+   */
+  std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
+                                          std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                          std::shared_ptr<TaskComposerTraceWriter> trace_writer,
+                                          bool dotgraph = false);
+
+  /**
+   * @brief Execute the provided node from within a running node
+   * @details The child context shares the data storage of the parent and inherits its priority, dotgraph setting, log
+   * writer and trace writer. The caller is expected to merge the child node infos into the parent context.
+   * @param node The node to execute
+   * @param parent_context The context of the running node
+   * @return The future associated with execution
+   */
+  std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node, const TaskComposerContext& parent_context);
+
+  /**
+   * @brief Execute the provided node from within a running node on its own data storage
+   * @details The child context inherits the priority, dotgraph setting, log writer and trace writer of the parent. The
+   * caller is expected to merge the child node infos into the parent context.
+   * @param node The node to execute
+   * @param data_storage The data storage of the child context
+   * @param parent_context The context of the running node
+   * @return The future associated with execution
+   */
+  std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
+                                          std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                          const TaskComposerContext& parent_context);
+
   /** @brief Queries the number of workers (example: number of threads) */
   virtual long getWorkerCount() const = 0;
 
   /** @brief Queries the number of running tasks at the time of this call */
   virtual long getTaskCount() const = 0;
 
+  /** @brief Queries the admission and timing metrics of a priority class */
+  virtual TaskComposerExecutorMetrics getMetrics(TaskComposerPriority priority) const = 0;
+
   bool operator==(const TaskComposerExecutor& rhs) const;
   bool operator!=(const TaskComposerExecutor& rhs) const;
 
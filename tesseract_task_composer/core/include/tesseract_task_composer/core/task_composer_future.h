@@ -29,14 +29,55 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <chrono>
+#include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
 class TaskComposerContext;
 
+/** @brief The callback invoked when a task composer future completes */
+using TaskComposerFutureCallback = std::function<void(const std::shared_ptr<TaskComposerContext>& context)>;
+
+/**
+ * @brief The completion state shared by all copies of a future
+ * @details The executor calls complete() once the work has finished. Callbacks added before completion are invoked
+ * by the thread calling complete() and callbacks added afterwards are invoked immediately by the thread adding them.
+ * Each callback is invoked exactly once.
+ */
+class TaskComposerFutureCompletion
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerFutureCompletion>;
+  using ConstPtr = std::shared_ptr<const TaskComposerFutureCompletion>;
+
+  /**
+   * @brief Add a callback to be invoked on completion
+   * @param callback The callback
+   * @param context The context provided to the callback if already complete
+   */
+  void addCallback(TaskComposerFutureCallback callback, const std::shared_ptr<TaskComposerContext>& context);
+
+  /**
+   * @brief Mark as complete and invoke the registered callbacks
+   * @details Exceptions thrown by callbacks are logged and ignored so they do not propagate into the executor
+   * @param context The context provided to the callbacks
+   */
+  void complete(const std::shared_ptr<TaskComposerContext>& context);
+
+  /** @brief Check if complete() has been called */
+  bool isComplete() const;
+
+private:
+  mutable std::mutex mutex_;
+  bool complete_{ false };
+  std::vector<TaskComposerFutureCallback> callbacks_;
+};
+
 /**
  * @brief This contains the result for the task composer request
  * @details Also this must be copyable so recommend using shared future or something comparable
@@ -86,6 +127,15 @@ public:
   virtual std::future_status
   waitUntil(const std::chrono::time_point<std::chrono::high_resolution_clock>& abs) const = 0;
 
+  /**
+   * @brief Register a callback to be invoked when the process has finished
+   * @details This does not block. The callback is invoked on an executor thread when the process finishes or
+   * immediately on the calling thread if it has already finished, allowing a single thread to service many requests.
+   * @note The callback must not wait on this future, the shared state is not ready until the callback returns
+   * @param callback The callback which is provided the context
+   */
+  virtual void then(TaskComposerFutureCallback callback) = 0;
+
   /**
    * @brief Make a copy of the future
    * @return A copy, for example to allow access from multiple thread
@@ -20,6 +20,7 @@
 
 #include <unordered_map>
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 #include <variant>
@@ -36,6 +37,32 @@ class TaskComposerKeys
 public:
   using EntryType = std::variant<std::string, std::vector<std::string>>;
   using ContainerType = std::unordered_map<std::string, EntryType>;
+  using SlotEntryType = std::variant<std::size_t, std::vector<std::size_t>>;
+  using SlotContainerType = std::unordered_map<std::string, SlotEntryType>;
+
+  /**
+   * @brief Intern a key into a slot id
+   * @details Slot ids are process wide, the same key always maps to the same slot id. They are used by the data
+   * storage to index data without hashing the key on every access. Slot ids must remain valid for the lifetime of the
+   * process so an interned key is never released, the number of keys is not limited but each distinct key is kept.
+   * @param key The key to intern
+   * @return The slot id of the key
+   */
+  static std::size_t intern(const std::string& key);
+
+  /**
+   * @brief Find the slot id of a key without interning it
+   * @param key The key to search for
+   * @return The slot id, if the key was never interned std::nullopt is returned
+   */
+  static std::optional<std::size_t> findSlot(const std::string& key);
+
+  /**
+   * @brief Get the key associated with a slot id
+   * @param slot The slot id
+   * @return The key
+   */
+  static const std::string& getKey(std::size_t slot);
 
   /**
    * @brief Add key
@@ -78,6 +105,13 @@ public:
    */
   const ContainerType& data() const;
 
+  /**
+   * @brief Get the slot ids of the keys assigned to each port
+   * @details This is updated when keys are added or renamed, so nodes can access the data storage by slot id
+   * @return The slot container object
+   */
+  const SlotContainerType& slots() const;
+
   /** @brief The size */
   std::size_t size() const;
 
@@ -89,6 +123,10 @@ public:
 
 private:
   ContainerType keys_;
+  SlotContainerType slots_;
+
+  /** @brief Update the slot ids of a port from its keys */
+  void updateSlots(const std::string& port);
 
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
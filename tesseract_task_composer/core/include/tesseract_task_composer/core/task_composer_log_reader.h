@@ -0,0 +1,148 @@
+/**
+ * @file task_composer_log_reader.h
+ * @brief A memory mapped reader for streaming task composer logs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_READER_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_READER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/uuid/uuid.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_log_writer.h>
+
+namespace boost::iostreams
+{
+class mapped_file_source;
+}
+
+namespace tesseract_planning
+{
+class TaskComposerDataStorage;
+class TaskComposerNodeInfo;
+class TaskComposerNodeInfoContainer;
+
+/**
+ * @brief A reader for logs produced by the TaskComposerLogWriter
+ * @details The file is memory mapped and only the index is parsed when opened. Each request decompresses and
+ * deserializes only the chunks it needs, so a single task's inputs and outputs can be inspected without loading the
+ * entire log. If the log was not closed properly the chunks are recovered by scanning the file.
+ */
+class TaskComposerLogReader
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerLogReader>;
+  using ConstPtr = std::shared_ptr<const TaskComposerLogReader>;
+  using UPtr = std::unique_ptr<TaskComposerLogReader>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerLogReader>;
+
+  /**
+   * @brief Open a streaming log
+   * @param filepath The file path
+   */
+  TaskComposerLogReader(const std::string& filepath);
+  ~TaskComposerLogReader();
+  TaskComposerLogReader(const TaskComposerLogReader&) = delete;
+  TaskComposerLogReader& operator=(const TaskComposerLogReader&) = delete;
+  TaskComposerLogReader(TaskComposerLogReader&&) = delete;
+  TaskComposerLogReader& operator=(TaskComposerLogReader&&) = delete;
+
+  /** @brief Get the compression used by the log */
+  TaskComposerLogCompression getCompression() const;
+
+  /**
+   * @brief Check if the log was closed properly
+   * @return True if the index was found, otherwise false and the chunks were recovered by scanning the file
+   */
+  bool isComplete() const;
+
+  /** @brief Get the chunk index */
+  const std::vector<TaskComposerLogChunkEntry>& getIndex() const;
+
+  /** @brief Get the log description */
+  std::string getDescription() const;
+
+  /** @brief Get the initial data storage, if not recorded an empty data storage is returned */
+  TaskComposerDataStorage getInitialData() const;
+
+  /** @brief Get the final data storage, if not recorded an empty data storage is returned */
+  TaskComposerDataStorage getFinalData() const;
+
+  /** @brief Get the dotgraph, if not recorded an empty string is returned */
+  std::string getDotgraph() const;
+
+  /** @brief Get the uuids of the nodes which have a recorded node info */
+  std::vector<boost::uuids::uuid> getNodeUUIDs() const;
+
+  /**
+   * @brief Get a node info
+   * @param uuid The node uuid
+   * @return The node info, nullptr if not recorded
+   */
+  std::unique_ptr<TaskComposerNodeInfo> getNodeInfo(const boost::uuids::uuid& uuid) const;
+
+  /** @brief Load all recorded node infos */
+  TaskComposerNodeInfoContainer getNodeInfos() const;
+
+  /**
+   * @brief Get the data associated with a node's input keys when it started
+   * @param uuid The node uuid
+   * @return The inputs, if not recorded an empty data storage is returned
+   */
+  TaskComposerDataStorage getNodeInputs(const boost::uuids::uuid& uuid) const;
+
+  /**
+   * @brief Get the data associated with a node's output keys when it finished
+   * @param uuid The node uuid
+   * @return The outputs, if not recorded an empty data storage is returned
+   */
+  TaskComposerDataStorage getNodeOutputs(const boost::uuids::uuid& uuid) const;
+
+private:
+  std::string filepath_;
+  std::unique_ptr<boost::iostreams::mapped_file_source> file_;
+  TaskComposerLogCompression compression_{ TaskComposerLogCompression::NONE };
+  bool complete_{ false };
+  std::vector<TaskComposerLogChunkEntry> index_;
+
+  /** @brief Find the last chunk of the provided type and uuid */
+  const TaskComposerLogChunkEntry* findChunk(TaskComposerLogChunkType type, const boost::uuids::uuid& uuid) const;
+
+  /** @brief Get the decompressed payload of a chunk */
+  std::string readChunk(const TaskComposerLogChunkEntry& entry) const;
+
+  /** @brief Deserialize a data storage chunk */
+  TaskComposerDataStorage readDataStorage(TaskComposerLogChunkType type, const boost::uuids::uuid& uuid) const;
+
+  void readIndex();
+  void scanChunks();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_READER_H
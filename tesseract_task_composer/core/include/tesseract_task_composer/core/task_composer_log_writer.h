@@ -0,0 +1,224 @@
+/**
+ * @file task_composer_log_writer.h
+ * @brief A streaming, chunked task composer log writer
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_WRITER_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_WRITER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <fstream>
+#include <functional>
+#include <condition_variable>
+#include <boost/uuid/uuid.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+class TaskComposerContext;
+class TaskComposerDataStorage;
+class TaskComposerKeys;
+class TaskComposerNode;
+class TaskComposerNodeInfo;
+
+/** @brief The chunk types stored in a streaming task composer log (.tcls) */
+enum class TaskComposerLogChunkType : std::uint8_t
+{
+  DESCRIPTION = 0,
+  INITIAL_DATA = 1,
+  NODE_INPUTS = 2,
+  NODE_OUTPUTS = 3,
+  NODE_INFO = 4,
+  FINAL_DATA = 5,
+  DOTGRAPH = 6
+};
+
+/** @brief The compression applied to each chunk payload */
+enum class TaskComposerLogCompression : std::uint8_t
+{
+  NONE = 0,
+  ZLIB = 1
+};
+
+/** @brief An entry in the index stored at the end of a streaming task composer log */
+struct TaskComposerLogChunkEntry
+{
+  /** @brief The chunk type */
+  TaskComposerLogChunkType type{ TaskComposerLogChunkType::DESCRIPTION };
+
+  /** @brief The node uuid the chunk belongs to, nil if it is not associated with a node */
+  boost::uuids::uuid uuid{};
+
+  /** @brief The offset of the payload from the start of the file */
+  std::uint64_t offset{ 0 };
+
+  /** @brief The size of the payload as stored in the file */
+  std::uint64_t stored_size{ 0 };
+
+  /** @brief The size of the payload after decompression */
+  std::uint64_t raw_size{ 0 };
+};
+
+/**
+ * @brief A streaming task composer log writer
+ * @details Unlike TaskComposerLog which serializes everything in one shot, this records data storage snapshots
+ * incrementally as tasks complete. The caller only copies the data associated with a node's ports, serialization,
+ * compression and file IO are performed on a background thread.
+ *
+ * The file is a sequence of independent chunks followed by an index, so the TaskComposerLogReader can open a single
+ * task's inputs and outputs without deserializing the whole file. If the process is terminated before close() is
+ * called the index is missing, but the reader is still able to recover the chunks by scanning the file.
+ *
+ * Assign the writer to TaskComposerContext::log_writer, or pass it to TaskComposerExecutor::run, to have each task
+ * record its inputs when started and its outputs and node info when finished.
+ */
+class TaskComposerLogWriter
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerLogWriter>;
+  using ConstPtr = std::shared_ptr<const TaskComposerLogWriter>;
+  using UPtr = std::unique_ptr<TaskComposerLogWriter>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerLogWriter>;
+
+  /** @brief The file magic at the start of a streaming log */
+  static const std::array<char, 4> FILE_MAGIC;
+
+  /** @brief The magic at the end of the index of a streaming log */
+  static const std::array<char, 4> INDEX_MAGIC;
+
+  /** @brief The file format version */
+  static constexpr std::uint16_t FORMAT_VERSION{ 1 };
+
+  /**
+   * @brief Open a new streaming log
+   * @param filepath The file to write, it is truncated if it exists
+   * @param description The log description
+   * @param compression The compression applied to each chunk
+   * @param max_pending The maximum number of chunks waiting to be written before the caller is blocked
+   */
+  TaskComposerLogWriter(const std::string& filepath,
+                        const std::string& description = "",
+                        TaskComposerLogCompression compression = TaskComposerLogCompression::ZLIB,
+                        std::size_t max_pending = 256);
+  ~TaskComposerLogWriter();
+  TaskComposerLogWriter(const TaskComposerLogWriter&) = delete;
+  TaskComposerLogWriter& operator=(const TaskComposerLogWriter&) = delete;
+  TaskComposerLogWriter(TaskComposerLogWriter&&) = delete;
+  TaskComposerLogWriter& operator=(TaskComposerLogWriter&&) = delete;
+
+  /**
+   * @brief Record the data storage provided to the executor
+   * @param data_storage The initial data storage
+   */
+  void writeInitialData(const TaskComposerDataStorage& data_storage);
+
+  /**
+   * @brief Record the data associated with a node's input keys
+   * @details This is called by TaskComposerNode::run before the node is executed
+   * @param node The node about to run
+   * @param data_storage The data storage to extract the inputs from
+   */
+  void writeNodeInputs(const TaskComposerNode& node, const TaskComposerDataStorage& data_storage);
+
+  /**
+   * @brief Record the data associated with a node's output keys
+   * @details This is called by TaskComposerNode::run after the node is executed
+   * @param node The node which finished
+   * @param data_storage The data storage to extract the outputs from
+   */
+  void writeNodeOutputs(const TaskComposerNode& node, const TaskComposerDataStorage& data_storage);
+
+  /**
+   * @brief Record a node's info
+   * @param info The node info
+   */
+  void writeNodeInfo(const TaskComposerNodeInfo& info);
+
+  /**
+   * @brief Record the remaining node infos, the final data storage and the dotgraph
+   * @details Node infos which were already recorded are skipped
+   * @param context The context once execution has finished
+   * @param include_final_data Indicate if the final data storage should be recorded
+   * @param dotgraph The dotgraph, if empty it is not recorded
+   */
+  void writeContext(const TaskComposerContext& context,
+                    bool include_final_data = true,
+                    const std::string& dotgraph = "");
+
+  /**
+   * @brief Flush all pending chunks, write the index and close the file
+   * @details This is called by the destructor if not called explicitly
+   */
+  void close();
+
+  /** @brief Check if the writer is open */
+  bool isOpen() const;
+
+  /** @brief Get the file path */
+  const std::string& getFilePath() const;
+
+private:
+  /** @brief A chunk waiting on the background thread */
+  struct PendingChunk
+  {
+    TaskComposerLogChunkType type;
+    boost::uuids::uuid uuid;
+    std::function<void(std::ostream& os)> serialize;
+  };
+
+  std::string filepath_;
+  TaskComposerLogCompression compression_;
+  std::size_t max_pending_;
+  std::ofstream file_;
+  std::vector<TaskComposerLogChunkEntry> index_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable queue_cv_;
+  std::condition_variable space_cv_;
+  std::deque<PendingChunk> queue_;
+  std::set<boost::uuids::uuid> recorded_infos_;
+  bool closing_{ false };
+  bool closed_{ false };
+  std::thread worker_;
+
+  void push(PendingChunk chunk);
+  void process();
+  void writeChunk(const PendingChunk& chunk);
+
+  /** @brief Copy the data assigned to the provided keys */
+  static std::shared_ptr<TaskComposerDataStorage> extractData(const TaskComposerKeys& keys,
+                                                              const TaskComposerDataStorage& data_storage);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_LOG_WRITER_H
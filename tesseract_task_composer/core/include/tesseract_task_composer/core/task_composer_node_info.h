@@ -128,6 +128,12 @@ public:
    */
   double elapsed_time{ 0 };
 
+  /**
+   * @brief The hash of the id of the thread which ran the node
+   * @details This is assigned when constructed from a node, which is done by the thread running it
+   */
+  std::size_t thread_id{ 0 };
+
   /** @brief The DOT Graph color to fill with */
   std::string color{ "red" };
 
@@ -35,6 +35,17 @@ enum class TaskComposerNodeType
   PIPELINE,
   GRAPH
 };
+
+/**
+ * @brief The priority class of a request submitted to an executor
+ * @details Executors may use it to route requests to separate worker pools and to apply admission limits per class
+ */
+enum class TaskComposerPriority
+{
+  LOW,
+  NORMAL,
+  HIGH
+};
 }
 
 #endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_NODE_TYPES_H
@@ -0,0 +1,142 @@
+/**
+ * @file task_composer_output_channel.h
+ * @brief An ordered channel for publishing partial results while a task is still running
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_OUTPUT_CHANNEL_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_OUTPUT_CHANNEL_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/export.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/any_poly.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief An ordered, thread safe channel for publishing partial results while a task is still running
+ * @details Producers publish data with its index in the output sequence and may do so in any order from any thread.
+ * Data is delivered strictly in index order, starting at zero, as soon as every lower index has been published. It is
+ * either passed to the callback, on the thread whose publish completed the sequence, or queued to be retrieved with
+ * pop(). The producer closes the channel when it is done, which also happens when it fails part way through.
+ *
+ * The channel is provided to a task through the data storage, like the profile dictionary.
+ */
+class TaskComposerOutputChannel
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerOutputChannel>;
+  using ConstPtr = std::shared_ptr<const TaskComposerOutputChannel>;
+  using UPtr = std::unique_ptr<TaskComposerOutputChannel>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerOutputChannel>;
+
+  /** @brief The callback invoked in order for each published entry */
+  using Callback = std::function<void(std::size_t index, const tesseract_common::AnyPoly& data)>;
+
+  /** @brief Create a channel which queues entries to be retrieved with pop(), required for serialization */
+  TaskComposerOutputChannel() = default;
+
+  /**
+   * @brief Create a channel which passes entries to a callback
+   * @details Entries are not queued, so pop() only returns once the channel is closed
+   * @note The callback must not publish to this channel
+   */
+  explicit TaskComposerOutputChannel(Callback callback);
+
+  ~TaskComposerOutputChannel() = default;
+  TaskComposerOutputChannel(const TaskComposerOutputChannel&) = delete;
+  TaskComposerOutputChannel& operator=(const TaskComposerOutputChannel&) = delete;
+  TaskComposerOutputChannel(TaskComposerOutputChannel&&) = delete;
+  TaskComposerOutputChannel& operator=(TaskComposerOutputChannel&&) = delete;
+
+  /**
+   * @brief Publish an entry
+   * @details An entry published for an index which was already published or after the channel was closed is ignored
+   * @param index The index of the entry in the output sequence
+   * @param data The data
+   */
+  void publish(std::size_t index, tesseract_common::AnyPoly data);
+
+  /**
+   * @brief Close the channel
+   * @details Entries which are waiting on a lower index which was never published are discarded
+   */
+  void close();
+
+  /** @brief Check if the channel is closed */
+  bool isClosed() const;
+
+  /** @brief The number of entries delivered, which is the index of the next entry to deliver */
+  std::size_t getDeliveredCount() const;
+
+  /**
+   * @brief Wait for the next entry in order
+   * @return The entry, or an empty optional if the channel was closed and no entries remain
+   */
+  std::optional<tesseract_common::AnyPoly> pop();
+
+  /**
+   * @brief Wait for the next entry in order for a given duration
+   * @return The entry, or an empty optional if it timed out or the channel was closed and no entries remain
+   */
+  std::optional<tesseract_common::AnyPoly> popFor(const std::chrono::duration<double>& duration);
+
+  /** @brief Get the next entry in order if it is available without waiting */
+  std::optional<tesseract_common::AnyPoly> tryPop();
+
+private:
+  Callback callback_;
+
+  /** @brief Serializes the delivery to the callback so entries are never delivered out of order */
+  std::mutex delivery_mutex_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool closed_{ false };
+  std::size_t next_index_{ 0 };
+  std::map<std::size_t, tesseract_common::AnyPoly> pending_;
+  std::deque<tesseract_common::AnyPoly> ready_;
+
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+}  // namespace tesseract_planning
+
+BOOST_CLASS_EXPORT_KEY(tesseract_planning::TaskComposerOutputChannel)
+TESSERACT_ANY_EXPORT_KEY(std::shared_ptr<tesseract_planning::TaskComposerOutputChannel>,
+                         TesseractPlanningTaskComposerOutputChannelSharedPtr)
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_OUTPUT_CHANNEL_H
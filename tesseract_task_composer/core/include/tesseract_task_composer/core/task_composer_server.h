@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/fwd.h>
 #include <tesseract_common/filesystem.h>
+#include <tesseract_task_composer/core/task_composer_node_types.h>
 
 namespace YAML
 {
@@ -48,6 +49,7 @@ class TaskComposerFuture;
 class TaskComposerDataStorage;
 class TaskComposerPluginFactory;
 struct TaskComposerProblem;
+struct TaskComposerExecutorMetrics;
 
 class TaskComposerServer
 {
@@ -134,12 +136,14 @@ public:
    * @param data_storage The data storage
    * @param dotgraph Indicate if dotgraph should be generated
    * @param excutor_name The name of the executor to use
+   * @param priority The priority class of the request
    * @return The future associated with execution
    */
   std::unique_ptr<TaskComposerFuture> run(const std::string& task_name,
                                           std::shared_ptr<TaskComposerDataStorage> data_storage,
                                           bool dotgraph,
-                                          const std::string& executor_name);
+                                          const std::string& executor_name,
+                                          TaskComposerPriority priority = TaskComposerPriority::NORMAL);
 
   /**
    * @brief Execute the provided node
@@ -148,12 +152,14 @@ public:
    * @param data_storage The data storage
    * @param dotgraph Indicate if dotgraph should be generated
    * @param excutor_name The name of the executor to use
+   * @param priority The priority class of the request
    * @return The future associated with execution
    */
   std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
                                           std::shared_ptr<TaskComposerDataStorage> data_storage,
                                           bool dotgraph,
-                                          const std::string& executor_name);
+                                          const std::string& executor_name,
+                                          TaskComposerPriority priority = TaskComposerPriority::NORMAL);
 
   /** @brief Queries the number of workers (example: number of threads) */
   long getWorkerCount(const std::string& name) const;
@@ -161,6 +167,9 @@ public:
   /** @brief Queries the number of running tasks at the time of this call */
   long getTaskCount(const std::string& name) const;
 
+  /** @brief Queries the admission and timing metrics of a priority class of an executor */
+  TaskComposerExecutorMetrics getMetrics(const std::string& name, TaskComposerPriority priority) const;
+
 protected:
   std::shared_ptr<TaskComposerPluginFactory> plugin_factory_;
   std::unordered_map<std::string, std::shared_ptr<TaskComposerExecutor>> executors_;
@@ -0,0 +1,168 @@
+/**
+ * @file task_composer_trace_writer.h
+ * @brief Export task composer execution as Chrome trace events
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_TRACE_WRITER_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_TRACE_WRITER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <boost/uuid/uuid.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+class TaskComposerNodeInfo;
+class TaskComposerNodeInfoContainer;
+
+/**
+ * @brief Writes task composer node infos as Chrome trace event JSON which can be opened with chrome://tracing or
+ * Perfetto
+ * @details Each node is a complete event on the worker thread which ran it and each edge between two nodes is a flow
+ * arrow from the parent node to the child node. A graph or pipeline event spans the time its thread waited on the
+ * children, so the nodes run by that thread in the meantime are nested under it. Numeric entries of a node info's data
+ * storage, for example the number of waypoints in and out of a planner, are added to the event arguments and emitted
+ * as counter events.
+ *
+ * The writer can be used offline with toTrace() on the infos of a finished context, or live by assigning it to
+ * TaskComposerContext::trace_writer in which case events are recorded as each node finishes. Events are formatted
+ * before the lock is taken and buffered, the buffer is written to the stream when it is full, when the flush interval
+ * has passed since the last write, on flush() and on close(). The output is a JSON array which is only closed by
+ * close(), both viewers accept a file without the closing bracket if the process is terminated, in which case the
+ * events of the last flush interval may be missing.
+ */
+class TaskComposerTraceWriter
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerTraceWriter>;
+  using ConstPtr = std::shared_ptr<const TaskComposerTraceWriter>;
+  using UPtr = std::unique_ptr<TaskComposerTraceWriter>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerTraceWriter>;
+
+  /**
+   * @brief Stream trace events to an output stream
+   * @param os The output stream, it must outlive the writer
+   * @param origin The time mapped to zero in the trace
+   */
+  TaskComposerTraceWriter(std::ostream& os,
+                          std::chrono::system_clock::time_point origin = std::chrono::system_clock::now());
+
+  /**
+   * @brief Stream trace events to a file
+   * @param filepath The file to write, it is truncated if it exists
+   * @param origin The time mapped to zero in the trace
+   */
+  TaskComposerTraceWriter(const std::string& filepath,
+                          std::chrono::system_clock::time_point origin = std::chrono::system_clock::now());
+  ~TaskComposerTraceWriter();
+  TaskComposerTraceWriter(const TaskComposerTraceWriter&) = delete;
+  TaskComposerTraceWriter& operator=(const TaskComposerTraceWriter&) = delete;
+  TaskComposerTraceWriter(TaskComposerTraceWriter&&) = delete;
+  TaskComposerTraceWriter& operator=(TaskComposerTraceWriter&&) = delete;
+
+  /**
+   * @brief Write the events of a finished node
+   * @details This is called as each node finishes when assigned to the context. Flow arrows are written for the
+   * inbound edges from nodes which have already been written, which is always the case for live execution.
+   * @param info The node info
+   */
+  void writeNodeInfo(const TaskComposerNodeInfo& info);
+
+  /**
+   * @brief Write every node of a container in order of start time
+   * @param container The node infos of a finished execution
+   */
+  void writeNodeInfos(const TaskComposerNodeInfoContainer& container);
+
+  /** @brief Write the buffered events to the stream */
+  void flush();
+
+  /**
+   * @brief Set the longest time events are buffered before they are written to the stream
+   * @param interval The flush interval, zero writes the events of every node as it finishes. The default is one second.
+   */
+  void setFlushInterval(std::chrono::milliseconds interval);
+
+  /** @brief Close the JSON array, this is called by the destructor if not called explicitly */
+  void close();
+
+  /**
+   * @brief Convert the node infos of a finished execution to Chrome trace event JSON
+   * @param os The output stream
+   * @param container The node infos
+   */
+  static void toTrace(std::ostream& os, const TaskComposerNodeInfoContainer& container);
+
+  /**
+   * @brief Save the node infos of a finished execution as a Chrome trace event JSON file
+   * @param filepath The file to write
+   * @param container The node infos
+   * @return True if successful, otherwise false
+   */
+  static bool saveTrace(const std::string& filepath, const TaskComposerNodeInfoContainer& container);
+
+private:
+  /** @brief The slice of a node which has been written, used to bind the start of flow arrows */
+  struct WrittenNode
+  {
+    double start{ 0 };
+    int tid{ 0 };
+  };
+
+  std::unique_ptr<std::ostream> file_;
+  std::ostream* os_;
+  std::chrono::system_clock::time_point origin_;
+
+  std::mutex mutex_;
+  bool first_event_{ true };
+  bool closed_{ false };
+  std::size_t flow_id_{ 0 };
+  std::map<std::size_t, int> thread_ids_;
+  std::map<boost::uuids::uuid, WrittenNode> written_nodes_;
+  std::string buffer_;
+  std::chrono::milliseconds flush_interval_{ 1000 };
+  std::chrono::steady_clock::time_point last_flush_{ std::chrono::steady_clock::now() };
+
+  /** @brief Map a thread id hash to a small sequential trace thread id, writing the thread name when first seen */
+  int getThreadId(std::size_t thread_id);
+
+  /** @brief Convert a time point to microseconds since the origin */
+  double toMicroseconds(std::chrono::system_clock::time_point time) const;
+
+  /** @brief Append an event to the buffer, the mutex must be locked */
+  void writeEvent(const std::string& event);
+
+  /** @brief Write the buffer to the stream, the mutex must be locked */
+  void flushBuffer();
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_TRACE_WRITER_H
@@ -74,9 +74,39 @@ void runTaskComposerExecutorTest()
     EXPECT_EQ(future->context->task_infos.getInfoMap().size(), 1);
     EXPECT_TRUE(future->context->task_infos.getAbortingNode().is_nil());
 
+    // Callback registered after completion is invoked immediately
+    bool called{ false };
+    future->then([&called](const std::shared_ptr<TaskComposerContext>& context) { called = context->isSuccessful(); });
+    EXPECT_TRUE(called);
+
     future->clear();
     EXPECT_FALSE(future->valid());
 
+    // Callbacks are invoked by the executor without waiting on the future
+    std::promise<bool> promise;
+    std::future<bool> callback_result = promise.get_future();
+    auto callback_future = executor->run(*task, std::make_unique<TaskComposerDataStorage>());
+    callback_future->then([&promise](const std::shared_ptr<TaskComposerContext>& context) {
+      promise.set_value(context->isSuccessful());
+    });
+    EXPECT_EQ(callback_result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_TRUE(callback_result.get());
+    callback_future->wait();
+
+    // Priority classes
+    auto priority_future =
+        executor->run(*task, std::make_unique<TaskComposerDataStorage>(), TaskComposerPriority::HIGH);
+    priority_future->wait();
+    EXPECT_EQ(priority_future->context->priority, TaskComposerPriority::HIGH);
+    EXPECT_TRUE(priority_future->context->isSuccessful());
+    TaskComposerExecutorMetrics metrics = executor->getMetrics(TaskComposerPriority::HIGH);
+    EXPECT_EQ(metrics.admitted, 1);
+    EXPECT_EQ(metrics.completed, 1);
+    EXPECT_EQ(metrics.rejected, 0);
+    EXPECT_GE(metrics.queue_wait_time, 0);
+    EXPECT_GE(metrics.execution_time, 0);
+    EXPECT_GE(metrics.max_execution_time, 0);
+
     // Serialization
     test_suite::runSerializationPointerTest(executor, "TaskComposerExecutorTests");
   }
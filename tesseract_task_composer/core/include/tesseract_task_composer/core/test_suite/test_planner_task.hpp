@@ -0,0 +1,184 @@
+/**
+ * @file test_planner_task.hpp
+ * @brief A configurable stand in for a motion planner task
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TEST_PLANNER_TASK_HPP
+#define TESSERACT_TASK_COMPOSER_TEST_PLANNER_TASK_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_task.h>
+#include <tesseract_command_language/composite_instruction.h>
+
+namespace tesseract_planning::test_suite
+{
+/**
+ * @brief A stand in for a motion planner which copies the program from its input to its output
+ * @details The task spends the configured delay planning, stopping early if the context is aborted, and then passes
+ * the program to the optional plan function which may modify it or fail.
+ */
+class TestPlannerTask : public TaskComposerTask
+{
+public:
+  /** @brief Modifies the program being planned, returns false if planning failed */
+  using PlanFn = std::function<bool(const TaskComposerContext& context, CompositeInstruction& program)>;
+
+  TestPlannerTask(std::string name, std::string input_key, std::string output_key, bool conditional = true)
+    : TaskComposerTask(std::move(name), TestPlannerTask::ports(), conditional)
+  {
+    input_keys_.add("program", std::move(input_key));
+    output_keys_.add("program", std::move(output_key));
+    validatePorts();
+  }
+
+  /** @brief The time spent planning */
+  std::chrono::milliseconds delay{ 0 };
+
+  /** @brief Called with the program after the delay, if not set the program is copied unchanged */
+  PlanFn plan;
+
+  /** @brief Abort the context when planning fails, like a pipeline with an abort terminal */
+  bool abort_on_failure{ false };
+
+  /** @brief If set, it is set true when the task observes an abort of the context during its delay */
+  std::shared_ptr<std::atomic<bool>> observed_abort;
+
+  /** @brief If set, the number of tasks currently planning */
+  std::shared_ptr<std::atomic<int>> running;
+
+  /** @brief If set, the largest number of tasks planning at the same time */
+  std::shared_ptr<std::atomic<int>> peak_running;
+
+  /**
+   * @brief Wait until the context is aborted or the timeout expires
+   * @return True if the context was aborted
+   */
+  static bool waitForAbort(const TaskComposerContext& context, std::chrono::milliseconds timeout)
+  {
+    const auto end = std::chrono::steady_clock::now() + timeout;
+    while (!context.isAborted() && std::chrono::steady_clock::now() < end)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    return context.isAborted();
+  }
+
+protected:
+  static TaskComposerNodePorts ports()
+  {
+    TaskComposerNodePorts ports;
+    ports.input_required["program"] = TaskComposerNodePorts::SINGLE;
+    ports.output_required["program"] = TaskComposerNodePorts::SINGLE;
+    return ports;
+  }
+
+  std::unique_ptr<TaskComposerNodeInfo> runImpl(TaskComposerContext& context,
+                                                OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->return_value = 0;
+
+    if (running != nullptr)
+    {
+      const int current = ++(*running);
+      if (peak_running != nullptr)
+      {
+        int peak = peak_running->load();
+        while (current > peak && !peak_running->compare_exchange_weak(peak, current))
+        {
+        }
+      }
+    }
+
+    const bool aborted = (delay.count() > 0) && waitForAbort(context, delay);
+
+    if (running != nullptr)
+      --(*running);
+
+    if (aborted)
+    {
+      if (observed_abort != nullptr)
+        *observed_abort = true;
+
+      info->status_message = "Aborted";
+      return info;
+    }
+
+    auto program = getData(*context.data_storage, "program").as<CompositeInstruction>();
+    if (plan && !plan(context, program))
+    {
+      info->status_message = "Failed";
+      if (abort_on_failure)
+        context.abort(uuid_);
+
+      return info;
+    }
+
+    setData(*context.data_storage, "program", program);
+    info->return_value = 1;
+    info->status_message = "Successful";
+    return info;
+  }
+};
+
+/**
+ * @brief Create a factory of TestPlannerTask for tasks which create their child tasks, like the RacePlannerTask
+ * @param configure If set, called to configure the task created for each index
+ * @param indexing If empty every task uses the keys 'input_data' and 'output_data', otherwise the keys are prefixed
+ * with it and suffixed with the index so every task has its own keys
+ */
+template <typename TaskFactoryResults>
+std::function<TaskFactoryResults(const std::string&, std::size_t)>
+createTestPlannerTaskFactory(std::function<void(TestPlannerTask&, std::size_t)> configure = nullptr,
+                             std::string indexing = "")
+{
+  return [configure = std::move(configure), indexing = std::move(indexing)](const std::string& name,
+                                                                             std::size_t index) {
+    const std::string prefix = indexing.empty() ? "" : indexing + "_";
+    const std::string suffix = indexing.empty() ? "" : "_" + std::to_string(index);
+    auto task =
+        std::make_unique<TestPlannerTask>(name, prefix + "input_data" + suffix, prefix + "output_data" + suffix);
+    if (configure)
+      configure(*task, index);
+
+    TaskFactoryResults tf_results;
+    tf_results.input_key = task->getInputKeys().get("program");
+    tf_results.output_key = task->getOutputKeys().get("program");
+    tf_results.node = std::move(task);
+    return tf_results;
+  };
+}
+}  // namespace tesseract_planning::test_suite
+
+#endif  // TESSERACT_TASK_COMPOSER_TEST_PLANNER_TASK_HPP
@@ -42,7 +42,19 @@ const std::string RemapTask::INOUT_KEYS_PORT = "keys";
 
 RemapTask::RemapTask() : TaskComposerTask("RemapTask", RemapTask::ports(), false) {}
 RemapTask::RemapTask(std::string name, const std::map<std::string, std::string>& remap, bool copy, bool is_conditional)
-  : TaskComposerTask(std::move(name), RemapTask::ports(), is_conditional), copy_(copy)
+  : RemapTask(std::move(name),
+              remap,
+              (copy) ? TaskComposerDataStorage::RemapMode::COPY : TaskComposerDataStorage::RemapMode::MOVE,
+              is_conditional)
+{
+}
+RemapTask::RemapTask(std::string name,
+                     const std::map<std::string, std::string>& remap,
+                     TaskComposerDataStorage::RemapMode mode,
+                     bool is_conditional)
+  : TaskComposerTask(std::move(name), RemapTask::ports(), is_conditional)
+  , copy_(mode == TaskComposerDataStorage::RemapMode::COPY)
+  , alias_(mode == TaskComposerDataStorage::RemapMode::ALIAS)
 {
   if (remap.empty())
     throw std::runtime_error("RemapTask, remap should not be empty!");
@@ -70,6 +82,12 @@ RemapTask::RemapTask(std::string name, const YAML::Node& config, const TaskCompo
 
   if (YAML::Node n = config["copy"])
     copy_ = n.as<bool>();
+
+  if (YAML::Node n = config["alias"])
+    alias_ = n.as<bool>();
+
+  if (copy_ && alias_)
+    throw std::runtime_error("RemapTask, 'copy' and 'alias' can not both be enabled");
 }
 
 TaskComposerNodePorts RemapTask::ports()
@@ -90,7 +108,13 @@ std::unique_ptr<TaskComposerNodeInfo> RemapTask::runImpl(TaskComposerContext& co
   for (std::size_t i = 0; i < ikeys.size(); ++i)
     remapping[ikeys[i]] = okeys[i];
 
-  if (context.data_storage->remapData(remapping, copy_))
+  TaskComposerDataStorage::RemapMode mode{ TaskComposerDataStorage::RemapMode::MOVE };
+  if (alias_)
+    mode = TaskComposerDataStorage::RemapMode::ALIAS;
+  else if (copy_)
+    mode = TaskComposerDataStorage::RemapMode::COPY;
+
+  if (context.data_storage->remapData(remapping, mode))
   {
     info->color = "green";
     info->return_value = 1;
@@ -111,6 +135,7 @@ bool RemapTask::operator==(const RemapTask& rhs) const
 {
   bool equal = true;
   equal &= (copy_ == rhs.copy_);
+  equal &= (alias_ == rhs.alias_);
   equal &= TaskComposerTask::operator==(rhs);
   return equal;
 }
@@ -121,6 +146,7 @@ void RemapTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerTask);
   ar& boost::serialization::make_nvp("copy", copy_);
+  ar& boost::serialization::make_nvp("alias", alias_);
 }
 
 }  // namespace tesseract_planning
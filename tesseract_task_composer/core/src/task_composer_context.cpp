@@ -69,6 +69,7 @@ bool TaskComposerContext::operator==(const TaskComposerContext& rhs) const
   bool equal = true;
   equal &= name == rhs.name;
   equal &= dotgraph == rhs.dotgraph;
+  equal &= priority == rhs.priority;
 
   if (data_storage != nullptr && rhs.data_storage != nullptr)
     equal &= (*data_storage == *rhs.data_storage);
@@ -87,6 +88,7 @@ void TaskComposerContext::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& boost::serialization::make_nvp("name", name);
   ar& boost::serialization::make_nvp("dotgraph", dotgraph);
+  ar& boost::serialization::make_nvp("priority", priority);
   ar& boost::serialization::make_nvp("data_storage", data_storage);
   ar& boost::serialization::make_nvp("task_infos", task_infos);
   ar& boost::serialization::make_nvp("aborted", aborted_);
@@ -31,57 +31,77 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/library_version_type.hpp>
 #endif
 #include <boost/serialization/unordered_map.hpp>
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 #include <console_bridge/console.h>
 #include <tesseract_common/serialization.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_keys.h>
+
+namespace
+{
+/** @brief Merge the sorted chunk indices of two storages */
+std::vector<std::size_t> mergeChunkIndices(const std::vector<std::size_t>& lhs, const std::vector<std::size_t>& rhs)
+{
+  std::vector<std::size_t> indices;
+  indices.reserve(lhs.size() + rhs.size());
+  std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(indices));
+  return indices;
+}
+}  // namespace
+
 namespace tesseract_planning
 {
-// NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
-TaskComposerDataStorage::TaskComposerDataStorage(const TaskComposerDataStorage& other)
+struct TaskComposerDataStorage::Slot
 {
-  std::unique_lock lhs_lock(mutex_, std::defer_lock);
-  std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
-  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  mutable std::shared_mutex mutex;
 
-  name_ = other.name_;  // NOLINT(cppcoreguidelines-prefer-member-initializer)
-  data_ = other.data_;  // NOLINT(cppcoreguidelines-prefer-member-initializer)
-}
+  /** @brief The immutable payload, a nullptr if the slot has no data */
+  std::shared_ptr<const tesseract_common::AnyPoly> data;
+};
+
+struct TaskComposerDataStorage::Chunk
+{
+  std::array<Slot, CHUNK_SIZE> slots;
+};
+
+TaskComposerDataStorage::TaskComposerDataStorage() = default;
+
+TaskComposerDataStorage::~TaskComposerDataStorage() { clear(); }
+
+TaskComposerDataStorage::TaskComposerDataStorage(const TaskComposerDataStorage& other) { copyFrom(other); }
 
-// NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
 TaskComposerDataStorage& TaskComposerDataStorage::operator=(const TaskComposerDataStorage& other)
 {
-  std::unique_lock lhs_lock(mutex_, std::defer_lock);
-  std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
-  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  if (this != &other)
+    copyFrom(other);
 
-  name_ = other.name_;  // NOLINT(cppcoreguidelines-prefer-member-initializer)
-  data_ = other.data_;  // NOLINT(cppcoreguidelines-prefer-member-initializer)
   return *this;
 }
 
-// NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
 TaskComposerDataStorage::TaskComposerDataStorage(TaskComposerDataStorage&& other) noexcept
 {
-  std::unique_lock lhs_lock(mutex_, std::defer_lock);
-  std::unique_lock rhs_lock(other.mutex_, std::defer_lock);
-  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  {
+    std::unique_lock lock(other.mutex_);
+    name_ = std::move(other.name_);
+  }
 
-  name_ = std::move(other.name_);  // NOLINT(cppcoreguidelines-prefer-member-initializer)
-  data_ = std::move(other.data_);  // NOLINT(cppcoreguidelines-prefer-member-initializer)
+  // Nothing else can access this object yet so the chunks can be taken
+  for (std::size_t i = 0; i < DIRECT_CHUNKS; ++i)
+    chunks_[i].store(other.chunks_[i].exchange(nullptr, std::memory_order_acq_rel), std::memory_order_release);
+
+  std::unique_lock lock(other.overflow_mutex_);
+  overflow_chunks_.swap(other.overflow_chunks_);
 }
 
-// NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
 TaskComposerDataStorage& TaskComposerDataStorage::operator=(TaskComposerDataStorage&& other) noexcept
 {
-  std::unique_lock lhs_lock(mutex_, std::defer_lock);
-  std::unique_lock rhs_lock(other.mutex_, std::defer_lock);
-  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  if (this != &other)
+    moveFrom(other);
 
-  name_ = std::move(other.name_);  // NOLINT(cppcoreguidelines-prefer-member-initializer)
-  data_ = std::move(other.data_);  // NOLINT(cppcoreguidelines-prefer-member-initializer)
   return *this;
 }
 
@@ -99,96 +119,306 @@ void TaskComposerDataStorage::setName(const std::string& name)
 
 bool TaskComposerDataStorage::hasKey(const std::string& key) const
 {
-  std::shared_lock lock(mutex_);
-  return (data_.find(key) != data_.end());
+  auto slot = TaskComposerKeys::findSlot(key);
+  return (slot.has_value() && hasKey(slot.value()));
 }
 
 void TaskComposerDataStorage::setData(const std::string& key, tesseract_common::AnyPoly data)
 {
-  std::unique_lock lock(mutex_);
-  data_[key] = std::move(data);
+  setData(TaskComposerKeys::intern(key), std::move(data));
 }
 
 tesseract_common::AnyPoly TaskComposerDataStorage::getData(const std::string& key) const
 {
-  std::shared_lock lock(mutex_);
-  auto it = data_.find(key);
-  if (it == data_.end())
+  auto slot = TaskComposerKeys::findSlot(key);
+  if (!slot.has_value())
     return {};
 
-  return it->second;
+  return getData(slot.value());
+}
+
+std::shared_ptr<const tesseract_common::AnyPoly> TaskComposerDataStorage::getSharedData(const std::string& key) const
+{
+  auto slot = TaskComposerKeys::findSlot(key);
+  if (!slot.has_value())
+    return nullptr;
+
+  return getSharedData(slot.value());
 }
 
 void TaskComposerDataStorage::removeData(const std::string& key)
 {
-  std::unique_lock lock(mutex_);
-  data_.erase(key);
+  auto slot = TaskComposerKeys::findSlot(key);
+  if (slot.has_value())
+    removeData(slot.value());
+}
+
+bool TaskComposerDataStorage::hasKey(std::size_t slot) const
+{
+  const Slot* s = findSlot(slot);
+  if (s == nullptr)
+    return false;
+
+  std::shared_lock lock(s->mutex);
+  return (s->data != nullptr);
+}
+
+void TaskComposerDataStorage::setData(std::size_t slot, tesseract_common::AnyPoly data)
+{
+  setPayload(slot, std::make_shared<const tesseract_common::AnyPoly>(std::move(data)));
+}
+
+tesseract_common::AnyPoly TaskComposerDataStorage::getData(std::size_t slot) const
+{
+  // The payload is immutable so it is copied outside of the lock
+  std::shared_ptr<const tesseract_common::AnyPoly> payload = getSharedData(slot);
+  if (payload == nullptr)
+    return {};
+
+  return *payload;
 }
 
+std::shared_ptr<const tesseract_common::AnyPoly> TaskComposerDataStorage::getSharedData(std::size_t slot) const
+{
+  const Slot* s = findSlot(slot);
+  if (s == nullptr)
+    return nullptr;
+
+  std::shared_lock lock(s->mutex);
+  return s->data;
+}
+
+void TaskComposerDataStorage::removeData(std::size_t slot) { setPayload(slot, nullptr); }
+
 std::unordered_map<std::string, tesseract_common::AnyPoly> TaskComposerDataStorage::getData() const
 {
-  std::shared_lock lock(mutex_);
-  return data_;
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  forEachSlot([&data](std::size_t slot, Slot& s) { data[TaskComposerKeys::getKey(slot)] = *s.data; });
+  return data;
 }
 
 bool TaskComposerDataStorage::remapData(const std::map<std::string, std::string>& remapping, bool copy)
 {
-  std::unique_lock lock(mutex_);
+  return remapData(remapping, (copy) ? RemapMode::COPY : RemapMode::MOVE);
+}
 
-  if (copy)
+bool TaskComposerDataStorage::remapData(const std::map<std::string, std::string>& remapping, RemapMode mode)
+{
+  for (const auto& pair : remapping)
   {
-    for (const auto& pair : remapping)
+    auto from = TaskComposerKeys::findSlot(pair.first);
+    Slot* s = (from.has_value()) ? findSlot(from.value()) : nullptr;
+    if (s == nullptr)
     {
-      auto it = data_.find(pair.first);
-      if (it != data_.end())
-      {
-        data_[pair.second] = it->second;
-      }
-      else
+      CONSOLE_BRIDGE_logError(
+          "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
+      return false;
+    }
+
+    const std::size_t to = TaskComposerKeys::intern(pair.second);
+    if (to == from.value())
+      continue;
+
+    std::shared_ptr<const tesseract_common::AnyPoly> payload;
+    {
+      std::unique_lock lock(s->mutex);
+      if (s->data == nullptr)
       {
         CONSOLE_BRIDGE_logError(
             "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
         return false;
       }
+
+      if (mode == RemapMode::MOVE)
+        payload = std::move(s->data);
+      else
+        payload = s->data;
+    }
+
+    // The payload is immutable so a copy is made outside of the lock, while an alias shares it
+    if (mode == RemapMode::COPY)
+      payload = std::make_shared<const tesseract_common::AnyPoly>(*payload);
+
+    setPayload(to, std::move(payload));
+  }
+
+  return true;
+}
+
+bool TaskComposerDataStorage::operator==(const TaskComposerDataStorage& rhs) const
+{
+  if (getName() != rhs.getName())
+    return false;
+
+  // Data is compared through copies so the slots of both storages are never locked at the same time
+  return (getData() == rhs.getData());
+}
+
+bool TaskComposerDataStorage::operator!=(const TaskComposerDataStorage& rhs) const { return !operator==(rhs); }
+
+TaskComposerDataStorage::Chunk* TaskComposerDataStorage::findChunk(std::size_t index) const
+{
+  if (index < DIRECT_CHUNKS)
+    return chunks_[index].load(std::memory_order_acquire);
+
+  std::shared_lock lock(overflow_mutex_);
+  auto it = overflow_chunks_.find(index);
+  return (it == overflow_chunks_.end()) ? nullptr : it->second.get();
+}
+
+TaskComposerDataStorage::Chunk& TaskComposerDataStorage::getChunk(std::size_t index)
+{
+  if (index < DIRECT_CHUNKS)
+  {
+    Chunk* chunk = chunks_[index].load(std::memory_order_acquire);
+    if (chunk == nullptr)
+    {
+      auto new_chunk = std::make_unique<Chunk>();
+      if (chunks_[index].compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel))
+        chunk = new_chunk.release();
     }
+
+    return *chunk;
   }
-  else
+
+  if (Chunk* chunk = findChunk(index))
+    return *chunk;
+
+  std::unique_lock lock(overflow_mutex_);
+  std::unique_ptr<Chunk>& chunk = overflow_chunks_[index];
+  if (chunk == nullptr)
+    chunk = std::make_unique<Chunk>();
+
+  return *chunk;
+}
+
+std::vector<std::size_t> TaskComposerDataStorage::getChunkIndices() const
+{
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < DIRECT_CHUNKS; ++i)
+  {
+    if (chunks_[i].load(std::memory_order_acquire) != nullptr)
+      indices.push_back(i);
+  }
+
+  std::shared_lock lock(overflow_mutex_);
+  for (const auto& pair : overflow_chunks_)
+    indices.push_back(pair.first);
+
+  return indices;
+}
+
+TaskComposerDataStorage::Slot* TaskComposerDataStorage::findSlot(std::size_t slot) const
+{
+  Chunk* chunk = findChunk(slot / CHUNK_SIZE);
+  if (chunk == nullptr)
+    return nullptr;
+
+  return &chunk->slots[slot % CHUNK_SIZE];
+}
+
+TaskComposerDataStorage::Slot& TaskComposerDataStorage::getSlot(std::size_t slot)
+{
+  return getChunk(slot / CHUNK_SIZE).slots[slot % CHUNK_SIZE];
+}
+
+void TaskComposerDataStorage::setPayload(std::size_t slot, std::shared_ptr<const tesseract_common::AnyPoly> payload)
+{
+  Slot* s = (payload != nullptr) ? &getSlot(slot) : findSlot(slot);
+  if (s == nullptr)
+    return;
+
+  // The previous payload is released after the lock so a large program is not destroyed while holding it
+  std::unique_lock lock(s->mutex);
+  s->data.swap(payload);
+}
+
+void TaskComposerDataStorage::forEachSlot(const std::function<void(std::size_t, Slot&)>& fn) const
+{
+  for (std::size_t i : getChunkIndices())
   {
-    for (const auto& pair : remapping)
+    Chunk* chunk = findChunk(i);
+    for (std::size_t j = 0; j < CHUNK_SIZE; ++j)
     {
-      if (auto nh = data_.extract(pair.first); !nh.empty())
+      Slot& s = chunk->slots[j];
+      std::shared_lock lock(s.mutex);
+      if (s.data != nullptr)
+        fn((i * CHUNK_SIZE) + j, s);
+    }
+  }
+}
+
+void TaskComposerDataStorage::copyFrom(const TaskComposerDataStorage& other)
+{
+  setName(other.getName());
+  for (std::size_t i : mergeChunkIndices(getChunkIndices(), other.getChunkIndices()))
+  {
+    for (std::size_t j = i * CHUNK_SIZE; j < (i + 1) * CHUNK_SIZE; ++j)
+    {
+      const Slot* s = other.findSlot(j);
+      std::shared_ptr<const tesseract_common::AnyPoly> payload;
+      if (s != nullptr)
       {
-        nh.key() = pair.second;
-        data_.insert(std::move(nh));
+        std::shared_lock lock(s->mutex);
+        payload = s->data;
       }
-      else
+
+      setPayload(j, std::move(payload));
+    }
+  }
+}
+
+void TaskComposerDataStorage::moveFrom(TaskComposerDataStorage& other)
+{
+  {
+    std::unique_lock lock(other.mutex_);
+    setName(other.name_);
+  }
+
+  for (std::size_t i : mergeChunkIndices(getChunkIndices(), other.getChunkIndices()))
+  {
+    for (std::size_t j = i * CHUNK_SIZE; j < (i + 1) * CHUNK_SIZE; ++j)
+    {
+      Slot* s = other.findSlot(j);
+      std::shared_ptr<const tesseract_common::AnyPoly> payload;
+      if (s != nullptr)
       {
-        CONSOLE_BRIDGE_logError(
-            "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
-        return false;
+        std::unique_lock lock(s->mutex);
+        payload = std::move(s->data);
       }
+
+      setPayload(j, std::move(payload));
     }
   }
-
-  return true;
 }
 
-bool TaskComposerDataStorage::operator==(const TaskComposerDataStorage& rhs) const
+void TaskComposerDataStorage::clear()
 {
-  std::shared_lock lhs_lock(mutex_, std::defer_lock);
-  std::shared_lock rhs_lock(rhs.mutex_, std::defer_lock);
-  std::scoped_lock lock{ lhs_lock, rhs_lock };
-  return ((data_ == rhs.data_) && (name_ == rhs.name_));
-}
+  for (auto& chunk : chunks_)
+    delete chunk.exchange(nullptr, std::memory_order_acq_rel);  // NOLINT(cppcoreguidelines-owning-memory)
 
-bool TaskComposerDataStorage::operator!=(const TaskComposerDataStorage& rhs) const { return !operator==(rhs); }
+  std::unique_lock lock(overflow_mutex_);
+  overflow_chunks_.clear();
+}
 
 template <class Archive>
 void TaskComposerDataStorage::serialize(Archive& ar, const unsigned int /*version*/)
 {
-  std::unique_lock lock(mutex_);
-  ar& boost::serialization::make_nvp("name", name_);
-  ar& boost::serialization::make_nvp("data", data_);
+  std::string name = getName();
+  ar& boost::serialization::make_nvp("name", name);
+
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  if (Archive::is_saving::value)
+    data = getData();
+
+  ar& boost::serialization::make_nvp("data", data);
+
+  if (Archive::is_loading::value)
+  {
+    setName(name);
+    for (auto& pair : data)
+      setData(pair.first, std::move(pair.second));
+  }
 }
 
 }  // namespace tesseract_planning
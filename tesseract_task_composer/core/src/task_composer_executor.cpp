@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_context.h>
 #include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_log_writer.h>
 #include <tesseract_task_composer/core/task_composer_node.h>
 
 namespace tesseract_planning
@@ -51,6 +52,61 @@ std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposer
   return run(node, context);
 }
 
+std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                              std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                                              TaskComposerPriority priority,
+                                                              bool dotgraph)
+{
+  auto context = std::make_shared<TaskComposerContext>(node.getName(), std::move(data_storage), dotgraph);
+  context->task_infos.setRootNode(node.getUUID());
+  context->priority = priority;
+  return run(node, context);
+}
+
+std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                              std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                                              std::shared_ptr<TaskComposerLogWriter> log_writer,
+                                                              bool dotgraph)
+{
+  if (log_writer != nullptr)
+    log_writer->writeInitialData(*data_storage);
+
+  auto context = std::make_shared<TaskComposerContext>(node.getName(), std::move(data_storage), dotgraph);
+  context->task_infos.setRootNode(node.getUUID());
+  context->log_writer = std::move(log_writer);
+  return run(node, context);
+}
+
+std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                              std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                                              std::shared_ptr<TaskComposerTraceWriter> trace_writer,
+                                                              bool dotgraph)
+{
+  auto context = std::make_shared<TaskComposerContext>(node.getName(), std::move(data_storage), dotgraph);
+  context->task_infos.setRootNode(node.getUUID());
+  context->trace_writer = std::move(trace_writer);
+  return run(node, context);
+}
+
+std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                              const TaskComposerContext& parent_context)
+{
+  return run(node, parent_context.data_storage, parent_context);
+}
+
+std::unique_ptr<TaskComposerFuture> TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                              std::shared_ptr<TaskComposerDataStorage> data_storage,
+                                                              const TaskComposerContext& parent_context)
+{
+  auto context =
+      std::make_shared<TaskComposerContext>(node.getName(), std::move(data_storage), parent_context.dotgraph);
+  context->task_infos.setRootNode(node.getUUID());
+  context->priority = parent_context.priority;
+  context->log_writer = parent_context.log_writer;
+  context->trace_writer = parent_context.trace_writer;
+  return run(node, context);
+}
+
 bool TaskComposerExecutor::operator==(const TaskComposerExecutor& rhs) const { return (name_ == rhs.name_); }
 
 // LCOV_EXCL_START
@@ -24,10 +24,65 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_context.h>
 
 namespace tesseract_planning
 {
+void TaskComposerFutureCompletion::addCallback(TaskComposerFutureCallback callback,
+                                               const std::shared_ptr<TaskComposerContext>& context)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!complete_)
+    {
+      callbacks_.push_back(std::move(callback));
+      return;
+    }
+  }
+
+  try
+  {
+    callback(context);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("TaskComposerFuture, completion callback threw exception: %s", e.what());
+  }
+}
+
+void TaskComposerFutureCompletion::complete(const std::shared_ptr<TaskComposerContext>& context)
+{
+  std::vector<TaskComposerFutureCallback> callbacks;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    complete_ = true;
+    callbacks.swap(callbacks_);
+  }
+
+  for (auto& callback : callbacks)
+  {
+    try
+    {
+      callback(context);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TaskComposerFuture, completion callback threw exception: %s", e.what());
+    }
+  }
+}
+
+bool TaskComposerFutureCompletion::isComplete() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return complete_;
+}
+
 TaskComposerFuture::TaskComposerFuture(std::shared_ptr<TaskComposerContext> context) : context(std::move(context)) {}
 }  // namespace tesseract_planning
@@ -228,7 +228,7 @@ std::unique_ptr<TaskComposerNodeInfo> TaskComposerGraph::runImpl(TaskComposerCon
   tesseract_common::Stopwatch stopwatch;
   stopwatch.start();
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(*this, context.data_storage, context.dotgraph);
+  TaskComposerFuture::UPtr future = executor.value().get().run(*this, context);
   future->wait();
 
   // Merge child context data into parent context
@@ -17,6 +17,9 @@
  */
 
 #include <tesseract_task_composer/core/task_composer_keys.h>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/unordered_map.hpp>
 #include <tesseract_common/std_variant_serialization.h>
@@ -25,9 +28,92 @@
 
 namespace tesseract_planning
 {
-void TaskComposerKeys::add(const std::string& port, std::string key) { keys_[port] = std::move(key); }
+namespace
+{
+/** @brief The process wide key to slot id table, keys are only ever added so slot ids remain valid */
+struct KeyRegistry
+{
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, std::size_t> slots;
+  std::deque<std::string> keys;
+};
+
+KeyRegistry& getKeyRegistry()
+{
+  static KeyRegistry registry;
+  return registry;
+}
+}  // namespace
+
+std::size_t TaskComposerKeys::intern(const std::string& key)
+{
+  KeyRegistry& registry = getKeyRegistry();
+  {
+    std::shared_lock lock(registry.mutex);
+    auto it = registry.slots.find(key);
+    if (it != registry.slots.end())
+      return it->second;
+  }
+
+  std::unique_lock lock(registry.mutex);
+  auto it = registry.slots.find(key);
+  if (it != registry.slots.end())
+    return it->second;
+
+  const std::size_t slot = registry.keys.size();
+  registry.keys.push_back(key);
+  registry.slots[key] = slot;
+  return slot;
+}
+
+std::optional<std::size_t> TaskComposerKeys::findSlot(const std::string& key)
+{
+  KeyRegistry& registry = getKeyRegistry();
+  std::shared_lock lock(registry.mutex);
+  auto it = registry.slots.find(key);
+  if (it == registry.slots.end())
+    return std::nullopt;
+
+  return it->second;
+}
+
+const std::string& TaskComposerKeys::getKey(std::size_t slot)
+{
+  KeyRegistry& registry = getKeyRegistry();
+  std::shared_lock lock(registry.mutex);
+  return registry.keys.at(slot);
+}
+
+void TaskComposerKeys::add(const std::string& port, std::string key)
+{
+  keys_[port] = std::move(key);
+  updateSlots(port);
+}
+
+void TaskComposerKeys::add(const std::string& port, std::vector<std::string> keys)
+{
+  keys_[port] = std::move(keys);
+  updateSlots(port);
+}
+
+void TaskComposerKeys::updateSlots(const std::string& port)
+{
+  const auto& entry = keys_.at(port);
+  if (entry.index() == 0)
+  {
+    slots_[port] = intern(std::get<std::string>(entry));
+  }
+  else
+  {
+    const auto& vs = std::get<std::vector<std::string>>(entry);
+    std::vector<std::size_t> slots;
+    slots.reserve(vs.size());
+    for (const auto& key : vs)
+      slots.push_back(intern(key));
 
-void TaskComposerKeys::add(const std::string& port, std::vector<std::string> keys) { keys_[port] = std::move(keys); }
+    slots_[port] = std::move(slots);
+  }
+}
 
 void TaskComposerKeys::rename(const std::map<std::string, std::string>& keys)
 {
@@ -49,6 +135,7 @@ void TaskComposerKeys::rename(const std::map<std::string, std::string>& keys)
           s = it->second;
       }
     }
+    updateSlots(key.first);
   }
 }
 
@@ -74,6 +161,8 @@ const std::vector<std::string>& TaskComposerKeys::get(const std::string& port) c
 
 const TaskComposerKeys::ContainerType& TaskComposerKeys::data() const { return keys_; }
 
+const TaskComposerKeys::SlotContainerType& TaskComposerKeys::slots() const { return slots_; }
+
 std::size_t TaskComposerKeys::size() const { return keys_.size(); }
 bool TaskComposerKeys::empty() const { return keys_.empty(); }
 bool TaskComposerKeys::operator==(const TaskComposerKeys& rhs) const { return (keys_ == rhs.keys_); }
@@ -83,6 +172,12 @@ template <class Archive>
 void TaskComposerKeys::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& boost::serialization::make_nvp("keys", keys_);
+  if (Archive::is_loading::value)
+  {
+    slots_.clear();
+    for (const auto& pair : keys_)
+      updateSlots(pair.first);
+  }
 }
 
 std::ostream& operator<<(std::ostream& os, const TaskComposerKeys& keys)
@@ -0,0 +1,287 @@
+/**
+ * @file task_composer_log_reader.cpp
+ * @brief A memory mapped reader for streaming task composer logs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
+#include <sstream>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/copy.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_log_reader.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief The size of the file header: magic, version, compression and a reserved byte */
+constexpr std::size_t FILE_HEADER_SIZE{ 8 };
+
+/** @brief The size of a chunk header: type, uuid, stored size and raw size */
+constexpr std::size_t CHUNK_HEADER_SIZE{ 33 };
+
+/** @brief The size of an index entry: type, uuid, offset, stored size and raw size */
+constexpr std::size_t INDEX_ENTRY_SIZE{ 41 };
+
+/** @brief The size of the index trailer: index offset and magic */
+constexpr std::size_t INDEX_TRAILER_SIZE{ 12 };
+
+std::uint16_t readU16(const char* data)
+{
+  std::uint16_t value{ 0 };
+  for (std::size_t i = 0; i < 2; ++i)
+    value |= static_cast<std::uint16_t>(static_cast<std::uint8_t>(data[i]) << (8 * i));  // NOLINT
+  return value;
+}
+
+std::uint64_t readU64(const char* data)
+{
+  std::uint64_t value{ 0 };
+  for (std::size_t i = 0; i < 8; ++i)
+    value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << (8 * i);  // NOLINT
+  return value;
+}
+
+boost::uuids::uuid readUUID(const char* data)
+{
+  boost::uuids::uuid uuid{};
+  std::size_t i{ 0 };
+  for (auto& byte : uuid)
+    byte = static_cast<std::uint8_t>(data[i++]);  // NOLINT
+  return uuid;
+}
+
+template <typename T>
+T deserialize(const std::string& payload)
+{
+  T value;
+  std::istringstream is(payload, std::ios::in | std::ios::binary);
+  boost::archive::binary_iarchive ia(is);
+  ia >> boost::serialization::make_nvp("data", value);
+  return value;
+}
+}  // namespace
+
+TaskComposerLogReader::TaskComposerLogReader(const std::string& filepath)
+  : filepath_(filepath), file_(std::make_unique<boost::iostreams::mapped_file_source>())
+{
+  file_->open(filepath_);
+  if (!file_->is_open())
+    throw std::runtime_error("TaskComposerLogReader, failed to open file: " + filepath_);
+
+  const char* data = file_->data();
+  if (file_->size() < FILE_HEADER_SIZE ||
+      std::memcmp(data, TaskComposerLogWriter::FILE_MAGIC.data(), TaskComposerLogWriter::FILE_MAGIC.size()) != 0)
+    throw std::runtime_error("TaskComposerLogReader, file is not a streaming task composer log: " + filepath_);
+
+  if (readU16(data + 4) > TaskComposerLogWriter::FORMAT_VERSION)  // NOLINT
+    throw std::runtime_error("TaskComposerLogReader, unsupported format version: " + filepath_);
+
+  compression_ = static_cast<TaskComposerLogCompression>(data[6]);  // NOLINT
+
+  readIndex();
+  if (!complete_)
+    scanChunks();
+}
+
+TaskComposerLogReader::~TaskComposerLogReader() = default;
+
+TaskComposerLogCompression TaskComposerLogReader::getCompression() const { return compression_; }
+
+bool TaskComposerLogReader::isComplete() const { return complete_; }
+
+const std::vector<TaskComposerLogChunkEntry>& TaskComposerLogReader::getIndex() const { return index_; }
+
+std::string TaskComposerLogReader::getDescription() const
+{
+  const auto* entry = findChunk(TaskComposerLogChunkType::DESCRIPTION, boost::uuids::uuid{});
+  return (entry == nullptr) ? std::string() : readChunk(*entry);
+}
+
+TaskComposerDataStorage TaskComposerLogReader::getInitialData() const
+{
+  return readDataStorage(TaskComposerLogChunkType::INITIAL_DATA, boost::uuids::uuid{});
+}
+
+TaskComposerDataStorage TaskComposerLogReader::getFinalData() const
+{
+  return readDataStorage(TaskComposerLogChunkType::FINAL_DATA, boost::uuids::uuid{});
+}
+
+std::string TaskComposerLogReader::getDotgraph() const
+{
+  const auto* entry = findChunk(TaskComposerLogChunkType::DOTGRAPH, boost::uuids::uuid{});
+  return (entry == nullptr) ? std::string() : readChunk(*entry);
+}
+
+std::vector<boost::uuids::uuid> TaskComposerLogReader::getNodeUUIDs() const
+{
+  std::vector<boost::uuids::uuid> uuids;
+  for (const auto& entry : index_)
+  {
+    if (entry.type == TaskComposerLogChunkType::NODE_INFO)
+      uuids.push_back(entry.uuid);
+  }
+  return uuids;
+}
+
+std::unique_ptr<TaskComposerNodeInfo> TaskComposerLogReader::getNodeInfo(const boost::uuids::uuid& uuid) const
+{
+  const auto* entry = findChunk(TaskComposerLogChunkType::NODE_INFO, uuid);
+  if (entry == nullptr)
+    return nullptr;
+
+  return std::make_unique<TaskComposerNodeInfo>(deserialize<TaskComposerNodeInfo>(readChunk(*entry)));
+}
+
+TaskComposerNodeInfoContainer TaskComposerLogReader::getNodeInfos() const
+{
+  TaskComposerNodeInfoContainer container;
+  for (const auto& entry : index_)
+  {
+    if (entry.type == TaskComposerLogChunkType::NODE_INFO)
+      container.addInfo(std::make_unique<TaskComposerNodeInfo>(deserialize<TaskComposerNodeInfo>(readChunk(entry))));
+  }
+  return container;
+}
+
+TaskComposerDataStorage TaskComposerLogReader::getNodeInputs(const boost::uuids::uuid& uuid) const
+{
+  return readDataStorage(TaskComposerLogChunkType::NODE_INPUTS, uuid);
+}
+
+TaskComposerDataStorage TaskComposerLogReader::getNodeOutputs(const boost::uuids::uuid& uuid) const
+{
+  return readDataStorage(TaskComposerLogChunkType::NODE_OUTPUTS, uuid);
+}
+
+const TaskComposerLogChunkEntry* TaskComposerLogReader::findChunk(TaskComposerLogChunkType type,
+                                                                  const boost::uuids::uuid& uuid) const
+{
+  for (auto it = index_.rbegin(); it != index_.rend(); ++it)
+  {
+    if (it->type == type && it->uuid == uuid)
+      return &(*it);
+  }
+  return nullptr;
+}
+
+std::string TaskComposerLogReader::readChunk(const TaskComposerLogChunkEntry& entry) const
+{
+  const char* payload = file_->data() + entry.offset;  // NOLINT
+  if (compression_ == TaskComposerLogCompression::NONE)
+    return { payload, static_cast<std::size_t>(entry.stored_size) };
+
+  std::string raw;
+  raw.reserve(static_cast<std::size_t>(entry.raw_size));
+  boost::iostreams::filtering_istream zis;
+  zis.push(boost::iostreams::zlib_decompressor());
+  zis.push(boost::iostreams::array_source(payload, static_cast<std::size_t>(entry.stored_size)));
+  boost::iostreams::copy(zis, boost::iostreams::back_inserter(raw));
+  return raw;
+}
+
+TaskComposerDataStorage TaskComposerLogReader::readDataStorage(TaskComposerLogChunkType type,
+                                                               const boost::uuids::uuid& uuid) const
+{
+  const auto* entry = findChunk(type, uuid);
+  if (entry == nullptr)
+    return {};
+
+  return deserialize<TaskComposerDataStorage>(readChunk(*entry));
+}
+
+void TaskComposerLogReader::readIndex()
+{
+  const std::size_t size = file_->size();
+  if (size < FILE_HEADER_SIZE + INDEX_TRAILER_SIZE + 8)
+    return;
+
+  const char* data = file_->data();
+  const auto& magic = TaskComposerLogWriter::INDEX_MAGIC;
+  const char* trailer = data + (size - INDEX_TRAILER_SIZE);  // NOLINT
+  if (std::memcmp(trailer + 8, magic.data(), magic.size()) != 0)
+    return;
+
+  const std::uint64_t index_offset = readU64(trailer);
+  if (index_offset + 8 > size - INDEX_TRAILER_SIZE)
+    return;
+
+  const std::uint64_t count = readU64(data + index_offset);  // NOLINT
+  if (index_offset + 8 + (count * INDEX_ENTRY_SIZE) != size - INDEX_TRAILER_SIZE)
+    return;
+
+  index_.reserve(static_cast<std::size_t>(count));
+  const char* it = data + index_offset + 8;  // NOLINT
+  for (std::uint64_t i = 0; i < count; ++i)
+  {
+    TaskComposerLogChunkEntry entry;
+    entry.type = static_cast<TaskComposerLogChunkType>(it[0]);  // NOLINT
+    entry.uuid = readUUID(it + 1);                              // NOLINT
+    entry.offset = readU64(it + 17);                            // NOLINT
+    entry.stored_size = readU64(it + 25);                       // NOLINT
+    entry.raw_size = readU64(it + 33);                          // NOLINT
+    index_.push_back(entry);
+    it += INDEX_ENTRY_SIZE;  // NOLINT
+  }
+
+  complete_ = true;
+}
+
+void TaskComposerLogReader::scanChunks()
+{
+  index_.clear();
+  const std::size_t size = file_->size();
+  const char* data = file_->data();
+  std::size_t offset = FILE_HEADER_SIZE;
+  while (offset + CHUNK_HEADER_SIZE <= size)
+  {
+    TaskComposerLogChunkEntry entry;
+    entry.type = static_cast<TaskComposerLogChunkType>(data[offset]);  // NOLINT
+    entry.uuid = readUUID(data + offset + 1);                          // NOLINT
+    entry.stored_size = readU64(data + offset + 17);                   // NOLINT
+    entry.raw_size = readU64(data + offset + 25);                      // NOLINT
+    entry.offset = offset + CHUNK_HEADER_SIZE;
+
+    // A partially written chunk is discarded
+    if (entry.stored_size > size - entry.offset)
+      break;
+
+    index_.push_back(entry);
+    offset = static_cast<std::size_t>(entry.offset + entry.stored_size);
+  }
+}
+
+}  // namespace tesseract_planning
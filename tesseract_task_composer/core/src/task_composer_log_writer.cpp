@@ -0,0 +1,321 @@
+/**
+ * @file task_composer_log_writer.cpp
+ * @brief A streaming, chunked task composer log writer
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <sstream>
+#include <console_bridge/console.h>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_log_writer.h>
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_keys.h>
+#include <tesseract_task_composer/core/task_composer_node.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+void writeU8(std::ostream& os, std::uint8_t value) { os.put(static_cast<char>(value)); }
+
+void writeU16(std::ostream& os, std::uint16_t value)
+{
+  for (std::size_t i = 0; i < 2; ++i)
+    os.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+void writeU64(std::ostream& os, std::uint64_t value)
+{
+  for (std::size_t i = 0; i < 8; ++i)
+    os.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+void writeUUID(std::ostream& os, const boost::uuids::uuid& uuid)
+{
+  for (auto byte : uuid)
+    os.put(static_cast<char>(byte));
+}
+
+template <typename T>
+std::function<void(std::ostream& os)> makeArchiveSerializer(std::shared_ptr<T> value)
+{
+  return [value](std::ostream& os) {
+    boost::archive::binary_oarchive oa(os);
+    oa << boost::serialization::make_nvp("data", *value);
+  };
+}
+
+std::function<void(std::ostream& os)> makeStringSerializer(std::string value)
+{
+  return [value = std::move(value)](std::ostream& os) {
+    os.write(value.data(), static_cast<std::streamsize>(value.size()));
+  };
+}
+}  // namespace
+
+const std::array<char, 4> TaskComposerLogWriter::FILE_MAGIC{ 'T', 'C', 'L', 'S' };
+const std::array<char, 4> TaskComposerLogWriter::INDEX_MAGIC{ 'T', 'C', 'L', 'I' };
+
+TaskComposerLogWriter::TaskComposerLogWriter(const std::string& filepath,
+                                             const std::string& description,
+                                             TaskComposerLogCompression compression,
+                                             std::size_t max_pending)
+  : filepath_(filepath), compression_(compression), max_pending_(std::max<std::size_t>(max_pending, 1))
+{
+  file_.open(filepath_, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file_.is_open())
+    throw std::runtime_error("TaskComposerLogWriter, failed to open file: " + filepath_);
+
+  file_.write(FILE_MAGIC.data(), static_cast<std::streamsize>(FILE_MAGIC.size()));
+  writeU16(file_, FORMAT_VERSION);
+  writeU8(file_, static_cast<std::uint8_t>(compression_));
+  writeU8(file_, 0);
+
+  worker_ = std::thread([this]() { process(); });
+
+  push({ TaskComposerLogChunkType::DESCRIPTION, boost::uuids::uuid{}, makeStringSerializer(description) });
+}
+
+TaskComposerLogWriter::~TaskComposerLogWriter()
+{
+  try
+  {
+    close();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("TaskComposerLogWriter, failed to close '%s': %s", filepath_.c_str(), e.what());
+  }
+}
+
+void TaskComposerLogWriter::writeInitialData(const TaskComposerDataStorage& data_storage)
+{
+  auto copy = std::make_shared<TaskComposerDataStorage>(data_storage);
+  push({ TaskComposerLogChunkType::INITIAL_DATA, boost::uuids::uuid{}, makeArchiveSerializer(copy) });
+}
+
+void TaskComposerLogWriter::writeNodeInputs(const TaskComposerNode& node, const TaskComposerDataStorage& data_storage)
+{
+  auto inputs = extractData(node.getInputKeys(), data_storage);
+  push({ TaskComposerLogChunkType::NODE_INPUTS, node.getUUID(), makeArchiveSerializer(inputs) });
+}
+
+void TaskComposerLogWriter::writeNodeOutputs(const TaskComposerNode& node, const TaskComposerDataStorage& data_storage)
+{
+  auto outputs = extractData(node.getOutputKeys(), data_storage);
+  push({ TaskComposerLogChunkType::NODE_OUTPUTS, node.getUUID(), makeArchiveSerializer(outputs) });
+}
+
+void TaskComposerLogWriter::writeNodeInfo(const TaskComposerNodeInfo& info)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    recorded_infos_.insert(info.uuid);
+  }
+
+  auto copy = std::make_shared<TaskComposerNodeInfo>(info);
+  push({ TaskComposerLogChunkType::NODE_INFO, info.uuid, makeArchiveSerializer(copy) });
+}
+
+void TaskComposerLogWriter::writeContext(const TaskComposerContext& context,
+                                         bool include_final_data,
+                                         const std::string& dotgraph)
+{
+  // Graph node infos are added by the executor so they have not been recorded
+  std::set<boost::uuids::uuid> recorded_infos;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    recorded_infos = recorded_infos_;
+  }
+
+  auto info_map = context.task_infos.getInfoMap();
+  for (const auto& pair : info_map)
+  {
+    if (recorded_infos.find(pair.first) == recorded_infos.end())
+      writeNodeInfo(*pair.second);
+  }
+
+  if (include_final_data && context.data_storage != nullptr)
+  {
+    auto copy = std::make_shared<TaskComposerDataStorage>(*context.data_storage);
+    push({ TaskComposerLogChunkType::FINAL_DATA, boost::uuids::uuid{}, makeArchiveSerializer(copy) });
+  }
+
+  if (!dotgraph.empty())
+    push({ TaskComposerLogChunkType::DOTGRAPH, boost::uuids::uuid{}, makeStringSerializer(dotgraph) });
+}
+
+void TaskComposerLogWriter::close()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closing_)
+      return;
+
+    closing_ = true;
+  }
+  queue_cv_.notify_all();
+  space_cv_.notify_all();
+
+  if (worker_.joinable())
+    worker_.join();
+
+  // Write the index so the reader does not need to scan the file
+  auto index_offset = static_cast<std::uint64_t>(file_.tellp());
+  writeU64(file_, static_cast<std::uint64_t>(index_.size()));
+  for (const auto& entry : index_)
+  {
+    writeU8(file_, static_cast<std::uint8_t>(entry.type));
+    writeUUID(file_, entry.uuid);
+    writeU64(file_, entry.offset);
+    writeU64(file_, entry.stored_size);
+    writeU64(file_, entry.raw_size);
+  }
+  writeU64(file_, index_offset);
+  file_.write(INDEX_MAGIC.data(), static_cast<std::streamsize>(INDEX_MAGIC.size()));
+  file_.close();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  closed_ = true;
+}
+
+bool TaskComposerLogWriter::isOpen() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return !closed_;
+}
+
+const std::string& TaskComposerLogWriter::getFilePath() const { return filepath_; }
+
+void TaskComposerLogWriter::push(PendingChunk chunk)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  space_cv_.wait(lock, [this]() { return closing_ || queue_.size() < max_pending_; });
+  if (closing_)
+  {
+    CONSOLE_BRIDGE_logWarn("TaskComposerLogWriter, chunk ignored because '%s' is closed", filepath_.c_str());
+    return;
+  }
+
+  queue_.push_back(std::move(chunk));
+  lock.unlock();
+  queue_cv_.notify_one();
+}
+
+void TaskComposerLogWriter::process()
+{
+  while (true)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_cv_.wait(lock, [this]() { return closing_ || !queue_.empty(); });
+    if (queue_.empty())
+      return;
+
+    PendingChunk chunk = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    space_cv_.notify_one();
+
+    try
+    {
+      writeChunk(chunk);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TaskComposerLogWriter, failed to write chunk to '%s': %s", filepath_.c_str(), e.what());
+    }
+  }
+}
+
+void TaskComposerLogWriter::writeChunk(const PendingChunk& chunk)
+{
+  std::ostringstream raw(std::ios::out | std::ios::binary);
+  chunk.serialize(raw);
+  std::string payload = raw.str();
+  const auto raw_size = static_cast<std::uint64_t>(payload.size());
+
+  if (compression_ == TaskComposerLogCompression::ZLIB)
+  {
+    std::string compressed;
+    {
+      boost::iostreams::filtering_ostream zos;
+      zos.push(boost::iostreams::zlib_compressor(boost::iostreams::zlib::best_speed));
+      zos.push(boost::iostreams::back_inserter(compressed));
+      zos.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    }
+    payload = std::move(compressed);
+  }
+
+  TaskComposerLogChunkEntry entry;
+  entry.type = chunk.type;
+  entry.uuid = chunk.uuid;
+  entry.stored_size = static_cast<std::uint64_t>(payload.size());
+  entry.raw_size = raw_size;
+
+  writeU8(file_, static_cast<std::uint8_t>(entry.type));
+  writeUUID(file_, entry.uuid);
+  writeU64(file_, entry.stored_size);
+  writeU64(file_, entry.raw_size);
+  entry.offset = static_cast<std::uint64_t>(file_.tellp());
+  file_.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+  file_.flush();
+
+  index_.push_back(entry);
+}
+
+std::shared_ptr<TaskComposerDataStorage> TaskComposerLogWriter::extractData(const TaskComposerKeys& keys,
+                                                                            const TaskComposerDataStorage& data_storage)
+{
+  auto data = std::make_shared<TaskComposerDataStorage>();
+  data->setName(data_storage.getName());
+  for (const auto& pair : keys.data())
+  {
+    if (pair.second.index() == 0)
+    {
+      const auto& key = std::get<std::string>(pair.second);
+      if (data_storage.hasKey(key))
+        data->setData(key, data_storage.getData(key));
+    }
+    else
+    {
+      for (const auto& key : std::get<std::vector<std::string>>(pair.second))
+      {
+        if (data_storage.hasKey(key))
+          data->setData(key, data_storage.getData(key));
+      }
+    }
+  }
+  return data;
+}
+
+}  // namespace tesseract_planning
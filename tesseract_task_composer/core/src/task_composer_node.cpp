@@ -42,6 +42,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_node.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_log_writer.h>
+#include <tesseract_task_composer/core/task_composer_trace_writer.h>
 
 namespace YAML
 {
@@ -152,6 +154,9 @@ int TaskComposerNode::run(TaskComposerContext& context, OptionalTaskComposerExec
     return 0;
   }
 
+  if (context.log_writer != nullptr && type_ == TaskComposerNodeType::TASK)
+    context.log_writer->writeNodeInputs(*this, *context.data_storage);
+
   tesseract_common::Stopwatch stopwatch;
   TaskComposerNodeInfo::UPtr results;
   stopwatch.start();
@@ -183,6 +188,17 @@ int TaskComposerNode::run(TaskComposerContext& context, OptionalTaskComposerExec
     context.abort(uuid_);
   }
 
+  if (context.log_writer != nullptr)
+  {
+    if (type_ == TaskComposerNodeType::TASK)
+      context.log_writer->writeNodeOutputs(*this, *context.data_storage);
+
+    context.log_writer->writeNodeInfo(*results);
+  }
+
+  if (context.trace_writer != nullptr)
+    context.trace_writer->writeNodeInfo(*results);
+
   context.task_infos.addInfo(std::move(results));
   return value;
 }
@@ -550,8 +566,8 @@ tesseract_common::AnyPoly TaskComposerNode::getData(const TaskComposerDataStorag
                                                     const std::string& port,
                                                     bool required) const
 {
-  auto it = input_keys_.data().find(port);
-  if (it == input_keys_.data().end())
+  auto it = input_keys_.slots().find(port);
+  if (it == input_keys_.slots().end())
   {
     if (required)
       throw std::runtime_error(name_ + ", required key does not exist for the provided name: " + port);
@@ -559,10 +575,9 @@ tesseract_common::AnyPoly TaskComposerNode::getData(const TaskComposerDataStorag
     return {};
   }
 
-  const auto& key = std::get<std::string>(it->second);
-  auto data = data_storage.getData(key);
+  auto data = data_storage.getData(std::get<std::size_t>(it->second));
   if (data.isNull() && required)
-    throw std::runtime_error(name_ + ", required data is missing: " + port + ":" + key);
+    throw std::runtime_error(name_ + ", required data is missing: " + port + ":" + input_keys_.get(port));
 
   return data;
 }
@@ -572,8 +587,8 @@ std::vector<tesseract_common::AnyPoly> TaskComposerNode::getData(const TaskCompo
                                                                  const std::string& port,
                                                                  bool required) const
 {
-  auto it = input_keys_.data().find(port);
-  if (it == input_keys_.data().end())
+  auto it = input_keys_.slots().find(port);
+  if (it == input_keys_.slots().end())
   {
     if (required)
       throw std::runtime_error(name_ + ", required key does not exist for the provided name: " + port);
@@ -581,18 +596,19 @@ std::vector<tesseract_common::AnyPoly> TaskComposerNode::getData(const TaskCompo
     return {};
   }
 
-  const auto& vs = std::get<std::vector<std::string>>(it->second);
+  const auto& slots = std::get<std::vector<std::size_t>>(it->second);
   std::vector<tesseract_common::AnyPoly> data_container;
-  for (const auto& key : vs)
+  data_container.reserve(slots.size());
+  for (std::size_t i = 0; i < slots.size(); ++i)
   {
-    auto data = data_storage.getData(key);
+    auto data = data_storage.getData(slots[i]);
     if (data.isNull() && required)
     {
       std::string msg(name_);
       msg.append(", required data is missing: ");
       msg.append(port);
       msg.append(":");
-      msg.append(key);
+      msg.append(input_keys_.get<std::vector<std::string>>(port)[i]);
       throw std::runtime_error(msg);
     }
 
@@ -607,8 +623,8 @@ void TaskComposerNode::setData(TaskComposerDataStorage& data_storage,
                                tesseract_common::AnyPoly data,
                                bool required) const
 {
-  auto it = output_keys_.data().find(port);
-  if (it == output_keys_.data().end())
+  auto it = output_keys_.slots().find(port);
+  if (it == output_keys_.slots().end())
   {
     if (required)
       throw std::runtime_error(name_ + ", output key does not exist for the provided name: " + port);
@@ -616,8 +632,7 @@ void TaskComposerNode::setData(TaskComposerDataStorage& data_storage,
     return;
   }
 
-  const auto& key = std::get<std::string>(it->second);
-  data_storage.setData(key, std::move(data));
+  data_storage.setData(std::get<std::size_t>(it->second), std::move(data));
 }
 
 void TaskComposerNode::setData(TaskComposerDataStorage& data_storage,
@@ -625,8 +640,8 @@ void TaskComposerNode::setData(TaskComposerDataStorage& data_storage,
                                const std::vector<tesseract_common::AnyPoly>& data,
                                bool required) const
 {
-  auto it = output_keys_.data().find(port);
-  if (it == output_keys_.data().end())
+  auto it = output_keys_.slots().find(port);
+  if (it == output_keys_.slots().end())
   {
     if (required)
       throw std::runtime_error(name_ + ", output key does not exist for the provided name: " + port);
@@ -634,13 +649,13 @@ void TaskComposerNode::setData(TaskComposerDataStorage& data_storage,
     return;
   }
 
-  const auto& vs = std::get<std::vector<std::string>>(it->second);
-  if (vs.size() != data.size())
+  const auto& slots = std::get<std::vector<std::size_t>>(it->second);
+  if (slots.size() != data.size())
     throw std::runtime_error(
         name_ + ", output container and assigned data are not the same size for the provided name: " + port);
 
-  for (std::size_t i = 0; i < vs.size(); ++i)
-    data_storage.setData(vs[i], data[i]);
+  for (std::size_t i = 0; i < slots.size(); ++i)
+    data_storage.setData(slots[i], data[i]);
 }
 
 }  // namespace tesseract_planning
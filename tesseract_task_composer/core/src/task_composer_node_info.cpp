@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_serialize.hpp>
 #include <mutex>
+#include <thread>
 #include <tesseract_common/serialization.h>
 #include <tesseract_common/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -57,6 +58,7 @@ TaskComposerNodeInfo::TaskComposerNodeInfo(const TaskComposerNode& node)
   , input_keys(node.input_keys_)
   , output_keys(node.output_keys_)
   , triggers_abort(node.trigger_abort_)
+  , thread_id(std::hash<std::thread::id>{}(std::this_thread::get_id()))
 {
   if (type == TaskComposerNodeType::GRAPH || type == TaskComposerNodeType::PIPELINE)
   {
@@ -87,6 +89,7 @@ bool TaskComposerNodeInfo::operator==(const TaskComposerNodeInfo& rhs) const
   equal &= status_message == rhs.status_message;
   equal &= start_time == rhs.start_time;
   equal &= tesseract_common::almostEqualRelativeAndAbs(elapsed_time, rhs.elapsed_time, max_diff);
+  equal &= thread_id == rhs.thread_id;
   equal &= tesseract_common::isIdentical(inbound_edges, rhs.inbound_edges, false);
   equal &= tesseract_common::isIdentical(outbound_edges, rhs.outbound_edges, true);
   equal &= input_keys == rhs.input_keys;
@@ -121,6 +124,7 @@ void TaskComposerNodeInfo::serialize(Archive& ar, const unsigned int /*version*/
   ar& boost::serialization::make_nvp("start_time",
                                      boost::serialization::make_binary_object(&start_time, sizeof(start_time)));
   ar& boost::serialization::make_nvp("elapsed_time", elapsed_time);
+  ar& boost::serialization::make_nvp("thread_id", thread_id);
   ar& boost::serialization::make_nvp("inbound_edges", inbound_edges);
   ar& boost::serialization::make_nvp("outbound_edges", outbound_edges);
   ar& boost::serialization::make_nvp("input_keys", input_keys);
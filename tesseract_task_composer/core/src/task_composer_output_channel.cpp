@@ -0,0 +1,155 @@
+/**
+ * @file task_composer_output_channel.cpp
+ * @brief An ordered channel for publishing partial results while a task is still running
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_output_channel.h>
+
+namespace tesseract_planning
+{
+TaskComposerOutputChannel::TaskComposerOutputChannel(Callback callback) : callback_(std::move(callback)) {}
+
+void TaskComposerOutputChannel::publish(std::size_t index, tesseract_common::AnyPoly data)
+{
+  // Hold the delivery lock until the callbacks return so a later publish can not overtake them
+  std::unique_lock<std::mutex> delivery_lock(delivery_mutex_, std::defer_lock);
+  if (callback_)
+    delivery_lock.lock();
+
+  std::size_t first_index{ 0 };
+  std::vector<tesseract_common::AnyPoly> deliver;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || index < next_index_ || pending_.find(index) != pending_.end())
+      return;
+
+    pending_.emplace(index, std::move(data));
+
+    first_index = next_index_;
+    for (auto it = pending_.begin(); it != pending_.end() && it->first == next_index_; ++next_index_)
+    {
+      if (callback_)
+        deliver.push_back(std::move(it->second));
+      else
+        ready_.push_back(std::move(it->second));
+
+      it = pending_.erase(it);
+    }
+
+    if (!callback_)
+    {
+      if (next_index_ != first_index)
+        cv_.notify_all();
+
+      return;
+    }
+  }
+
+  for (std::size_t i = 0; i < deliver.size(); ++i)
+  {
+    try
+    {
+      callback_(first_index + i, deliver[i]);
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logError("TaskComposerOutputChannel, callback threw exception: %s", e.what());
+    }
+  }
+}
+
+void TaskComposerOutputChannel::close()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  closed_ = true;
+  pending_.clear();
+  cv_.notify_all();
+}
+
+bool TaskComposerOutputChannel::isClosed() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+std::size_t TaskComposerOutputChannel::getDeliveredCount() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return next_index_;
+}
+
+std::optional<tesseract_common::AnyPoly> TaskComposerOutputChannel::pop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return (!ready_.empty() || closed_); });
+  if (ready_.empty())
+    return std::nullopt;
+
+  tesseract_common::AnyPoly data = std::move(ready_.front());
+  ready_.pop_front();
+  return data;
+}
+
+std::optional<tesseract_common::AnyPoly>
+TaskComposerOutputChannel::popFor(const std::chrono::duration<double>& duration)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait_for(lock, duration, [this] { return (!ready_.empty() || closed_); });
+  if (ready_.empty())
+    return std::nullopt;
+
+  tesseract_common::AnyPoly data = std::move(ready_.front());
+  ready_.pop_front();
+  return data;
+}
+
+std::optional<tesseract_common::AnyPoly> TaskComposerOutputChannel::tryPop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (ready_.empty())
+    return std::nullopt;
+
+  tesseract_common::AnyPoly data = std::move(ready_.front());
+  ready_.pop_front();
+  return data;
+}
+
+template <class Archive>
+void TaskComposerOutputChannel::serialize(Archive& /*ar*/, const unsigned int /*version*/)
+{
+  // The channel only connects a running task to its consumer so there is no state worth serializing
+}
+
+}  // namespace tesseract_planning
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::TaskComposerOutputChannel)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::TaskComposerOutputChannel)
+TESSERACT_ANY_EXPORT_IMPLEMENT(TesseractPlanningTaskComposerOutputChannelSharedPtr)
@@ -122,7 +122,8 @@ std::vector<std::string> TaskComposerServer::getAvailableTasks() const
 std::unique_ptr<TaskComposerFuture> TaskComposerServer::run(const std::string& task_name,
                                                             std::shared_ptr<TaskComposerDataStorage> data_storage,
                                                             bool dotgraph,
-                                                            const std::string& executor_name)
+                                                            const std::string& executor_name,
+                                                            TaskComposerPriority priority)
 {
   auto e_it = executors_.find(executor_name);
   if (e_it == executors_.end())
@@ -133,20 +134,21 @@ std::unique_ptr<TaskComposerFuture> TaskComposerServer::run(const std::string& t
     throw std::runtime_error("Task with name '" + task_name + "' does not exist!");
 
   data_storage->setName(task_name);
-  return e_it->second->run(*t_it->second, std::move(data_storage), dotgraph);
+  return e_it->second->run(*t_it->second, std::move(data_storage), priority, dotgraph);
 }
 
 std::unique_ptr<TaskComposerFuture> TaskComposerServer::run(const TaskComposerNode& node,
                                                             std::shared_ptr<TaskComposerDataStorage> data_storage,
                                                             bool dotgraph,
-                                                            const std::string& executor_name)
+                                                            const std::string& executor_name,
+                                                            TaskComposerPriority priority)
 {
   auto it = executors_.find(executor_name);
   if (it == executors_.end())
     throw std::runtime_error("Executor with name '" + executor_name + "' does not exist!");
 
   data_storage->setName(node.getName());
-  return it->second->run(node, std::move(data_storage), dotgraph);
+  return it->second->run(node, std::move(data_storage), priority, dotgraph);
 }
 
 long TaskComposerServer::getWorkerCount(const std::string& name) const
@@ -167,6 +169,15 @@ long TaskComposerServer::getTaskCount(const std::string& name) const
   return it->second->getTaskCount();
 }
 
+TaskComposerExecutorMetrics TaskComposerServer::getMetrics(const std::string& name, TaskComposerPriority priority) const
+{
+  auto it = executors_.find(name);
+  if (it == executors_.end())
+    throw std::runtime_error("Executor with name '" + name + "' does not exist!");
+
+  return it->second->getMetrics(priority);
+}
+
 void TaskComposerServer::loadPlugins()
 {
   auto executor_plugins = plugin_factory_->getTaskComposerExecutorPlugins();
@@ -0,0 +1,356 @@
+/**
+ * @file task_composer_trace_writer.cpp
+ * @brief Export task composer execution as Chrome trace events
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <typeindex>
+#include <vector>
+#include <console_bridge/console.h>
+#include <boost/uuid/uuid_io.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_trace_writer.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief The trace process id, every node is reported under a single process */
+constexpr int TRACE_PID{ 1 };
+
+/** @brief The size of the buffered events at which they are written regardless of the flush interval */
+constexpr std::size_t FLUSH_SIZE{ 1 << 16 };
+
+std::string escape(const std::string& value)
+{
+  std::string result;
+  result.reserve(value.size());
+  for (char c : value)
+  {
+    switch (c)
+    {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\r':
+        result += "\\r";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          std::array<char, 8> buffer{};
+          std::snprintf(buffer.data(), buffer.size(), "\\u%04x", static_cast<unsigned>(c));  // NOLINT
+          result += buffer.data();
+        }
+        else
+        {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+
+std::string formatNumber(double value)
+{
+  std::array<char, 32> buffer{};
+  std::snprintf(buffer.data(), buffer.size(), "%.3f", value);  // NOLINT
+  return buffer.data();
+}
+
+std::string getCategory(TaskComposerNodeType type)
+{
+  switch (type)
+  {
+    case TaskComposerNodeType::TASK:
+      return "task";
+    case TaskComposerNodeType::PIPELINE:
+      return "pipeline";
+    case TaskComposerNodeType::GRAPH:
+      return "graph";
+    default:
+      return "node";
+  }
+}
+
+/** @brief Convert a data storage entry to a number, numeric types and booleans are supported */
+std::optional<double> toNumber(const tesseract_common::AnyPoly& value)
+{
+  const std::type_index type = value.getType();
+  if (type == std::type_index(typeid(double)))
+    return value.as<double>();
+  if (type == std::type_index(typeid(float)))
+    return static_cast<double>(value.as<float>());
+  if (type == std::type_index(typeid(int)))
+    return static_cast<double>(value.as<int>());
+  if (type == std::type_index(typeid(long)))
+    return static_cast<double>(value.as<long>());
+  if (type == std::type_index(typeid(unsigned)))
+    return static_cast<double>(value.as<unsigned>());
+  if (type == std::type_index(typeid(std::size_t)))
+    return static_cast<double>(value.as<std::size_t>());
+  if (type == std::type_index(typeid(bool)))
+    return value.as<bool>() ? 1.0 : 0.0;
+
+  return std::nullopt;
+}
+}  // namespace
+
+TaskComposerTraceWriter::TaskComposerTraceWriter(std::ostream& os, std::chrono::system_clock::time_point origin)
+  : os_(&os), origin_(origin)
+{
+  *os_ << "[\n";
+}
+
+TaskComposerTraceWriter::TaskComposerTraceWriter(const std::string& filepath,
+                                                 std::chrono::system_clock::time_point origin)
+  : origin_(origin)
+{
+  auto file = std::make_unique<std::ofstream>(filepath, std::ios::out | std::ios::trunc);
+  if (!file->is_open())
+    throw std::runtime_error("TaskComposerTraceWriter, failed to open file: " + filepath);
+
+  file_ = std::move(file);
+  os_ = file_.get();
+  *os_ << "[\n";
+}
+
+TaskComposerTraceWriter::~TaskComposerTraceWriter()
+{
+  try
+  {
+    close();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("TaskComposerTraceWriter, failed to close: %s", e.what());
+  }
+}
+
+void TaskComposerTraceWriter::writeNodeInfo(const TaskComposerNodeInfo& info)
+{
+  // Everything which does not depend on the nodes written before is formatted without holding the lock
+  const double start = toMicroseconds(info.start_time);
+  const double duration = std::max(info.elapsed_time * 1e6, 0.0);
+  const std::string name = escape(info.name);
+
+  // Task specific counters, the node info data storage is where tasks report their metadata
+  std::vector<std::pair<std::string, double>> counters;
+  for (const auto& entry : info.data_storage.getData())
+  {
+    auto value = toNumber(entry.second);
+    if (value.has_value() && std::isfinite(*value))
+      counters.emplace_back(escape(entry.first), *value);
+  }
+  std::sort(counters.begin(), counters.end());
+
+  std::stringstream args;
+  args << R"("uuid":")" << boost::uuids::to_string(info.uuid) << R"(","parent":")"
+       << boost::uuids::to_string(info.parent_uuid) << R"(","namespace":")" << escape(info.ns)
+       << R"(","return_value":)" << info.return_value << R"(,"status_code":)" << info.status_code
+       << R"(,"status_message":")" << escape(info.status_message) << R"(","aborted":)"
+       << (info.isAborted() ? "true" : "false");
+  for (const auto& counter : counters)
+    args << R"(,")" << counter.first << R"(":)" << counter.second;
+
+  std::string counter_event;
+  if (!counters.empty())
+  {
+    std::stringstream ss;
+    ss << R"({"name":")" << name << R"(","ph":"C","ts":)" << formatNumber(start + duration) << R"(,"pid":)"
+       << TRACE_PID << R"(,"args":{)";
+    for (std::size_t i = 0; i < counters.size(); ++i)
+      ss << ((i == 0) ? "" : ",") << '"' << counters[i].first << R"(":)" << counters[i].second;
+    ss << "}}";
+    counter_event = ss.str();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closed_)
+    return;
+
+  const int tid = getThreadId(info.thread_id);
+  std::stringstream event;
+  event << R"({"name":")" << name << R"(","cat":")" << getCategory(info.type) << R"(","ph":"X","ts":)"
+        << formatNumber(start) << R"(,"dur":)" << formatNumber(duration) << R"(,"pid":)" << TRACE_PID
+        << R"(,"tid":)" << tid << R"(,"args":{)" << args.str() << "}}";
+  writeEvent(event.str());
+
+  if (!counter_event.empty())
+    writeEvent(counter_event);
+
+  // Flow arrows from the parent nodes, the flow start is bound to the parent slice and the end to this slice
+  for (const auto& inbound : info.inbound_edges)
+  {
+    auto it = written_nodes_.find(inbound);
+    if (it == written_nodes_.end())
+      continue;
+
+    const std::size_t id = ++flow_id_;
+    std::stringstream flow;
+    flow << R"({"name":"edge","cat":"flow","ph":"s","id":)" << id << R"(,"ts":)" << formatNumber(it->second.start)
+         << R"(,"pid":)" << TRACE_PID << R"(,"tid":)" << it->second.tid << "}";
+    writeEvent(flow.str());
+
+    flow.str("");
+    flow << R"({"name":"edge","cat":"flow","ph":"f","bp":"e","id":)" << id << R"(,"ts":)" << formatNumber(start)
+         << R"(,"pid":)" << TRACE_PID << R"(,"tid":)" << tid << "}";
+    writeEvent(flow.str());
+  }
+
+  written_nodes_[info.uuid] = WrittenNode{ start, tid };
+  if (buffer_.size() >= FLUSH_SIZE || std::chrono::steady_clock::now() - last_flush_ >= flush_interval_)
+    flushBuffer();
+}
+
+void TaskComposerTraceWriter::writeNodeInfos(const TaskComposerNodeInfoContainer& container)
+{
+  auto info_map = container.getInfoMap();
+  std::vector<const TaskComposerNodeInfo*> infos;
+  infos.reserve(info_map.size());
+  for (const auto& pair : info_map)
+    infos.push_back(pair.second.get());
+
+  // Parents always start before their children so writing in order of start time resolves every flow arrow
+  std::stable_sort(infos.begin(), infos.end(), [](const TaskComposerNodeInfo* lhs, const TaskComposerNodeInfo* rhs) {
+    return lhs->start_time < rhs->start_time;
+  });
+
+  for (const auto* info : infos)
+    writeNodeInfo(*info);
+}
+
+void TaskComposerTraceWriter::flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!closed_)
+    flushBuffer();
+}
+
+void TaskComposerTraceWriter::setFlushInterval(std::chrono::milliseconds interval)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  flush_interval_ = interval;
+}
+
+void TaskComposerTraceWriter::close()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closed_)
+    return;
+
+  closed_ = true;
+  *os_ << buffer_ << "\n]\n";
+  buffer_.clear();
+  os_->flush();
+  if (file_ != nullptr)
+    file_.reset();
+}
+
+void TaskComposerTraceWriter::toTrace(std::ostream& os, const TaskComposerNodeInfoContainer& container)
+{
+  auto info_map = container.getInfoMap();
+  auto origin = std::chrono::system_clock::time_point::max();
+  for (const auto& pair : info_map)
+    origin = std::min(origin, pair.second->start_time);
+
+  if (info_map.empty())
+    origin = std::chrono::system_clock::time_point{};
+
+  TaskComposerTraceWriter writer(os, origin);
+  writer.writeNodeInfos(container);
+  writer.close();
+}
+
+bool TaskComposerTraceWriter::saveTrace(const std::string& filepath, const TaskComposerNodeInfoContainer& container)
+{
+  std::ofstream file(filepath, std::ios::out | std::ios::trunc);
+  if (!file.is_open())
+  {
+    CONSOLE_BRIDGE_logError("TaskComposerTraceWriter, failed to open file: %s", filepath.c_str());
+    return false;
+  }
+
+  toTrace(file, container);
+  return file.good();
+}
+
+int TaskComposerTraceWriter::getThreadId(std::size_t thread_id)
+{
+  auto it = thread_ids_.find(thread_id);
+  if (it != thread_ids_.end())
+    return it->second;
+
+  const int tid = static_cast<int>(thread_ids_.size()) + 1;
+  thread_ids_[thread_id] = tid;
+
+  std::stringstream event;
+  event << R"({"name":"thread_name","ph":"M","pid":)" << TRACE_PID << R"(,"tid":)" << tid
+        << R"(,"args":{"name":"Worker )" << tid << R"("}})";
+  writeEvent(event.str());
+  return tid;
+}
+
+double TaskComposerTraceWriter::toMicroseconds(std::chrono::system_clock::time_point time) const
+{
+  return std::chrono::duration<double, std::micro>(time - origin_).count();
+}
+
+void TaskComposerTraceWriter::writeEvent(const std::string& event)
+{
+  if (!first_event_)
+    buffer_ += ",\n";
+
+  first_event_ = false;
+  buffer_ += event;
+}
+
+void TaskComposerTraceWriter::flushBuffer()
+{
+  *os_ << buffer_;
+  os_->flush();
+  buffer_.clear();
+  last_flush_ = std::chrono::steady_clock::now();
+}
+
+}  // namespace tesseract_planning
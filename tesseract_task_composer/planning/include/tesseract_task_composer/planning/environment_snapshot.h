@@ -0,0 +1,136 @@
+/**
+ * @file environment_snapshot.h
+ * @brief An immutable, shared snapshot of an environment with per thread contact managers and state solvers
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_ENVIRONMENT_SNAPSHOT_H
+#define TESSERACT_TASK_COMPOSER_ENVIRONMENT_SNAPSHOT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <tesseract_task_composer/planning/tesseract_task_composer_planning_nodes_export.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/fwd.h>
+#include <tesseract_collision/core/fwd.h>
+#include <tesseract_state_solver/fwd.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief An immutable, reference counted snapshot of an environment
+ * @details Snapshots are cached per source environment, so every task asking for a snapshot of an unchanged
+ * environment shares the same clone instead of cloning it again. The cache is invalidated when the revision or the
+ * current state of the source environment changes.
+ *
+ * The state solver and contact managers are created lazily, once per thread, and are reused by every later request
+ * from the same thread. Before being returned they are restored to the configuration they had when first created,
+ * including the collision object transforms of the snapshot state, so the caller may change the active objects,
+ * margins, enabled state and transforms like it would on a fresh clone.
+ */
+class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT EnvironmentSnapshot
+  : public std::enable_shared_from_this<EnvironmentSnapshot>
+{
+public:
+  using Ptr = std::shared_ptr<EnvironmentSnapshot>;
+  using ConstPtr = std::shared_ptr<const EnvironmentSnapshot>;
+
+  ~EnvironmentSnapshot();
+  EnvironmentSnapshot(const EnvironmentSnapshot&) = delete;
+  EnvironmentSnapshot& operator=(const EnvironmentSnapshot&) = delete;
+  EnvironmentSnapshot(EnvironmentSnapshot&&) = delete;
+  EnvironmentSnapshot& operator=(EnvironmentSnapshot&&) = delete;
+
+  /**
+   * @brief Get the snapshot of an environment
+   * @details If the environment is itself a snapshot, or a snapshot of it at the same revision and state already
+   * exists, the existing snapshot is returned. Otherwise the environment is cloned.
+   * @param env The environment
+   * @return The snapshot
+   */
+  static ConstPtr create(const std::shared_ptr<const tesseract_environment::Environment>& env);
+
+  /**
+   * @brief Find the existing snapshot of an environment
+   * @details Unlike create this never clones the environment, so it can be used by tasks which only benefit from a
+   * snapshot if one was already created, for example by a raster task upstream.
+   * @param env The environment
+   * @return The snapshot if the environment is itself a snapshot or an up to date snapshot of it exists, otherwise
+   * nullptr
+   */
+  static ConstPtr find(const std::shared_ptr<const tesseract_environment::Environment>& env);
+
+  /**
+   * @brief Get the immutable environment
+   * @details The returned pointer keeps the snapshot alive, so passing it to create returns this snapshot
+   */
+  std::shared_ptr<const tesseract_environment::Environment> getEnvironment() const;
+
+  /** @brief Get the revision of the environment the snapshot was created from */
+  int getRevision() const;
+
+  /**
+   * @brief Get the state solver of the calling thread
+   * @details The state is reset to the state of the snapshot. The reference is valid for the lifetime of the snapshot
+   * but is shared with every later call from the same thread.
+   */
+  tesseract_scene_graph::StateSolver& getStateSolver() const;
+
+  /**
+   * @brief Get the discrete contact manager of the calling thread
+   * @details The manager is restored to the configuration of the snapshot
+   */
+  tesseract_collision::DiscreteContactManager& getDiscreteContactManager() const;
+
+  /**
+   * @brief Get the continuous contact manager of the calling thread
+   * @details The manager is restored to the configuration of the snapshot
+   */
+  tesseract_collision::ContinuousContactManager& getContinuousContactManager() const;
+
+protected:
+  struct ThreadLocalData;
+  struct ManagerConfig;
+
+  explicit EnvironmentSnapshot(std::shared_ptr<const tesseract_environment::Environment> env);
+
+  std::shared_ptr<const tesseract_environment::Environment> env_;
+  int revision_{ 0 };
+  std::unordered_map<std::string, double> joint_values_;
+
+  mutable std::mutex mutex_;
+  mutable std::unique_ptr<ManagerConfig> discrete_config_;
+  mutable std::unique_ptr<ManagerConfig> continuous_config_;
+  mutable std::unordered_map<std::thread::id, std::unique_ptr<ThreadLocalData>> thread_data_;
+
+  ThreadLocalData& getThreadLocalData() const;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_ENVIRONMENT_SNAPSHOT_H
@@ -157,12 +157,11 @@ protected:
       CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
       return info;
     }
-    tesseract_common::AnyPoly original_input_data_poly{ input_data_poly };
 
     auto profiles =
         getData(*context.data_storage, INPUT_PROFILES_PORT).template as<std::shared_ptr<ProfileDictionary>>();
 
-    // Make a non-const copy of the input instructions to update the start/end
+    // The input data is a copy of what is in the data storage so the instructions can be moved into the request
     auto& instructions = input_data_poly.template as<CompositeInstruction>();
     if (instructions.getManipulatorInfo().empty())
       throw std::runtime_error("Missing manipulator information");
@@ -172,7 +171,7 @@ protected:
     // --------------------
     PlannerRequest request;
     request.env = env;
-    request.instructions = instructions;
+    request.instructions = std::move(instructions);
     request.profiles = profiles;
     request.format_result_as_input = format_result_as_input_;
 
@@ -182,6 +181,7 @@ protected:
     request.verbose = false;
     if (console_bridge::getLogLevel() == console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_DEBUG)
       request.verbose = true;
+    info->data_storage.setData("waypoints_in", request.instructions.getMoveInstructionCount());
     PlannerResponse response = planner_->solve(request);
 
     // --------------------
@@ -190,7 +190,8 @@ protected:
     if (response)
     {
       // Should only set on success to support error branching
-      setData(*context.data_storage, INOUT_PROGRAM_PORT, response.results);
+      info->data_storage.setData("waypoints_out", response.results.getMoveInstructionCount());
+      setData(*context.data_storage, INOUT_PROGRAM_PORT, std::move(response.results));
       info->return_value = 1;
       info->color = "green";
       info->status_code = 1;
@@ -202,12 +203,12 @@ protected:
     CONSOLE_BRIDGE_logInform("%s motion planning failed (%s) for process input: %s",
                              planner_->getName().c_str(),
                              response.message.c_str(),
-                             instructions.getDescription().c_str());
+                             request.instructions.getDescription().c_str());
 
     // If the output key is not the same as the input key the output data should be assigned the input data for error
-    // branching
+    // branching. Planners do not modify the request so it still holds the original input.
     if (output_keys_.get(INOUT_PROGRAM_PORT) != input_keys_.get(INOUT_PROGRAM_PORT))
-      setData(*context.data_storage, INOUT_PROGRAM_PORT, original_input_data_poly);
+      setData(*context.data_storage, INOUT_PROGRAM_PORT, std::move(request.instructions));
 
     info->status_message = response.message;
     return info;
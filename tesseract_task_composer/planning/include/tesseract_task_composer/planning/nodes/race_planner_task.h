@@ -0,0 +1,118 @@
+/**
+ * @file race_planner_task.h
+ * @brief Race several planner tasks on the same program and keep the first valid result
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_RACE_PLANNER_TASK_H
+#define TESSERACT_TASK_COMPOSER_RACE_PLANNER_TASK_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/export.hpp>
+#include <vector>
+#include <tesseract_task_composer/planning/tesseract_task_composer_planning_nodes_export.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_task.h>
+#include <tesseract_task_composer/planning/planner_task_factory.h>
+#include <tesseract_common/fwd.h>
+
+namespace tesseract_planning
+{
+class TaskComposerPluginFactory;
+
+/**
+ * @brief Runs several contender tasks on the same input program in parallel and keeps the first valid result
+ * @details Each contender, for example an OMPL pipeline and a TrajOpt pipeline, is run by the executor on its own copy
+ * of the data storage so the contenders never see each other's data. As soon as a contender finishes successfully its
+ * output program is checked by the optional validator task, for example a DiscreteContactCheckTask. The first result
+ * which passes is written to the output program and the remaining contenders are aborted through their futures.
+ *
+ * A contender or validator is successful if its context was not aborted and, if it is a task, its return value is not
+ * zero. Graphs and pipelines should therefore set an abort terminal for their error terminal.
+ *
+ * Aborting is cooperative, a contender stops at the next node boundary. The task does not wait for the aborted
+ * contenders so its latency is bound by the fastest valid contender, while the aborted contenders finish in the
+ * background. The name and index of the winning contender are recorded in the data storage of the node info under
+ * "winner" and "winner_index".
+ */
+class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT RacePlannerTask : public TaskComposerTask
+{
+public:
+  // Requried
+  static const std::string INOUT_PROGRAM_PORT;
+
+  using TaskFactoryResults = PlannerTaskFactoryResults;
+  using TaskFactory = PlannerTaskFactory;
+
+  RacePlannerTask();
+  /**
+   * @brief Constructor
+   * @param name The name of the task
+   * @param input_program_key The input program key
+   * @param output_program_key The output program key
+   * @param conditional Indicate if the task is conditional
+   * @param contender_task_factories The factories creating each contender
+   * @param validator_task_factory The optional factory creating the task which validates a contender's output
+   */
+  explicit RacePlannerTask(std::string name,
+                           std::string input_program_key,
+                           std::string output_program_key,
+                           bool conditional,
+                           std::vector<TaskFactory> contender_task_factories,
+                           TaskFactory validator_task_factory = nullptr);
+
+  explicit RacePlannerTask(std::string name,
+                           const YAML::Node& config,
+                           const TaskComposerPluginFactory& plugin_factory);
+
+  ~RacePlannerTask() override = default;
+  RacePlannerTask(const RacePlannerTask&) = delete;
+  RacePlannerTask& operator=(const RacePlannerTask&) = delete;
+  RacePlannerTask(RacePlannerTask&&) = delete;
+  RacePlannerTask& operator=(RacePlannerTask&&) = delete;
+
+  bool operator==(const RacePlannerTask& rhs) const;
+  bool operator!=(const RacePlannerTask& rhs) const;
+
+protected:
+  std::vector<TaskFactory> contender_task_factories_;
+  TaskFactory validator_task_factory_;
+
+  friend struct tesseract_common::Serialization;
+  friend class boost::serialization::access;
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/);  // NOLINT
+
+  static TaskComposerNodePorts ports();
+
+  std::unique_ptr<TaskComposerNodeInfo> runImpl(TaskComposerContext& context,
+                                                OptionalTaskComposerExecutor executor) const override final;
+};
+}  // namespace tesseract_planning
+
+BOOST_CLASS_EXPORT_KEY(tesseract_planning::RacePlannerTask)
+
+#endif  // TESSERACT_TASK_COMPOSER_RACE_PLANNER_TASK_H
@@ -55,6 +55,12 @@ class TaskComposerPluginFactory;
  *   Composite - Raster segment
  *   Composite - to end
  * }
+ *
+ * If a TaskComposerOutputChannel is provided on the optional segment channel port, each segment is published to it as
+ * soon as it has been planned, using its index in the program above. The channel delivers them in program order, so
+ * execution can start while later segments are still being planned. Every segment is published as it will appear in
+ * the output program and the channel is closed once the subgraph has finished, whether it succeeded or not. If the
+ * subgraph is aborted the channel is closed right away and nothing more is published.
  */
 
 class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT RasterMotionTask : public TaskComposerTask
@@ -64,6 +70,9 @@ public:
   static const std::string INOUT_PROGRAM_PORT;
   static const std::string INPUT_ENVIRONMENT_PORT;
 
+  // Optional
+  static const std::string INPUT_SEGMENT_CHANNEL_PORT;
+
   struct TaskFactoryResults
   {
     TaskComposerNode::UPtr node;
@@ -80,7 +89,8 @@ public:
                             bool conditional,
                             TaskFactory freespace_task_factory,
                             TaskFactory raster_task_factory,
-                            TaskFactory transition_task_factory);
+                            TaskFactory transition_task_factory,
+                            std::string input_segment_channel_key = "");
 
   explicit RasterMotionTask(std::string name,
                             const YAML::Node& config,
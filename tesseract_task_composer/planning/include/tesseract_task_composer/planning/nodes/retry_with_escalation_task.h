@@ -0,0 +1,204 @@
+/**
+ * @file retry_with_escalation_task.h
+ * @brief Retry a planner task with escalated profiles until it succeeds
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_RETRY_WITH_ESCALATION_TASK_H
+#define TESSERACT_TASK_COMPOSER_RETRY_WITH_ESCALATION_TASK_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/export.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <tesseract_task_composer/planning/tesseract_task_composer_planning_nodes_export.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_task.h>
+#include <tesseract_task_composer/planning/planner_task_factory.h>
+#include <tesseract_common/fwd.h>
+
+namespace tesseract_planning
+{
+class TaskComposerPluginFactory;
+
+/**
+ * @brief Runs a planner task and retries it with escalated profiles until it succeeds
+ * @details The wrapped task, for example a TrajOpt or OMPL pipeline, is run by the executor on its own copy of the data
+ * storage. Each attempt overrides the profiles of the input program for the configured namespaces with the next
+ * profile name of the escalation list, so the wrapped task looks up that profile in the ProfileDictionary. The list is
+ * ordered from the cheapest to the most expensive profile, for example more SQP iterations, larger collision margins or
+ * a longer OMPL planning time. The output program keeps the overrides of the successful attempt.
+ *
+ * An attempt is successful if its context was not aborted, if it is a task its return value is not zero, and it wrote
+ * an output program. Graphs and pipelines should therefore set an abort terminal for their error terminal.
+ *
+ * Each attempt may be limited by a deadline and all attempts by a total budget, both in seconds where zero disables the
+ * limit. An attempt past its deadline is aborted cooperatively and not waited on, so it finishes in the background.
+ * The deadline and budget therefore limit how long this task waits, not the compute spent: a planner which does not
+ * check for the abort keeps its worker thread busy until it finishes on its own. The output of such an attempt is
+ * written to its own copy of the data storage and discarded, it never reaches the data storage of this task.
+ *
+ * The number of attempts and successes of each profile is recorded in a table. By default the table is shared by every
+ * task in the process with the same name, wrapped task and profile namespaces, otherwise the caller provides its own
+ * table. When adaptive, the profiles are attempted in order of their estimated success rate, so the historically
+ * best profile is tried first on later runs, while profiles with the same rate keep their escalation order. The profile
+ * of the successful attempt and the number of attempts are recorded in the data storage of the node info under
+ * "profile" and "attempts".
+ */
+class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT RetryWithEscalationTask : public TaskComposerTask
+{
+public:
+  // Requried
+  static const std::string INOUT_PROGRAM_PORT;
+
+  using TaskFactoryResults = PlannerTaskFactoryResults;
+  using TaskFactory = PlannerTaskFactory;
+
+  /** @brief The attempts and successes of a profile */
+  struct ProfileStatistics
+  {
+    std::size_t attempts{ 0 };
+    std::size_t successes{ 0 };
+
+    /** @brief The estimated success rate, which is one half for a profile which was never attempted */
+    double getSuccessRate() const;
+  };
+
+  /** @brief The thread safe profile statistics of the tasks recording into it */
+  class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT ProfileStatisticsTable
+  {
+  public:
+    using Ptr = std::shared_ptr<ProfileStatisticsTable>;
+    using ConstPtr = std::shared_ptr<const ProfileStatisticsTable>;
+
+    /** @brief Record an attempt of a profile */
+    void record(const std::string& profile, bool successful);
+
+    /** @brief Get the statistics by profile name */
+    std::map<std::string, ProfileStatistics> get() const;
+
+    /** @brief Clear the statistics */
+    void clear();
+
+  private:
+    mutable std::mutex mutex_;
+    std::map<std::string, ProfileStatistics> statistics_;
+  };
+
+  RetryWithEscalationTask();
+  /**
+   * @brief Constructor
+   * @param name The name of the task
+   * @param input_program_key The input program key
+   * @param output_program_key The output program key
+   * @param conditional Indicate if the task is conditional
+   * @param task_factory The factory creating the task run by each attempt
+   * @param namespaces The profile namespaces overridden by each attempt
+   * @param profiles The profile names in order of escalation
+   * @param attempt_timeout The deadline of each attempt in seconds, zero disables it
+   * @param budget The budget of all attempts in seconds, zero disables it
+   * @param adaptive Indicate if the profiles are attempted in order of their success rate
+   * @param statistics The table recording the profile statistics, if null the table shared by the tasks of the same
+   * statistics key is used
+   */
+  explicit RetryWithEscalationTask(std::string name,
+                                   std::string input_program_key,
+                                   std::string output_program_key,
+                                   bool conditional,
+                                   TaskFactory task_factory,
+                                   std::vector<std::string> namespaces,
+                                   std::vector<std::string> profiles,
+                                   double attempt_timeout = 0,
+                                   double budget = 0,
+                                   bool adaptive = true,
+                                   ProfileStatisticsTable::Ptr statistics = nullptr);
+
+  explicit RetryWithEscalationTask(std::string name,
+                                   const YAML::Node& config,
+                                   const TaskComposerPluginFactory& plugin_factory);
+
+  ~RetryWithEscalationTask() override = default;
+  RetryWithEscalationTask(const RetryWithEscalationTask&) = delete;
+  RetryWithEscalationTask& operator=(const RetryWithEscalationTask&) = delete;
+  RetryWithEscalationTask(RetryWithEscalationTask&&) = delete;
+  RetryWithEscalationTask& operator=(RetryWithEscalationTask&&) = delete;
+
+  /** @brief Get the profile names in the order they are attempted by the next run */
+  std::vector<std::string> getAttemptOrder() const;
+
+  /**
+   * @brief Get the key of the shared profile statistics table
+   * @details It is made of the task name, the class or task name of the wrapped task when created from YAML and the
+   * profile namespaces, so tasks wrapping different planners or escalating different namespaces never share a table.
+   */
+  std::string getStatisticsKey() const;
+
+  /**
+   * @brief Get the profile statistics used by the task
+   * @return The statistics by profile name
+   */
+  std::map<std::string, ProfileStatistics> getProfileStatistics() const;
+
+  /** @brief Clear the shared profile statistics of every task, tables provided by the caller are not cleared */
+  static void clearProfileStatistics();
+
+  bool operator==(const RetryWithEscalationTask& rhs) const;
+  bool operator!=(const RetryWithEscalationTask& rhs) const;
+
+protected:
+  TaskFactory task_factory_;
+  std::vector<std::string> namespaces_;
+  std::vector<std::string> profiles_;
+  double attempt_timeout_{ 0 };
+  double budget_{ 0 };
+  bool adaptive_{ true };
+
+  /** @brief The class or task name of the wrapped task when created from YAML */
+  std::string wrapped_task_;
+
+  /** @brief The table provided by the caller, if null the shared table of the statistics key is used */
+  ProfileStatisticsTable::Ptr statistics_;
+
+  /** @brief Get the table recording the profile statistics of the task */
+  ProfileStatisticsTable::Ptr getProfileStatisticsTable() const;
+
+  friend struct tesseract_common::Serialization;
+  friend class boost::serialization::access;
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/);  // NOLINT
+
+  static TaskComposerNodePorts ports();
+
+  std::unique_ptr<TaskComposerNodeInfo> runImpl(TaskComposerContext& context,
+                                                OptionalTaskComposerExecutor executor) const override final;
+};
+}  // namespace tesseract_planning
+
+BOOST_CLASS_EXPORT_KEY(tesseract_planning::RetryWithEscalationTask)
+
+#endif  // TESSERACT_TASK_COMPOSER_RETRY_WITH_ESCALATION_TASK_H
@@ -0,0 +1,91 @@
+/**
+ * @file planner_task_factory.h
+ * @brief Factories creating the planner tasks run by a task on its own child contexts
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_PLANNER_TASK_FACTORY_H
+#define TESSERACT_TASK_COMPOSER_PLANNER_TASK_FACTORY_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <string>
+#include <tesseract_task_composer/planning/tesseract_task_composer_planning_nodes_export.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_node.h>
+
+namespace YAML
+{
+class Node;
+}
+
+namespace tesseract_planning
+{
+class TaskComposerContext;
+class TaskComposerPluginFactory;
+
+/** @brief The planner task created by a factory and the keys of its input and output program */
+struct PlannerTaskFactoryResults
+{
+  TaskComposerNode::UPtr node;
+  std::string input_key;
+  std::string output_key;
+};
+
+/** @brief Creates a planner task given its name and index */
+using PlannerTaskFactory = std::function<PlannerTaskFactoryResults(const std::string& name, std::size_t index)>;
+
+/**
+ * @brief Create a planner task factory from a YAML entry
+ * @details The entry either creates a new node from a plugin using 'class' or references a previously defined task
+ * using 'task', the same as the nodes of a graph. The 'config' of a task entry may set its 'abort_terminal' and
+ * 'remapping'. The node is named after the optional 'name' entry, otherwise after the name provided to the factory.
+ * The output key is empty if the node has no output program.
+ * @param owner_name The name of the task the entry belongs to, used in error messages
+ * @param entry_name The name of the entry, used in error messages
+ * @param entry The YAML entry
+ * @param plugin_factory The plugin factory, which must outlive the returned factory
+ * @param program_port The port of the input and output program of the node
+ * @return The planner task factory
+ */
+TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT PlannerTaskFactory
+createPlannerTaskFactory(const std::string& owner_name,
+                         const std::string& entry_name,
+                         const YAML::Node& entry,
+                         const TaskComposerPluginFactory& plugin_factory,
+                         const std::string& program_port = "program");
+
+/**
+ * @brief Check if a planner task run on its own context finished successfully
+ * @details It is successful if its context was not aborted and, if it is a task, its return value is not zero. Graphs
+ * and pipelines should therefore set an abort terminal for their error terminal.
+ * @param node The planner task
+ * @param context The context the planner task was run on
+ * @return True if successful, otherwise false
+ */
+TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT bool isPlannerTaskSuccessful(const TaskComposerNode& node,
+                                                                           const TaskComposerContext& context);
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_PLANNER_TASK_FACTORY_H
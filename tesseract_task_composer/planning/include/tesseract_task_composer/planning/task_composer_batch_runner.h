@@ -0,0 +1,237 @@
+/**
+ * @file task_composer_batch_runner.h
+ * @brief Plan many independent programs with a single pipeline
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_BATCH_RUNNER_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_BATCH_RUNNER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <tesseract_task_composer/planning/tesseract_task_composer_planning_nodes_export.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_node_types.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_environment/fwd.h>
+
+namespace tesseract_planning
+{
+class ProfileDictionary;
+class TaskComposerContext;
+class TaskComposerExecutor;
+class TaskComposerNode;
+class TaskComposerPluginFactory;
+
+/** @brief A program to plan as part of a batch */
+struct TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchJob
+{
+  TaskComposerBatchJob() = default;
+  TaskComposerBatchJob(CompositeInstruction program, std::shared_ptr<ProfileDictionary> profiles);
+
+  /** @brief The program to plan */
+  CompositeInstruction program;
+
+  /** @brief The profiles used to plan the program, jobs may share the same dictionary */
+  std::shared_ptr<ProfileDictionary> profiles;
+};
+
+/** @brief The result of a job of a batch */
+struct TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchResult
+{
+  /** @brief The index of the job in the batch */
+  std::size_t index{ 0 };
+
+  /** @brief Indicate if the pipeline finished without aborting */
+  bool successful{ false };
+
+  /** @brief The planned program, this is empty if not successful */
+  CompositeInstruction program;
+
+  /** @brief The context of the job which holds its data storage and node infos */
+  std::shared_ptr<TaskComposerContext> context;
+
+  /** @brief The time from the start of the batch until the job was submitted to the executor in seconds */
+  double queue_time{ 0 };
+
+  /** @brief The time from submitting the job until it finished in seconds */
+  double elapsed_time{ 0 };
+};
+
+/** @brief The statistics of every node info sharing the same name */
+struct TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchNodeStatistics
+{
+  /** @brief The number of times the node ran */
+  std::size_t count{ 0 };
+
+  /** @brief The number of times the node was skipped because the job was aborted */
+  std::size_t aborted{ 0 };
+
+  /** @brief The total elapsed time in seconds */
+  double total_time{ 0 };
+
+  /** @brief The minimum elapsed time in seconds */
+  double min_time{ std::numeric_limits<double>::max() };
+
+  /** @brief The maximum elapsed time in seconds */
+  double max_time{ 0 };
+
+  /** @brief The average elapsed time in seconds */
+  double getAverageTime() const;
+};
+
+/** @brief The statistics aggregated over the jobs of a batch */
+struct TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchStatistics
+{
+  /** @brief The number of jobs */
+  std::size_t jobs{ 0 };
+
+  /** @brief The number of successful jobs */
+  std::size_t successful{ 0 };
+
+  /** @brief The number of failed jobs */
+  std::size_t failed{ 0 };
+
+  /** @brief The time from the start of the batch until the last job finished in seconds */
+  double wall_time{ 0 };
+
+  /** @brief The sum of the elapsed time of each job in seconds */
+  double total_elapsed_time{ 0 };
+
+  /** @brief The maximum elapsed time of a job in seconds */
+  double max_elapsed_time{ 0 };
+
+  /** @brief The node statistics by node name */
+  std::map<std::string, TaskComposerBatchNodeStatistics> nodes;
+
+  /**
+   * @brief Add the result of a job
+   * @param result The result
+   */
+  void add(const TaskComposerBatchResult& result);
+
+  /** @brief The number of jobs finished per second of wall time */
+  double getThroughput() const;
+};
+
+/** @brief The results of a batch in job order */
+struct TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchResults
+{
+  std::vector<TaskComposerBatchResult> results;
+  TaskComposerBatchStatistics statistics;
+};
+
+/**
+ * @brief Plans many independent programs with the same pipeline
+ * @details Running each program as its own request clones the environment for every program. The runner instead
+ * takes a single EnvironmentSnapshot shared by every job of the batch and runs the same pipeline node for each job,
+ * giving each job its own data storage holding the program, the environment and its profiles.
+ *
+ * At most the maximum concurrency jobs are submitted to the executor at a time and the next job is submitted as soon
+ * as one finishes. This keeps a large batch from flooding the executor queue, so other requests are not starved and
+ * the memory of pending jobs is bound. The calling thread waits on the jobs so it should not be an executor worker.
+ *
+ * The pipeline must have a 'planning_input' or 'program' input and a 'program' output, and read the environment and
+ * profiles from the ENVIRONMENT_KEY and PROFILES_KEY, which is the case for the pipelines of the default config.
+ */
+class TESSERACT_TASK_COMPOSER_PLANNING_NODES_EXPORT TaskComposerBatchRunner
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerBatchRunner>;
+  using ConstPtr = std::shared_ptr<const TaskComposerBatchRunner>;
+  using UPtr = std::unique_ptr<TaskComposerBatchRunner>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerBatchRunner>;
+
+  /** @brief The callback invoked on the calling thread as each job finishes */
+  using ResultCallback = std::function<void(TaskComposerBatchResult result)>;
+
+  static const std::string ENVIRONMENT_KEY;
+  static const std::string PROFILES_KEY;
+
+  /**
+   * @brief Constructor
+   * @param pipeline The pipeline run for each job
+   * @param executor The executor
+   * @param max_concurrency The maximum number of jobs submitted at a time, zero uses the executor's worker count
+   * @param priority The priority class the jobs are submitted with
+   */
+  TaskComposerBatchRunner(std::shared_ptr<const TaskComposerNode> pipeline,
+                          std::shared_ptr<TaskComposerExecutor> executor,
+                          std::size_t max_concurrency = 0,
+                          TaskComposerPriority priority = TaskComposerPriority::NORMAL);
+
+  /**
+   * @brief Constructor
+   * @param plugin_factory The plugin factory used to create the pipeline
+   * @param pipeline_name The name of the pipeline run for each job
+   * @param executor The executor
+   * @param max_concurrency The maximum number of jobs submitted at a time, zero uses the executor's worker count
+   * @param priority The priority class the jobs are submitted with
+   */
+  TaskComposerBatchRunner(const TaskComposerPluginFactory& plugin_factory,
+                          const std::string& pipeline_name,
+                          std::shared_ptr<TaskComposerExecutor> executor,
+                          std::size_t max_concurrency = 0,
+                          TaskComposerPriority priority = TaskComposerPriority::NORMAL);
+
+  /**
+   * @brief Plan the jobs and return the results in job order
+   * @param jobs The jobs
+   * @param env The environment shared by every job
+   * @return The results in job order and the statistics of the batch
+   */
+  TaskComposerBatchResults run(const std::vector<TaskComposerBatchJob>& jobs,
+                               const std::shared_ptr<const tesseract_environment::Environment>& env) const;
+
+  /**
+   * @brief Plan the jobs and provide each result as it finishes
+   * @param jobs The jobs
+   * @param env The environment shared by every job
+   * @param callback The callback invoked on the calling thread with each result in order of completion
+   * @return The statistics of the batch
+   */
+  TaskComposerBatchStatistics run(const std::vector<TaskComposerBatchJob>& jobs,
+                                  const std::shared_ptr<const tesseract_environment::Environment>& env,
+                                  const ResultCallback& callback) const;
+
+  /** @brief Get the maximum number of jobs submitted at a time */
+  std::size_t getMaxConcurrency() const;
+
+protected:
+  std::shared_ptr<const TaskComposerNode> pipeline_;
+  std::shared_ptr<TaskComposerExecutor> executor_;
+  std::size_t max_concurrency_;
+  TaskComposerPriority priority_;
+  std::string input_key_;
+  std::string output_key_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_BATCH_RUNNER_H
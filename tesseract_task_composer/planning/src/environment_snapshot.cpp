@@ -0,0 +1,262 @@
+/**
+ * @file environment_snapshot.cpp
+ * @brief An immutable, shared snapshot of an environment with per thread contact managers and state solvers
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/environment_snapshot.h>
+#include <tesseract_common/types.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_state_solver/state_solver.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+struct SnapshotCacheEntry
+{
+  std::weak_ptr<const tesseract_environment::Environment> source;
+  EnvironmentSnapshot::ConstPtr snapshot;
+};
+
+struct SnapshotCache
+{
+  std::mutex mutex;
+
+  /** @brief The latest snapshot of every live source environment */
+  std::vector<SnapshotCacheEntry> entries;
+
+  /** @brief Every live snapshot by its environment, so a snapshot environment maps back to its snapshot */
+  std::unordered_map<const tesseract_environment::Environment*, std::weak_ptr<const EnvironmentSnapshot>> snapshots;
+};
+
+SnapshotCache& getSnapshotCache()
+{
+  static SnapshotCache cache;
+  return cache;
+}
+}  // namespace
+
+/** @brief The configuration of a contact manager which is restored before it is handed out again */
+struct EnvironmentSnapshot::ManagerConfig
+{
+  template <typename ManagerType>
+  ManagerConfig(const ManagerType& manager, tesseract_common::TransformMap link_transforms)
+    : link_transforms(std::move(link_transforms))
+    , active_objects(manager.getActiveCollisionObjects())
+    , margin_data(manager.getCollisionMarginData())
+    , validator(manager.getContactAllowedValidator())
+  {
+    for (const auto& name : manager.getCollisionObjects())
+    {
+      if (!manager.isCollisionObjectEnabled(name))
+        disabled_objects.push_back(name);
+    }
+  }
+
+  template <typename ManagerType>
+  void apply(ManagerType& manager) const
+  {
+    manager.setCollisionObjectsTransform(link_transforms);
+    manager.setActiveCollisionObjects(active_objects);
+    manager.setCollisionMarginData(margin_data);
+    manager.setContactAllowedValidator(validator);
+    for (const auto& name : manager.getCollisionObjects())
+    {
+      if (std::find(disabled_objects.begin(), disabled_objects.end(), name) == disabled_objects.end())
+        manager.enableCollisionObject(name);
+      else
+        manager.disableCollisionObject(name);
+    }
+  }
+
+  tesseract_common::TransformMap link_transforms;
+  std::vector<std::string> active_objects;
+  std::vector<std::string> disabled_objects;
+  tesseract_collision::CollisionMarginData margin_data;
+  decltype(std::declval<const tesseract_collision::DiscreteContactManager&>().getContactAllowedValidator()) validator;
+};
+
+/** @brief The objects owned by a single thread */
+struct EnvironmentSnapshot::ThreadLocalData
+{
+  std::unique_ptr<tesseract_scene_graph::StateSolver> state_solver;
+  std::unique_ptr<tesseract_collision::DiscreteContactManager> discrete_manager;
+  std::unique_ptr<tesseract_collision::ContinuousContactManager> continuous_manager;
+};
+
+EnvironmentSnapshot::EnvironmentSnapshot(std::shared_ptr<const tesseract_environment::Environment> env)
+  : env_(std::move(env)), revision_(env_->getRevision()), joint_values_(env_->getState().joints)
+{
+}
+
+EnvironmentSnapshot::~EnvironmentSnapshot() = default;
+
+EnvironmentSnapshot::ConstPtr
+EnvironmentSnapshot::create(const std::shared_ptr<const tesseract_environment::Environment>& env)
+{
+  if (env == nullptr)
+    throw std::runtime_error("EnvironmentSnapshot, environment is a nullptr");
+
+  if (auto snapshot = find(env))
+    return snapshot;
+
+  // Clone outside of the lock so snapshots of other environments are not blocked
+  std::shared_ptr<const tesseract_environment::Environment> clone = env->clone();
+  EnvironmentSnapshot::ConstPtr snapshot(new EnvironmentSnapshot(std::move(clone)));
+
+  auto& cache = getSnapshotCache();
+  std::scoped_lock lock(cache.mutex);
+  auto& entries = cache.entries;
+  auto it = std::find_if(entries.begin(), entries.end(), [&env, &snapshot](const SnapshotCacheEntry& entry) {
+    return (entry.source.lock() == env && entry.snapshot->revision_ == snapshot->revision_ &&
+            entry.snapshot->joint_values_ == snapshot->joint_values_);
+  });
+  if (it != entries.end())
+    return it->snapshot;
+
+  // Only the latest snapshot of a source environment is kept alive by the cache
+  entries.erase(std::remove_if(entries.begin(),
+                               entries.end(),
+                               [&env](const SnapshotCacheEntry& entry) { return entry.source.lock() == env; }),
+                entries.end());
+  entries.push_back(SnapshotCacheEntry{ env, snapshot });
+
+  for (auto s_it = cache.snapshots.begin(); s_it != cache.snapshots.end();)
+    s_it = (s_it->second.expired()) ? cache.snapshots.erase(s_it) : std::next(s_it);
+  cache.snapshots[snapshot->env_.get()] = snapshot;
+  return snapshot;
+}
+
+EnvironmentSnapshot::ConstPtr
+EnvironmentSnapshot::find(const std::shared_ptr<const tesseract_environment::Environment>& env)
+{
+  if (env == nullptr)
+    return nullptr;
+
+  auto& cache = getSnapshotCache();
+  {
+    std::scoped_lock lock(cache.mutex);
+    auto it = cache.snapshots.find(env.get());
+    if (it != cache.snapshots.end())
+    {
+      if (auto snapshot = it->second.lock())
+        return snapshot;
+    }
+  }
+
+  const int revision = env->getRevision();
+  const auto joint_values = env->getState().joints;
+
+  std::scoped_lock lock(cache.mutex);
+  auto& entries = cache.entries;
+  entries.erase(std::remove_if(entries.begin(),
+                               entries.end(),
+                               [](const SnapshotCacheEntry& entry) { return entry.source.expired(); }),
+                entries.end());
+
+  auto matches = [&env, revision, &joint_values](const SnapshotCacheEntry& entry) {
+    return (entry.source.lock() == env && entry.snapshot->revision_ == revision &&
+            entry.snapshot->joint_values_ == joint_values);
+  };
+  auto it = std::find_if(entries.begin(), entries.end(), matches);
+  return (it != entries.end()) ? it->snapshot : nullptr;
+}
+
+std::shared_ptr<const tesseract_environment::Environment> EnvironmentSnapshot::getEnvironment() const
+{
+  // Share ownership with the snapshot so it can be found again from its environment
+  return { shared_from_this(), env_.get() };
+}
+
+int EnvironmentSnapshot::getRevision() const { return revision_; }
+
+tesseract_scene_graph::StateSolver& EnvironmentSnapshot::getStateSolver() const
+{
+  ThreadLocalData& data = getThreadLocalData();
+  if (data.state_solver == nullptr)
+    data.state_solver = env_->getStateSolver();
+  else
+    data.state_solver->setState(joint_values_);
+
+  return *data.state_solver;
+}
+
+tesseract_collision::DiscreteContactManager& EnvironmentSnapshot::getDiscreteContactManager() const
+{
+  ThreadLocalData& data = getThreadLocalData();
+  if (data.discrete_manager == nullptr)
+  {
+    data.discrete_manager = env_->getDiscreteContactManager();
+    std::scoped_lock lock(mutex_);
+    if (discrete_config_ == nullptr)
+      discrete_config_ = std::make_unique<ManagerConfig>(*data.discrete_manager, env_->getState().link_transforms);
+  }
+  else
+  {
+    discrete_config_->apply(*data.discrete_manager);
+  }
+
+  return *data.discrete_manager;
+}
+
+tesseract_collision::ContinuousContactManager& EnvironmentSnapshot::getContinuousContactManager() const
+{
+  ThreadLocalData& data = getThreadLocalData();
+  if (data.continuous_manager == nullptr)
+  {
+    data.continuous_manager = env_->getContinuousContactManager();
+    std::scoped_lock lock(mutex_);
+    if (continuous_config_ == nullptr)
+      continuous_config_ = std::make_unique<ManagerConfig>(*data.continuous_manager, env_->getState().link_transforms);
+  }
+  else
+  {
+    continuous_config_->apply(*data.continuous_manager);
+  }
+
+  return *data.continuous_manager;
+}
+
+EnvironmentSnapshot::ThreadLocalData& EnvironmentSnapshot::getThreadLocalData() const
+{
+  std::scoped_lock lock(mutex_);
+  auto& data = thread_data_[std::this_thread::get_id()];
+  if (data == nullptr)
+    data = std::make_unique<ThreadLocalData>();
+
+  return *data;
+}
+
+}  // namespace tesseract_planning
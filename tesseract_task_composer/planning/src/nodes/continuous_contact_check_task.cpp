@@ -43,6 +43,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 //#include <tesseract_process_managers/core/utils.h>
 #include <tesseract_task_composer/planning/nodes/continuous_contact_check_task.h>
+#include <tesseract_task_composer/planning/environment_snapshot.h>
 #include <tesseract_task_composer/planning/profiles/contact_check_profile.h>
 
 #include <tesseract_task_composer/core/task_composer_context.h>
@@ -143,14 +144,27 @@ ContinuousContactCheckTask::runImpl(TaskComposerContext& context, OptionalTaskCo
   // Get state solver
   tesseract_common::ManipulatorInfo manip_info = ci.getManipulatorInfo();
   tesseract_kinematics::JointGroup::ConstPtr manip = env->getJointGroup(manip_info.manipulator);
-  tesseract_scene_graph::StateSolver::UPtr state_solver = env->getStateSolver();
 
-  tesseract_collision::ContinuousContactManager::Ptr manager = env->getContinuousContactManager();
-  manager->setActiveCollisionObjects(manip->getActiveLinkNames());
-  manager->applyContactManagerConfig(cur_composite_profile->config.contact_manager_config);
+  // Reuse the state solver and contact manager of this thread if the environment already belongs to a snapshot, for
+  // example one shared by the raster tasks, otherwise create them from the environment without cloning it
+  tesseract_scene_graph::StateSolver::UPtr state_solver_ptr;
+  tesseract_collision::ContinuousContactManager::Ptr manager_ptr;
+  EnvironmentSnapshot::ConstPtr snapshot = EnvironmentSnapshot::find(env);
+  if (snapshot == nullptr)
+  {
+    state_solver_ptr = env->getStateSolver();
+    manager_ptr = env->getContinuousContactManager();
+  }
+  tesseract_scene_graph::StateSolver& state_solver =
+      (snapshot != nullptr) ? snapshot->getStateSolver() : *state_solver_ptr;
+  tesseract_collision::ContinuousContactManager& manager =
+      (snapshot != nullptr) ? snapshot->getContinuousContactManager() : *manager_ptr;
+
+  manager.setActiveCollisionObjects(manip->getActiveLinkNames());
+  manager.applyContactManagerConfig(cur_composite_profile->config.contact_manager_config);
 
   std::vector<tesseract_collision::ContactResultMap> contacts;
-  if (contactCheckProgram(contacts, *manager, *state_solver, ci, cur_composite_profile->config))
+  if (contactCheckProgram(contacts, manager, state_solver, ci, cur_composite_profile->config))
   {
     info->status_code = 0;
     info->status_message = "Results are not contact free for process input: " + ci.getDescription();
@@ -145,11 +145,13 @@ std::unique_ptr<TaskComposerNodeInfo> MinLengthTask::runImpl(TaskComposerContext
     auto profile = std::make_shared<SimplePlannerFixedSizePlanProfile>(subdivisions, subdivisions);
 
     // Create profile dictionary
-    auto simple_profiles = std::make_shared<ProfileDictionary>();
-    simple_profiles->addProfile(planner.getName(), ci.getProfile(), profile);
+    std::vector<std::string> profile_names{ ci.getProfile() };
     auto flat = ci.flatten(&moveFilter);
     for (const auto& i : flat)
-      simple_profiles->addProfile(planner.getName(), i.get().as<MoveInstructionPoly>().getProfile(), profile);
+      profile_names.push_back(i.get().as<MoveInstructionPoly>().getProfile());
+
+    auto simple_profiles = std::make_shared<ProfileDictionary>();
+    simple_profiles->addProfile(planner.getName(), profile_names, profile);
 
     // Assign profile dictionary
     request.profiles = simple_profiles;
@@ -164,11 +166,11 @@ std::unique_ptr<TaskComposerNodeInfo> MinLengthTask::runImpl(TaskComposerContext
       return info;
     }
 
-    setData(*context.data_storage, INOUT_PROGRAM_PORT, response.results);
+    setData(*context.data_storage, INOUT_PROGRAM_PORT, std::move(response.results));
   }
   else
   {
-    setData(*context.data_storage, INOUT_PROGRAM_PORT, ci);
+    setData(*context.data_storage, INOUT_PROGRAM_PORT, std::move(input_data_poly));
   }
 
   info->color = "green";
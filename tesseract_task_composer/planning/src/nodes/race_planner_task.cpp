@@ -0,0 +1,281 @@
+/**
+ * @file race_planner_task.cpp
+ * @brief Race several planner tasks on the same program and keep the first valid result
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <typeindex>
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+
+#include <tesseract_common/serialization.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/nodes/race_planner_task.h>
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+#include <tesseract_command_language/composite_instruction.h>
+
+namespace
+{
+/** @brief The contenders which have finished, in order of completion */
+struct RaceState
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::size_t> finished;
+};
+}  // namespace
+
+namespace tesseract_planning
+{
+// Requried
+const std::string RacePlannerTask::INOUT_PROGRAM_PORT = "program";
+
+RacePlannerTask::RacePlannerTask() : TaskComposerTask("RacePlannerTask", RacePlannerTask::ports(), true) {}
+RacePlannerTask::RacePlannerTask(std::string name,
+                                 std::string input_program_key,
+                                 std::string output_program_key,
+                                 bool conditional,
+                                 std::vector<TaskFactory> contender_task_factories,
+                                 TaskFactory validator_task_factory)
+  : TaskComposerTask(std::move(name), RacePlannerTask::ports(), conditional)
+  , contender_task_factories_(std::move(contender_task_factories))
+  , validator_task_factory_(std::move(validator_task_factory))
+{
+  if (contender_task_factories_.empty())
+    throw std::runtime_error("RacePlannerTask, at least one contender is required");
+
+  input_keys_.add(INOUT_PROGRAM_PORT, std::move(input_program_key));
+  output_keys_.add(INOUT_PROGRAM_PORT, std::move(output_program_key));
+  validatePorts();
+}
+
+RacePlannerTask::RacePlannerTask(std::string name,
+                                 const YAML::Node& config,
+                                 const TaskComposerPluginFactory& plugin_factory)
+  : TaskComposerTask(std::move(name), RacePlannerTask::ports(), config)
+{
+  if (YAML::Node contenders_config = config["contenders"])
+  {
+    if (!contenders_config.IsSequence())
+      throw std::runtime_error("RacePlannerTask, entry 'contenders' is not a sequence");
+
+    for (std::size_t i = 0; i < contenders_config.size(); ++i)
+    {
+      contender_task_factories_.push_back(createPlannerTaskFactory("RacePlannerTask",
+                                                                   "contenders[" + std::to_string(i) + "]",
+                                                                   contenders_config[i],
+                                                                   plugin_factory,
+                                                                   INOUT_PROGRAM_PORT));
+    }
+  }
+  else
+  {
+    throw std::runtime_error("RacePlannerTask: missing 'contenders' entry");
+  }
+
+  if (contender_task_factories_.empty())
+    throw std::runtime_error("RacePlannerTask, at least one contender is required");
+
+  if (YAML::Node validator_config = config["validator"])
+    validator_task_factory_ =
+        createPlannerTaskFactory("RacePlannerTask", "validator", validator_config, plugin_factory, INOUT_PROGRAM_PORT);
+}
+
+TaskComposerNodePorts RacePlannerTask::ports()
+{
+  TaskComposerNodePorts ports;
+  ports.input_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
+  ports.output_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
+  return ports;
+}
+
+bool RacePlannerTask::operator==(const RacePlannerTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
+bool RacePlannerTask::operator!=(const RacePlannerTask& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void RacePlannerTask::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerTask);
+}
+
+std::unique_ptr<TaskComposerNodeInfo> RacePlannerTask::runImpl(TaskComposerContext& context,
+                                                               OptionalTaskComposerExecutor executor) const
+{
+  auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+  info->return_value = 0;
+  info->status_code = 0;
+
+  // --------------------
+  // Check that inputs are valid
+  // --------------------
+  auto input_data_poly = getData(*context.data_storage, INOUT_PROGRAM_PORT);
+  if (input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  {
+    info->status_message = "Input instruction to RacePlannerTask must be a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+    return info;
+  }
+
+  if (!executor.has_value())
+  {
+    info->status_message = "RacePlannerTask requires an executor";
+    CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+    return info;
+  }
+
+  struct Contender
+  {
+    std::shared_ptr<TaskComposerNode> node;
+    std::string output_key;
+    TaskComposerFuture::UPtr future;
+    bool finished{ false };
+  };
+
+  // Launch every contender on its own copy of the data storage. The completion callback owns the node so it outlives
+  // the contender when it is left running in the background.
+  auto state = std::make_shared<RaceState>();
+  std::vector<Contender> contenders;
+  contenders.reserve(contender_task_factories_.size());
+  for (std::size_t i = 0; i < contender_task_factories_.size(); ++i)
+  {
+    TaskFactoryResults tf_results = contender_task_factories_[i]("Contender" + std::to_string(i), i);
+
+    auto data_storage = std::make_shared<TaskComposerDataStorage>(*context.data_storage);
+    data_storage->setData(tf_results.input_key, input_data_poly);
+
+    Contender contender;
+    contender.node = std::move(tf_results.node);
+    contender.output_key = tf_results.output_key;
+
+    contender.future = executor.value().get().run(*contender.node, std::move(data_storage), context);
+    contender.future->then(
+        [state, node = contender.node, i](const std::shared_ptr<TaskComposerContext>& /*context*/) mutable {
+          node.reset();
+          std::unique_lock<std::mutex> lock(state->mutex);
+          state->finished.push_back(i);
+          state->cv.notify_all();
+        });
+    contenders.push_back(std::move(contender));
+  }
+
+  // Take the contenders in order of completion until one passes validation
+  std::optional<std::size_t> winner;
+  std::vector<std::string> rejected;
+  for (std::size_t remaining = contenders.size(); remaining > 0 && !winner.has_value(); --remaining)
+  {
+    std::size_t index{ 0 };
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->cv.wait(lock, [&state] { return !state->finished.empty(); });
+      index = state->finished.front();
+      state->finished.pop_front();
+    }
+
+    Contender& contender = contenders[index];
+    contender.finished = true;
+    const TaskComposerContext& contender_context = *contender.future->context;
+    if (!isPlannerTaskSuccessful(*contender.node, contender_context))
+    {
+      rejected.push_back(contender.node->getName() + " failed");
+      continue;
+    }
+
+    auto output_data_poly = contender_context.data_storage->getData(contender.output_key);
+    if (output_data_poly.isNull())
+    {
+      rejected.push_back(contender.node->getName() + " has no output");
+      continue;
+    }
+
+    if (validator_task_factory_)
+    {
+      TaskFactoryResults validator = validator_task_factory_("Validator" + std::to_string(index), index);
+      contender_context.data_storage->setData(validator.input_key, output_data_poly);
+
+      TaskComposerFuture::UPtr validator_future =
+          executor.value().get().run(*validator.node, contender_context.data_storage, context);
+      validator_future->wait();
+
+      const bool valid = isPlannerTaskSuccessful(*validator.node, *validator_future->context);
+      context.task_infos.mergeInfoMap(std::move(validator_future->context->task_infos));
+      if (!valid)
+      {
+        rejected.push_back(contender.node->getName() + " failed validation");
+        continue;
+      }
+    }
+
+    winner = index;
+  }
+
+  // Cooperatively abort the contenders still running, they stop at their next node and are not waited on
+  for (auto& contender : contenders)
+  {
+    if (contender.finished)
+      context.task_infos.mergeInfoMap(std::move(contender.future->context->task_infos));
+    else
+      contender.future->context->abort();
+  }
+
+  info->data_storage.setData("contenders", static_cast<int>(contenders.size()));
+  if (!winner.has_value())
+  {
+    info->status_message = "RacePlannerTask, no contender succeeded:";
+    for (const auto& reason : rejected)
+      info->status_message += " '" + reason + "'";
+    CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+    return info;
+  }
+
+  const Contender& contender = contenders[winner.value()];
+  setData(*context.data_storage,
+          INOUT_PROGRAM_PORT,
+          contender.future->context->data_storage->getData(contender.output_key));
+
+  info->data_storage.setData("winner", contender.node->getName());
+  info->data_storage.setData("winner_index", static_cast<int>(winner.value()));
+  info->color = "green";
+  info->status_code = 1;
+  info->status_message = "Successful, won by " + contender.node->getName();
+  info->return_value = 1;
+  return info;
+}
+
+}  // namespace tesseract_planning
+
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::RacePlannerTask)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::RacePlannerTask)
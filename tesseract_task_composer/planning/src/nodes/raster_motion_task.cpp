@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/planning/nodes/raster_motion_task.h>
+#include <tesseract_task_composer/planning/environment_snapshot.h>
 #include <tesseract_task_composer/planning/nodes/update_start_and_end_state_task.h>
 #include <tesseract_task_composer/planning/nodes/update_end_state_task.h>
 #include <tesseract_task_composer/planning/nodes/update_start_state_task.h>
@@ -45,6 +46,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 #include <tesseract_task_composer/core/task_composer_graph.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_output_channel.h>
 
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_environment/environment.h>
@@ -89,6 +91,92 @@ createTask(const std::string& name,
 
   return tf_results;
 }
+
+/** @brief Publishes a planned segment of the raster program to the segment channel */
+class RasterSegmentPublishTask : public tesseract_planning::TaskComposerTask
+{
+public:
+  RasterSegmentPublishTask(std::string name,
+                           std::string input_program_key,
+                           std::shared_ptr<tesseract_planning::TaskComposerOutputChannel> channel,
+                           std::size_t index,
+                           bool erase_start)
+    : TaskComposerTask(std::move(name), RasterSegmentPublishTask::ports(), false)
+    , channel_(std::move(channel))
+    , index_(index)
+    , erase_start_(erase_start)
+  {
+    input_keys_.add(INPUT_PROGRAM_PORT, std::move(input_program_key));
+    validatePorts();
+  }
+
+protected:
+  static const std::string INPUT_PROGRAM_PORT;
+
+  std::shared_ptr<tesseract_planning::TaskComposerOutputChannel> channel_;
+  std::size_t index_;
+  bool erase_start_;
+
+  static tesseract_planning::TaskComposerNodePorts ports()
+  {
+    tesseract_planning::TaskComposerNodePorts ports;
+    ports.input_required[INPUT_PROGRAM_PORT] = tesseract_planning::TaskComposerNodePorts::SINGLE;
+    return ports;
+  }
+
+  std::unique_ptr<tesseract_planning::TaskComposerNodeInfo>
+  runImpl(tesseract_planning::TaskComposerContext& context,
+          tesseract_planning::OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    auto info = std::make_unique<tesseract_planning::TaskComposerNodeInfo>(*this);
+    info->return_value = 0;
+    info->status_code = 0;
+
+    // After an abort the segment may hold an unplanned program written by the state update tasks, so nothing more is
+    // published and the consumer is released right away instead of when the remaining tasks finish
+    if (context.isAborted())
+    {
+      channel_->close();
+      info->status_message = "Raster was aborted";
+      return info;
+    }
+
+    // The segment is missing if it failed to plan, which leaves a gap the channel never delivers past
+    auto input_data_poly = getData(*context.data_storage, INPUT_PROGRAM_PORT, false);
+    if (input_data_poly.isNull() ||
+        input_data_poly.getType() != std::type_index(typeid(tesseract_planning::CompositeInstruction)))
+    {
+      info->status_message = "Segment is not available";
+      return info;
+    }
+
+    auto segment = input_data_poly.as<tesseract_planning::CompositeInstruction>();
+    if (erase_start_)
+      segment.erase(segment.begin());
+
+    channel_->publish(index_, segment);
+
+    info->color = "green";
+    info->status_code = 1;
+    info->status_message = "Successful";
+    info->return_value = 1;
+    return info;
+  }
+};
+
+const std::string RasterSegmentPublishTask::INPUT_PROGRAM_PORT = "program";
+
+/** @brief Closes the segment channel when going out of scope so the consumer is never left waiting */
+struct RasterSegmentChannelCloser
+{
+  std::shared_ptr<tesseract_planning::TaskComposerOutputChannel> channel;
+
+  ~RasterSegmentChannelCloser()
+  {
+    if (channel != nullptr)
+      channel->close();
+  }
+};
 }  // namespace
 
 namespace tesseract_planning
@@ -97,6 +185,9 @@ namespace tesseract_planning
 const std::string RasterMotionTask::INOUT_PROGRAM_PORT = "program";
 const std::string RasterMotionTask::INPUT_ENVIRONMENT_PORT = "environment";
 
+// Optional
+const std::string RasterMotionTask::INPUT_SEGMENT_CHANNEL_PORT = "segment_channel";
+
 RasterMotionTask::RasterMotionTask() : TaskComposerTask("RasterMotionTask", RasterMotionTask::ports(), true) {}
 RasterMotionTask::RasterMotionTask(std::string name,
                                    std::string input_program_key,
@@ -105,7 +196,8 @@ RasterMotionTask::RasterMotionTask(std::string name,
                                    bool conditional,
                                    TaskFactory freespace_task_factory,
                                    TaskFactory raster_task_factory,
-                                   TaskFactory transition_task_factory)
+                                   TaskFactory transition_task_factory,
+                                   std::string input_segment_channel_key)
   : TaskComposerTask(std::move(name), RasterMotionTask::ports(), conditional)
   , freespace_task_factory_(std::move(freespace_task_factory))
   , raster_task_factory_(std::move(raster_task_factory))
@@ -113,6 +205,9 @@ RasterMotionTask::RasterMotionTask(std::string name,
 {
   input_keys_.add(INOUT_PROGRAM_PORT, std::move(input_program_key));
   input_keys_.add(INPUT_ENVIRONMENT_PORT, std::move(input_environment_key));
+  if (!input_segment_channel_key.empty())
+    input_keys_.add(INPUT_SEGMENT_CHANNEL_PORT, std::move(input_segment_channel_key));
+
   output_keys_.add(INOUT_PROGRAM_PORT, std::move(output_program_key));
   validatePorts();
 }
@@ -332,6 +427,7 @@ TaskComposerNodePorts RasterMotionTask::ports()
   TaskComposerNodePorts ports;
   ports.input_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
   ports.input_required[INPUT_ENVIRONMENT_PORT] = TaskComposerNodePorts::SINGLE;
+  ports.input_optional[INPUT_SEGMENT_CHANNEL_PORT] = TaskComposerNodePorts::SINGLE;
 
   ports.output_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
   return ports;
@@ -366,9 +462,9 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
     return info;
   }
 
-  std::shared_ptr<const tesseract_environment::Environment> env =
-      env_poly.as<std::shared_ptr<const tesseract_environment::Environment>>()->clone();
-  info->data_storage.setData("environment", env);
+  // Every raster job of an unchanged environment shares the same snapshot instead of its own clone
+  auto snapshot = EnvironmentSnapshot::create(env_poly.as<std::shared_ptr<const tesseract_environment::Environment>>());
+  info->data_storage.setData("environment", snapshot->getEnvironment());
 
   auto input_data_poly = getData(*context.data_storage, INOUT_PROGRAM_PORT);
   try
@@ -384,6 +480,20 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
   auto& program = input_data_poly.template as<CompositeInstruction>();
   tesseract_common::ManipulatorInfo program_manip_info = program.getManipulatorInfo();
 
+  std::shared_ptr<TaskComposerOutputChannel> segment_channel;
+  auto segment_channel_poly = getData(*context.data_storage, INPUT_SEGMENT_CHANNEL_PORT, false);
+  if (!segment_channel_poly.isNull())
+  {
+    if (segment_channel_poly.getType() != std::type_index(typeid(std::shared_ptr<TaskComposerOutputChannel>)))
+    {
+      info->status_message = "Input data '" + input_keys_.get(INPUT_SEGMENT_CHANNEL_PORT) + "' is not correct type";
+      CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+      return info;
+    }
+    segment_channel = segment_channel_poly.as<std::shared_ptr<TaskComposerOutputChannel>>();
+  }
+  RasterSegmentChannelCloser segment_channel_closer{ segment_channel };
+
   TaskComposerGraph task_graph;
 
   // Start Task
@@ -420,6 +530,13 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
 
     task_graph.addEdges(start_uuid, { raster_uuid });
 
+    if (segment_channel != nullptr)
+    {
+      auto publish_task = std::make_unique<RasterSegmentPublishTask>(
+          "PublishRasterSegmentTask", raster_results.output_key, segment_channel, idx, true);
+      task_graph.addEdges(raster_uuid, { task_graph.addNode(std::move(publish_task)) });
+    }
+
     raster_idx++;
   }
 
@@ -468,6 +585,13 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
     task_graph.addEdges(prev.first, { transition_mux_uuid });
     task_graph.addEdges(next.first, { transition_mux_uuid });
 
+    if (segment_channel != nullptr)
+    {
+      auto publish_task = std::make_unique<RasterSegmentPublishTask>(
+          "PublishTransitionSegmentTask", transition_results.output_key, segment_channel, idx, true);
+      task_graph.addEdges(transition_uuid, { task_graph.addNode(std::move(publish_task)) });
+    }
+
     transition_idx++;
   }
 
@@ -491,6 +615,13 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
   task_graph.addEdges(update_end_state_uuid, { from_start_pipeline_uuid });
   task_graph.addEdges(raster_tasks[0].first, { update_end_state_uuid });
 
+  if (segment_channel != nullptr)
+  {
+    auto publish_task = std::make_unique<RasterSegmentPublishTask>(
+        "PublishFromStartSegmentTask", from_start_results.output_key, segment_channel, 0, false);
+    task_graph.addEdges(from_start_pipeline_uuid, { task_graph.addNode(std::move(publish_task)) });
+  }
+
   // Plan to_end - preceded by the last raster
   auto to_end_input = program.back().template as<CompositeInstruction>();
   to_end_input.setManipulatorInfo(to_end_input.getManipulatorInfo().getCombined(program_manip_info));
@@ -516,9 +647,20 @@ std::unique_ptr<TaskComposerNodeInfo> RasterMotionTask::runImpl(TaskComposerCont
   task_graph.addEdges(update_start_state_uuid, { to_end_pipeline_uuid });
   task_graph.addEdges(raster_tasks.back().first, { update_start_state_uuid });
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context.data_storage, context.dotgraph);
+  if (segment_channel != nullptr)
+  {
+    auto publish_task = std::make_unique<RasterSegmentPublishTask>(
+        "PublishToEndSegmentTask", to_end_results.output_key, segment_channel, program.size() - 1, true);
+    task_graph.addEdges(to_end_pipeline_uuid, { task_graph.addNode(std::move(publish_task)) });
+  }
+
+  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context);
   future->wait();
 
+  // Every planned segment has been published, so close the channel to signal there are no more coming
+  if (segment_channel != nullptr)
+    segment_channel->close();
+
   // Merge child context data into parent context
   context.task_infos.mergeInfoMap(std::move(future->context->task_infos));
   if (future->context->isAborted())
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/planning/nodes/raster_only_motion_task.h>
+#include <tesseract_task_composer/planning/environment_snapshot.h>
 #include <tesseract_task_composer/planning/nodes/update_start_and_end_state_task.h>
 #include <tesseract_task_composer/planning/nodes/update_end_state_task.h>
 #include <tesseract_task_composer/planning/nodes/update_start_state_task.h>
@@ -307,9 +308,9 @@ std::unique_ptr<TaskComposerNodeInfo> RasterOnlyMotionTask::runImpl(TaskComposer
     return info;
   }
 
-  std::shared_ptr<const tesseract_environment::Environment> env =
-      env_poly.as<std::shared_ptr<const tesseract_environment::Environment>>()->clone();
-  info->data_storage.setData("environment", env);
+  // Every raster job of an unchanged environment shares the same snapshot instead of its own clone
+  auto snapshot = EnvironmentSnapshot::create(env_poly.as<std::shared_ptr<const tesseract_environment::Environment>>());
+  info->data_storage.setData("environment", snapshot->getEnvironment());
 
   auto input_data_poly = getData(*context.data_storage, INOUT_PROGRAM_PORT);
   try
@@ -415,7 +416,7 @@ std::unique_ptr<TaskComposerNodeInfo> RasterOnlyMotionTask::runImpl(TaskComposer
     transition_idx++;
   }
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context.data_storage, context.dotgraph);
+  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context);
   future->wait();
 
   // Merge child context data into parent context
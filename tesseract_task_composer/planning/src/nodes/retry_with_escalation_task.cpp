@@ -0,0 +1,416 @@
+/**
+ * @file retry_with_escalation_task.cpp
+ * @brief Retry a planner task with escalated profiles until it succeeds
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <typeindex>
+#include <console_bridge/console.h>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include <tesseract_common/serialization.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/nodes/retry_with_escalation_task.h>
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+#include <tesseract_common/utils.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+
+namespace
+{
+/** @brief The shared profile statistics tables by statistics key */
+struct ProfileStatisticsRegistry
+{
+  std::mutex mutex;
+  std::map<std::string, tesseract_planning::RetryWithEscalationTask::ProfileStatisticsTable::Ptr> tables;
+};
+
+ProfileStatisticsRegistry& getProfileStatisticsRegistry()
+{
+  static ProfileStatisticsRegistry registry;
+  return registry;
+}
+
+/** @brief Override the profile of the namespaces for the composite and every instruction it contains */
+void overrideProfiles(tesseract_planning::CompositeInstruction& composite,
+                      const std::vector<std::string>& namespaces,
+                      const std::string& profile)
+{
+  tesseract_planning::ProfileOverrides overrides = composite.getProfileOverrides();
+  for (const auto& ns : namespaces)
+    overrides[ns] = profile;
+  composite.setProfileOverrides(overrides);
+
+  for (auto& instruction : composite)
+  {
+    if (instruction.isCompositeInstruction())
+    {
+      overrideProfiles(instruction.as<tesseract_planning::CompositeInstruction>(), namespaces, profile);
+    }
+    else if (instruction.isMoveInstruction())
+    {
+      auto& move_instruction = instruction.as<tesseract_planning::MoveInstructionPoly>();
+      tesseract_planning::ProfileOverrides move_overrides = move_instruction.getProfileOverrides();
+      tesseract_planning::ProfileOverrides path_overrides = move_instruction.getPathProfileOverrides();
+      for (const auto& ns : namespaces)
+      {
+        move_overrides[ns] = profile;
+        path_overrides[ns] = profile;
+      }
+      move_instruction.setProfileOverrides(move_overrides);
+      move_instruction.setPathProfileOverrides(path_overrides);
+    }
+  }
+}
+}  // namespace
+
+namespace tesseract_planning
+{
+// Requried
+const std::string RetryWithEscalationTask::INOUT_PROGRAM_PORT = "program";
+
+double RetryWithEscalationTask::ProfileStatistics::getSuccessRate() const
+{
+  return (static_cast<double>(successes) + 1.0) / (static_cast<double>(attempts) + 2.0);
+}
+
+void RetryWithEscalationTask::ProfileStatisticsTable::record(const std::string& profile, bool successful)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto& statistics = statistics_[profile];
+  ++statistics.attempts;
+  if (successful)
+    ++statistics.successes;
+}
+
+std::map<std::string, RetryWithEscalationTask::ProfileStatistics>
+RetryWithEscalationTask::ProfileStatisticsTable::get() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return statistics_;
+}
+
+void RetryWithEscalationTask::ProfileStatisticsTable::clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  statistics_.clear();
+}
+
+RetryWithEscalationTask::RetryWithEscalationTask()
+  : TaskComposerTask("RetryWithEscalationTask", RetryWithEscalationTask::ports(), true)
+{
+}
+RetryWithEscalationTask::RetryWithEscalationTask(std::string name,
+                                                 std::string input_program_key,
+                                                 std::string output_program_key,
+                                                 bool conditional,
+                                                 TaskFactory task_factory,
+                                                 std::vector<std::string> namespaces,
+                                                 std::vector<std::string> profiles,
+                                                 double attempt_timeout,
+                                                 double budget,
+                                                 bool adaptive,
+                                                 ProfileStatisticsTable::Ptr statistics)
+  : TaskComposerTask(std::move(name), RetryWithEscalationTask::ports(), conditional)
+  , task_factory_(std::move(task_factory))
+  , namespaces_(std::move(namespaces))
+  , profiles_(std::move(profiles))
+  , attempt_timeout_(attempt_timeout)
+  , budget_(budget)
+  , adaptive_(adaptive)
+  , statistics_(std::move(statistics))
+{
+  if (!task_factory_)
+    throw std::runtime_error("RetryWithEscalationTask, the task factory is required");
+
+  if (namespaces_.empty())
+    throw std::runtime_error("RetryWithEscalationTask, at least one profile namespace is required");
+
+  if (profiles_.empty())
+    throw std::runtime_error("RetryWithEscalationTask, at least one profile is required");
+
+  if (attempt_timeout_ < 0 || budget_ < 0)
+    throw std::runtime_error("RetryWithEscalationTask, 'attempt_timeout' and 'budget' must not be negative");
+
+  input_keys_.add(INOUT_PROGRAM_PORT, std::move(input_program_key));
+  output_keys_.add(INOUT_PROGRAM_PORT, std::move(output_program_key));
+  validatePorts();
+}
+
+RetryWithEscalationTask::RetryWithEscalationTask(std::string name,
+                                                 const YAML::Node& config,
+                                                 const TaskComposerPluginFactory& plugin_factory)
+  : TaskComposerTask(std::move(name), RetryWithEscalationTask::ports(), config)
+{
+  task_factory_ =
+      createPlannerTaskFactory("RetryWithEscalationTask", name_, config, plugin_factory, INOUT_PROGRAM_PORT);
+
+  if (YAML::Node n = config["class"])
+    wrapped_task_ = n.as<std::string>();
+  else if (YAML::Node n = config["task"])
+    wrapped_task_ = n.as<std::string>();
+
+  if (YAML::Node n = config["namespaces"])
+    namespaces_ = n.as<std::vector<std::string>>();
+  else
+    throw std::runtime_error("RetryWithEscalationTask: missing 'namespaces' entry");
+
+  if (YAML::Node n = config["profiles"])
+    profiles_ = n.as<std::vector<std::string>>();
+  else
+    throw std::runtime_error("RetryWithEscalationTask: missing 'profiles' entry");
+
+  if (YAML::Node n = config["attempt_timeout"])
+    attempt_timeout_ = n.as<double>();
+
+  if (YAML::Node n = config["budget"])
+    budget_ = n.as<double>();
+
+  if (YAML::Node n = config["adaptive"])
+    adaptive_ = n.as<bool>();
+
+  if (namespaces_.empty())
+    throw std::runtime_error("RetryWithEscalationTask, at least one profile namespace is required");
+
+  if (profiles_.empty())
+    throw std::runtime_error("RetryWithEscalationTask, at least one profile is required");
+
+  if (attempt_timeout_ < 0 || budget_ < 0)
+    throw std::runtime_error("RetryWithEscalationTask, 'attempt_timeout' and 'budget' must not be negative");
+}
+
+TaskComposerNodePorts RetryWithEscalationTask::ports()
+{
+  TaskComposerNodePorts ports;
+  ports.input_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
+  ports.output_required[INOUT_PROGRAM_PORT] = TaskComposerNodePorts::SINGLE;
+  return ports;
+}
+
+std::vector<std::string> RetryWithEscalationTask::getAttemptOrder() const
+{
+  std::vector<std::string> order = profiles_;
+  if (!adaptive_)
+    return order;
+
+  const std::map<std::string, ProfileStatistics> statistics = getProfileStatistics();
+  const auto getSuccessRate = [&statistics](const std::string& profile) {
+    auto it = statistics.find(profile);
+    return (it == statistics.end()) ? ProfileStatistics().getSuccessRate() : it->second.getSuccessRate();
+  };
+
+  std::stable_sort(order.begin(), order.end(), [&getSuccessRate](const std::string& lhs, const std::string& rhs) {
+    return getSuccessRate(lhs) > getSuccessRate(rhs);
+  });
+  return order;
+}
+
+std::string RetryWithEscalationTask::getStatisticsKey() const
+{
+  std::string key = name_ + "/" + wrapped_task_ + "/";
+  for (std::size_t i = 0; i < namespaces_.size(); ++i)
+    key += ((i == 0) ? "" : ",") + namespaces_[i];
+
+  return key;
+}
+
+RetryWithEscalationTask::ProfileStatisticsTable::Ptr RetryWithEscalationTask::getProfileStatisticsTable() const
+{
+  if (statistics_ != nullptr)
+    return statistics_;
+
+  ProfileStatisticsRegistry& registry = getProfileStatisticsRegistry();
+  std::unique_lock<std::mutex> lock(registry.mutex);
+  auto& table = registry.tables[getStatisticsKey()];
+  if (table == nullptr)
+    table = std::make_shared<ProfileStatisticsTable>();
+
+  return table;
+}
+
+std::map<std::string, RetryWithEscalationTask::ProfileStatistics> RetryWithEscalationTask::getProfileStatistics() const
+{
+  return getProfileStatisticsTable()->get();
+}
+
+void RetryWithEscalationTask::clearProfileStatistics()
+{
+  ProfileStatisticsRegistry& registry = getProfileStatisticsRegistry();
+  std::unique_lock<std::mutex> lock(registry.mutex);
+  registry.tables.clear();
+}
+
+bool RetryWithEscalationTask::operator==(const RetryWithEscalationTask& rhs) const
+{
+  bool equal = true;
+  equal &= (namespaces_ == rhs.namespaces_);
+  equal &= (profiles_ == rhs.profiles_);
+  equal &= tesseract_common::almostEqualRelativeAndAbs(attempt_timeout_, rhs.attempt_timeout_);
+  equal &= tesseract_common::almostEqualRelativeAndAbs(budget_, rhs.budget_);
+  equal &= (adaptive_ == rhs.adaptive_);
+  equal &= (wrapped_task_ == rhs.wrapped_task_);
+  equal &= TaskComposerTask::operator==(rhs);
+  return equal;
+}
+bool RetryWithEscalationTask::operator!=(const RetryWithEscalationTask& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void RetryWithEscalationTask::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerTask);
+  ar& boost::serialization::make_nvp("namespaces", namespaces_);
+  ar& boost::serialization::make_nvp("profiles", profiles_);
+  ar& boost::serialization::make_nvp("attempt_timeout", attempt_timeout_);
+  ar& boost::serialization::make_nvp("budget", budget_);
+  ar& boost::serialization::make_nvp("adaptive", adaptive_);
+  ar& boost::serialization::make_nvp("wrapped_task", wrapped_task_);
+}
+
+std::unique_ptr<TaskComposerNodeInfo> RetryWithEscalationTask::runImpl(TaskComposerContext& context,
+                                                                       OptionalTaskComposerExecutor executor) const
+{
+  auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+  info->return_value = 0;
+  info->status_code = 0;
+
+  // --------------------
+  // Check that inputs are valid
+  // --------------------
+  auto input_data_poly = getData(*context.data_storage, INOUT_PROGRAM_PORT);
+  if (input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  {
+    info->status_message = "Input instruction to RetryWithEscalationTask must be a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+    return info;
+  }
+
+  if (!executor.has_value())
+  {
+    info->status_message = "RetryWithEscalationTask requires an executor";
+    CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+    return info;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const ProfileStatisticsTable::Ptr statistics = getProfileStatisticsTable();
+  const std::vector<std::string> order = getAttemptOrder();
+  std::vector<std::string> rejected;
+  int attempts{ 0 };
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    const std::string& profile = order[i];
+
+    // The deadline of the attempt is its own timeout limited by what is left of the budget
+    std::optional<std::chrono::duration<double>> timeout;
+    if (attempt_timeout_ > 0)
+      timeout = std::chrono::duration<double>(attempt_timeout_);
+
+    if (budget_ > 0)
+    {
+      const std::chrono::duration<double> remaining =
+          std::chrono::duration<double>(budget_) - (std::chrono::steady_clock::now() - start);
+      if (remaining.count() <= 0)
+      {
+        rejected.push_back("budget exhausted before '" + profile + "'");
+        break;
+      }
+
+      if (!timeout.has_value() || remaining < timeout.value())
+        timeout = remaining;
+    }
+
+    CompositeInstruction program = input_data_poly.as<CompositeInstruction>();
+    overrideProfiles(program, namespaces_, profile);
+
+    TaskFactoryResults tf_results = task_factory_("Attempt" + std::to_string(i) + ": " + profile, i);
+    auto data_storage = std::make_shared<TaskComposerDataStorage>(*context.data_storage);
+    data_storage->setData(tf_results.input_key, program);
+
+    // The completion callback owns the node so it outlives an attempt which is left running past its deadline
+    std::shared_ptr<TaskComposerNode> node = std::move(tf_results.node);
+    TaskComposerFuture::UPtr future = executor.value().get().run(*node, std::move(data_storage), context);
+    future->then([node](const std::shared_ptr<TaskComposerContext>& /*context*/) mutable { node.reset(); });
+    ++attempts;
+
+    if (!timeout.has_value())
+      future->wait();
+    else if (future->waitFor(timeout.value()) != std::future_status::ready)
+    {
+      // Cooperatively abort the attempt, it stops at its next node and is not waited on
+      future->context->abort();
+      statistics->record(profile, false);
+      rejected.push_back("'" + profile + "' timed out");
+      continue;
+    }
+
+    const TaskComposerContext& attempt_context = *future->context;
+    auto output_data_poly = attempt_context.data_storage->getData(tf_results.output_key);
+    const bool successful = isPlannerTaskSuccessful(*node, attempt_context) && !output_data_poly.isNull();
+    context.task_infos.mergeInfoMap(std::move(future->context->task_infos));
+    statistics->record(profile, successful);
+
+    if (!successful)
+    {
+      rejected.push_back("'" + profile + "' failed");
+      continue;
+    }
+
+    setData(*context.data_storage, INOUT_PROGRAM_PORT, output_data_poly);
+    info->data_storage.setData("attempts", attempts);
+    info->data_storage.setData("profile", profile);
+    info->color = "green";
+    info->status_code = 1;
+    info->status_message = "Successful with profile '" + profile + "'";
+    info->return_value = 1;
+    return info;
+  }
+
+  info->data_storage.setData("attempts", attempts);
+  info->status_message = "RetryWithEscalationTask, no profile succeeded:";
+  for (const auto& reason : rejected)
+    info->status_message += " " + reason;
+  CONSOLE_BRIDGE_logError("%s", info->status_message.c_str());
+  return info;
+}
+
+}  // namespace tesseract_planning
+
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::RetryWithEscalationTask)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::RetryWithEscalationTask)
@@ -0,0 +1,153 @@
+/**
+ * @file planner_task_factory.cpp
+ * @brief Factories creating the planner tasks run by a task on its own child contexts
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/planner_task_factory.h>
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_graph.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+
+#include <tesseract_common/plugin_info.h>
+
+namespace
+{
+/** @brief Get the keys of the program port of the created node */
+tesseract_planning::PlannerTaskFactoryResults getResults(tesseract_planning::TaskComposerNode::UPtr node,
+                                                         const std::string& program_port)
+{
+  tesseract_planning::PlannerTaskFactoryResults tf_results;
+  tf_results.input_key = node->getInputKeys().get(program_port);
+  if (node->getOutputKeys().has(program_port))
+    tf_results.output_key = node->getOutputKeys().get(program_port);
+
+  tf_results.node = std::move(node);
+  return tf_results;
+}
+}  // namespace
+
+namespace tesseract_planning
+{
+PlannerTaskFactory createPlannerTaskFactory(const std::string& owner_name,
+                                            const std::string& entry_name,
+                                            const YAML::Node& entry,
+                                            const TaskComposerPluginFactory& plugin_factory,
+                                            const std::string& program_port)
+{
+  std::optional<std::string> node_name;
+  if (YAML::Node n = entry["name"])
+    node_name = n.as<std::string>();
+
+  if (YAML::Node n = entry["class"])
+  {
+    tesseract_common::PluginInfo plugin_info;
+    plugin_info.class_name = n.as<std::string>();
+    if (YAML::Node cn = entry["config"])
+      plugin_info.config = cn;
+
+    return [owner_name, node_name, plugin_info, program_port, &plugin_factory](const std::string& name,
+                                                                               std::size_t /*index*/) {
+      TaskComposerNode::UPtr node = plugin_factory.createTaskComposerNode(node_name.value_or(name), plugin_info);
+      if (node == nullptr)
+        throw std::runtime_error(owner_name + ", failed to create node '" + plugin_info.class_name + "'");
+
+      return getResults(std::move(node), program_port);
+    };
+  }
+
+  if (YAML::Node n = entry["task"])
+  {
+    auto task_name = n.as<std::string>();
+    bool has_abort_terminal_entry{ false };
+    int abort_terminal_index{ -1 };
+    std::map<std::string, std::string> remapping;
+
+    if (YAML::Node task_config = entry["config"])
+    {
+      if (YAML::Node n = task_config["abort_terminal"])
+      {
+        has_abort_terminal_entry = true;
+        abort_terminal_index = n.as<int>();
+      }
+
+      if (YAML::Node n = task_config["remapping"])
+        remapping = n.as<std::map<std::string, std::string>>();
+    }
+
+    return [owner_name,
+            node_name,
+            task_name,
+            has_abort_terminal_entry,
+            abort_terminal_index,
+            remapping,
+            program_port,
+            &plugin_factory](const std::string& name, std::size_t /*index*/) {
+      TaskComposerNode::UPtr node = plugin_factory.createTaskComposerNode(task_name);
+      if (node == nullptr)
+        throw std::runtime_error(owner_name + ", failed to create task '" + task_name + "'");
+
+      node->setName(node_name.value_or(name));
+      if (has_abort_terminal_entry)
+      {
+        if (node->getType() != TaskComposerNodeType::GRAPH && node->getType() != TaskComposerNodeType::PIPELINE)
+          throw std::runtime_error(owner_name + ", 'abort_terminal' is only supported for GRAPH and PIPELINE types");
+
+        static_cast<TaskComposerGraph&>(*node).setTerminalTriggerAbortByIndex(abort_terminal_index);
+      }
+
+      if (!remapping.empty())
+      {
+        node->renameInputKeys(remapping);
+        node->renameOutputKeys(remapping);
+      }
+
+      return getResults(std::move(node), program_port);
+    };
+  }
+
+  throw std::runtime_error(owner_name + ", entry '" + entry_name + "' missing 'class' or 'task' entry");
+}
+
+bool isPlannerTaskSuccessful(const TaskComposerNode& node, const TaskComposerContext& context)
+{
+  if (context.isAborted())
+    return false;
+
+  if (node.getType() != TaskComposerNodeType::TASK)
+    return true;
+
+  auto info = context.task_infos.getInfo(node.getUUID());
+  return (info != nullptr && info->return_value != 0);
+}
+}  // namespace tesseract_planning
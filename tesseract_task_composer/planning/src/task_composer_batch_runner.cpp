@@ -0,0 +1,280 @@
+/**
+ * @file task_composer_batch_runner.cpp
+ * @brief Plan many independent programs with a single pipeline
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <typeindex>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/task_composer_batch_runner.h>
+#include <tesseract_task_composer/planning/environment_snapshot.h>
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_node.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+
+#include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_environment/environment.h>
+
+namespace
+{
+/** @brief The jobs which have finished, in order of completion */
+struct BatchCompletion
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::size_t> finished;
+};
+
+double toSeconds(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration<double>(duration).count();
+}
+}  // namespace
+
+namespace tesseract_planning
+{
+const std::string TaskComposerBatchRunner::ENVIRONMENT_KEY = "environment";
+const std::string TaskComposerBatchRunner::PROFILES_KEY = "profiles";
+
+TaskComposerBatchJob::TaskComposerBatchJob(CompositeInstruction program, std::shared_ptr<ProfileDictionary> profiles)
+  : program(std::move(program)), profiles(std::move(profiles))
+{
+}
+
+double TaskComposerBatchNodeStatistics::getAverageTime() const
+{
+  const std::size_t ran = count - aborted;
+  return (ran > 0) ? total_time / static_cast<double>(ran) : 0.0;
+}
+
+void TaskComposerBatchStatistics::add(const TaskComposerBatchResult& result)
+{
+  ++jobs;
+  if (result.successful)
+    ++successful;
+  else
+    ++failed;
+
+  total_elapsed_time += result.elapsed_time;
+  max_elapsed_time = std::max(max_elapsed_time, result.elapsed_time);
+
+  if (result.context == nullptr)
+    return;
+
+  for (const auto& pair : result.context->task_infos.getInfoMap())
+  {
+    const TaskComposerNodeInfo& info = *pair.second;
+    TaskComposerBatchNodeStatistics& node = nodes[info.name];
+    ++node.count;
+    if (info.isAborted())
+    {
+      ++node.aborted;
+      continue;
+    }
+
+    node.total_time += info.elapsed_time;
+    node.min_time = std::min(node.min_time, info.elapsed_time);
+    node.max_time = std::max(node.max_time, info.elapsed_time);
+  }
+}
+
+double TaskComposerBatchStatistics::getThroughput() const
+{
+  return (wall_time > 0) ? static_cast<double>(jobs) / wall_time : 0.0;
+}
+
+TaskComposerBatchRunner::TaskComposerBatchRunner(std::shared_ptr<const TaskComposerNode> pipeline,
+                                                 std::shared_ptr<TaskComposerExecutor> executor,
+                                                 std::size_t max_concurrency,
+                                                 TaskComposerPriority priority)
+  : pipeline_(std::move(pipeline))
+  , executor_(std::move(executor))
+  , max_concurrency_(max_concurrency)
+  , priority_(priority)
+{
+  if (pipeline_ == nullptr)
+    throw std::runtime_error("TaskComposerBatchRunner, pipeline is a nullptr");
+
+  if (executor_ == nullptr)
+    throw std::runtime_error("TaskComposerBatchRunner, executor is a nullptr");
+
+  if (max_concurrency_ == 0)
+    max_concurrency_ = static_cast<std::size_t>(std::max(executor_->getWorkerCount(), 1L));
+
+  const TaskComposerKeys& input_keys = pipeline_->getInputKeys();
+  if (input_keys.has("planning_input"))
+    input_key_ = input_keys.get("planning_input");
+  else if (input_keys.has("program"))
+    input_key_ = input_keys.get("program");
+  else
+    throw std::runtime_error("TaskComposerBatchRunner, pipeline '" + pipeline_->getName() +
+                             "' does not have a 'planning_input' or 'program' input");
+
+  if (!pipeline_->getOutputKeys().has("program"))
+    throw std::runtime_error("TaskComposerBatchRunner, pipeline '" + pipeline_->getName() +
+                             "' does not have a 'program' output");
+
+  output_key_ = pipeline_->getOutputKeys().get("program");
+}
+
+TaskComposerBatchRunner::TaskComposerBatchRunner(const TaskComposerPluginFactory& plugin_factory,
+                                                 const std::string& pipeline_name,
+                                                 std::shared_ptr<TaskComposerExecutor> executor,
+                                                 std::size_t max_concurrency,
+                                                 TaskComposerPriority priority)
+  : TaskComposerBatchRunner(plugin_factory.createTaskComposerNode(pipeline_name),
+                            std::move(executor),
+                            max_concurrency,
+                            priority)
+{
+}
+
+TaskComposerBatchResults
+TaskComposerBatchRunner::run(const std::vector<TaskComposerBatchJob>& jobs,
+                             const std::shared_ptr<const tesseract_environment::Environment>& env) const
+{
+  TaskComposerBatchResults batch_results;
+  batch_results.results.resize(jobs.size());
+  batch_results.statistics = run(jobs, env, [&batch_results](TaskComposerBatchResult result) {
+    const std::size_t index = result.index;
+    batch_results.results[index] = std::move(result);
+  });
+  return batch_results;
+}
+
+TaskComposerBatchStatistics
+TaskComposerBatchRunner::run(const std::vector<TaskComposerBatchJob>& jobs,
+                             const std::shared_ptr<const tesseract_environment::Environment>& env,
+                             const ResultCallback& callback) const
+{
+  TaskComposerBatchStatistics statistics;
+  if (jobs.empty())
+    return statistics;
+
+  // Every job shares the same immutable snapshot instead of its own clone
+  const std::shared_ptr<const tesseract_environment::Environment> shared_env =
+      EnvironmentSnapshot::create(env)->getEnvironment();
+
+  struct Job
+  {
+    TaskComposerFuture::UPtr future;
+    std::chrono::steady_clock::time_point submitted;
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  auto completion = std::make_shared<BatchCompletion>();
+  std::vector<Job> running(jobs.size());
+  std::size_t next{ 0 };
+  std::size_t in_flight{ 0 };
+
+  auto submit = [&](std::size_t index) {
+    auto data_storage = std::make_shared<TaskComposerDataStorage>();
+    data_storage->setData(input_key_, jobs[index].program);
+    data_storage->setData(ENVIRONMENT_KEY, shared_env);
+    data_storage->setData(PROFILES_KEY, jobs[index].profiles);
+
+    running[index].submitted = std::chrono::steady_clock::now();
+    running[index].future = executor_->run(*pipeline_, std::move(data_storage), priority_);
+    ++in_flight;
+
+    running[index].future->then([completion, index](const std::shared_ptr<TaskComposerContext>& /*context*/) {
+      std::unique_lock<std::mutex> lock(completion->mutex);
+      completion->finished.push_back(index);
+      completion->cv.notify_all();
+    });
+  };
+
+  try
+  {
+    while (next < jobs.size() && in_flight < max_concurrency_)
+      submit(next++);
+
+    while (in_flight > 0)
+    {
+      std::size_t index{ 0 };
+      {
+        std::unique_lock<std::mutex> lock(completion->mutex);
+        completion->cv.wait(lock, [&completion] { return !completion->finished.empty(); });
+        index = completion->finished.front();
+        completion->finished.pop_front();
+      }
+      --in_flight;
+      const auto finished = std::chrono::steady_clock::now();
+
+      // Keep the executor busy before handing the result to the caller
+      if (next < jobs.size())
+        submit(next++);
+
+      Job& job = running[index];
+      TaskComposerBatchResult result;
+      result.index = index;
+      result.context = job.future->context;
+      result.queue_time = toSeconds(job.submitted - start);
+      result.elapsed_time = toSeconds(finished - job.submitted);
+      job.future.reset();
+
+      if (result.context->isSuccessful())
+      {
+        auto output = result.context->data_storage->getData(output_key_);
+        if (!output.isNull() && output.getType() == std::type_index(typeid(CompositeInstruction)))
+        {
+          result.successful = true;
+          result.program = output.as<CompositeInstruction>();
+        }
+      }
+
+      statistics.add(result);
+      callback(std::move(result));
+    }
+  }
+  catch (...)
+  {
+    // The jobs reference the pipeline and the jobs, so they must finish before returning
+    for (auto& job : running)
+    {
+      if (job.future != nullptr)
+        job.future->wait();
+    }
+    throw;
+  }
+
+  statistics.wall_time = toSeconds(std::chrono::steady_clock::now() - start);
+  return statistics;
+}
+
+std::size_t TaskComposerBatchRunner::getMaxConcurrency() const { return max_concurrency_; }
+
+}  // namespace tesseract_planning
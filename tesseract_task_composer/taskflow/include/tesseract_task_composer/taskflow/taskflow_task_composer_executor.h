@@ -28,6 +28,9 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <map>
@@ -60,6 +63,60 @@ class TaskComposerPipeline;
 class TaskComposerTask;
 class TaskComposerGraph;
 
+/** @brief The action taken when a request is submitted to a priority class which is at capacity */
+enum class TaskflowAdmissionPolicy
+{
+  /** @brief Queue the request and start it once a request of the same class finishes */
+  DEFER,
+  /** @brief Throw an exception from run */
+  REJECT
+};
+
+/** @brief The configuration of a priority class of the taskflow executor */
+struct TaskflowPriorityConfig
+{
+  /** @brief The number of threads of a dedicated worker pool, if zero the shared worker pool is used */
+  std::size_t threads{ 0 };
+
+  /** @brief The maximum number of requests of this class executing at the same time, if zero there is no limit */
+  std::size_t max_running{ 0 };
+
+  /** @brief The maximum number of deferred requests of this class, if zero there is no limit */
+  std::size_t max_deferred{ 0 };
+
+  /** @brief The action taken when the class is at capacity */
+  TaskflowAdmissionPolicy admission{ TaskflowAdmissionPolicy::DEFER };
+
+  bool operator==(const TaskflowPriorityConfig& rhs) const;
+  bool operator!=(const TaskflowPriorityConfig& rhs) const;
+
+private:
+  friend struct tesseract_common::Serialization;
+  friend class boost::serialization::access;
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+/**
+ * @brief A task composer executor built on taskflow
+ * @details A tf::Executor runs its topologies in submission order, so priority classes are realized by giving a class
+ * its own worker pool and by limiting the number of requests of a class executing at the same time. Requests
+ * submitted from within a running task (dynamic tasking) bypass the admission limits because the caller is waiting on
+ * them.
+ *
+ * The YAML config supports the following entries:
+ * @code{.yaml}
+ * threads: 5
+ * priorities:
+ *   high:
+ *     threads: 2
+ *   low:
+ *     max_running: 2
+ *     max_deferred: 10
+ *     admission: defer  # or reject
+ * @endcode
+ */
 class TaskflowTaskComposerExecutor : public TaskComposerExecutor
 {
 public:
@@ -70,6 +127,9 @@ public:
 
   TaskflowTaskComposerExecutor(std::string name = "TaskflowExecutor",
                                size_t num_threads = std::thread::hardware_concurrency());
+  TaskflowTaskComposerExecutor(std::string name,
+                               size_t num_threads,
+                               std::map<TaskComposerPriority, TaskflowPriorityConfig> priorities);
   TaskflowTaskComposerExecutor(std::string name, const YAML::Node& config);
   TaskflowTaskComposerExecutor(size_t num_threads);
   ~TaskflowTaskComposerExecutor() override;
@@ -82,6 +142,11 @@ public:
 
   long getTaskCount() const override final;
 
+  TaskComposerExecutorMetrics getMetrics(TaskComposerPriority priority) const override final;
+
+  /** @brief Get the configuration of the priority classes, classes not in the map use the default configuration */
+  const std::map<TaskComposerPriority, TaskflowPriorityConfig>& getPriorityConfigs() const;
+
   bool operator==(const TaskflowTaskComposerExecutor& rhs) const;
   bool operator!=(const TaskflowTaskComposerExecutor& rhs) const;
 
@@ -98,13 +163,53 @@ protected:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
+  /** @brief The runtime state of a priority class */
+  struct PriorityClass
+  {
+    TaskflowPriorityConfig config;
+
+    /** @brief The dedicated worker pool, nullptr if the shared worker pool is used */
+    std::unique_ptr<tf::Executor> executor;
+
+    /** @brief The number of admitted requests which have been dispatched but have not finished */
+    std::size_t running{ 0 };
+
+    /** @brief The deferred requests in submission order */
+    std::deque<std::function<void()>> deferred;
+
+    TaskComposerExecutorMetrics metrics;
+  };
+
   std::size_t num_threads_;
+  std::map<TaskComposerPriority, TaskflowPriorityConfig> priority_configs_;
   std::unique_ptr<tf::Executor> executor_;
 
+  mutable std::mutex admission_mutex_;
+  std::map<TaskComposerPriority, PriorityClass> priority_classes_;
+
   std::mutex futures_mutex_;
   std::map<boost::uuids::uuid, std::unique_ptr<TaskComposerFuture>> futures_;
   void removeFuture(const boost::uuids::uuid& uuid);
 
+  /** @brief Create the worker pools from the number of threads and the priority configs */
+  void createExecutors();
+
+  /** @brief Get the worker pool used by a priority class */
+  tf::Executor& getExecutor(TaskComposerPriority priority) const;
+
+  /** @brief Check if the calling thread is a worker of one of the worker pools */
+  bool isWorkerThread() const;
+
+  /**
+   * @brief Record the metrics of a finished request and dispatch the deferred requests of its class which now fit
+   * @param priority The priority class of the request
+   * @param submitted The time the request was submitted
+   * @param started The time the request started executing
+   */
+  void finish(TaskComposerPriority priority,
+              std::chrono::steady_clock::time_point submitted,
+              std::chrono::steady_clock::time_point started);
+
   std::unique_ptr<TaskComposerFuture> run(const TaskComposerNode& node,
                                           std::shared_ptr<TaskComposerContext> context) override final;
 };
@@ -48,7 +48,8 @@ public:
   TaskflowTaskComposerFuture() = default;
   TaskflowTaskComposerFuture(std::shared_future<void> future,
                              std::unique_ptr<tf::Taskflow> taskflow,
-                             std::shared_ptr<TaskComposerContext> context);
+                             std::shared_ptr<TaskComposerContext> context,
+                             std::shared_ptr<TaskComposerFutureCompletion> completion = nullptr);
   ~TaskflowTaskComposerFuture() override;
   TaskflowTaskComposerFuture(const TaskflowTaskComposerFuture&) = default;
   TaskflowTaskComposerFuture& operator=(const TaskflowTaskComposerFuture&) = default;
@@ -68,17 +69,22 @@ public:
   std::future_status
   waitUntil(const std::chrono::time_point<std::chrono::high_resolution_clock>& abs) const override final;
 
+  void then(TaskComposerFutureCallback callback) override final;
+
   TaskComposerFuture::UPtr copy() const override final;
 
   /** @brief Crate DOT Graph using taskflow dump */
   void dump(std::ostream& os) const;
 
 private:
-  /** @brief This is the future return from taskflow executor.run */
+  /** @brief This is the future completed by the executor once the taskflow finished */
   std::shared_future<void> future_;
 
   /** @brief Hold object that must not go out of scope during execution */
   std::shared_ptr<tf::Taskflow> taskflow_;
+
+  /** @brief The completion state completed by the executor when the taskflow finishes */
+  std::shared_ptr<TaskComposerFutureCompletion> completion_;
 };
 }  // namespace tesseract_planning
 
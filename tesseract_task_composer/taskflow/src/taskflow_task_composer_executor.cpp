@@ -29,7 +29,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tesseract_common/serialization.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_common/stopwatch.h>
+#include <algorithm>
+#include <future>
 #include <taskflow/taskflow.hpp>
+#include <boost/serialization/map.hpp>
 #include <yaml-cpp/yaml.h>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -43,6 +46,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_pipeline.h>
 #include <tesseract_task_composer/core/task_composer_graph.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_trace_writer.h>
 
 namespace tesseract_planning
 {
@@ -114,6 +118,9 @@ tf::Task convertToTaskflow(const TaskComposerGraph& task_graph,
     subflow.join();
     stopwatch.stop();
     info->elapsed_time = stopwatch.elapsedSeconds();
+    if (task_context.trace_writer != nullptr)
+      task_context.trace_writer->writeNodeInfo(*info);
+
     task_context.task_infos.addInfo(std::move(info));
   };
 
@@ -123,37 +130,109 @@ tf::Task convertToTaskflow(const TaskComposerGraph& task_graph,
   return taskflow->emplace(fn).name(task_graph.getName());
 }
 
-void convertToTaskflow(const TaskComposerPipeline& task_pipeline,
-                       TaskComposerContext& task_context,
-                       TaskComposerExecutor& task_executor,
-                       tf::Taskflow* taskflow)
+tf::Task convertToTaskflow(const TaskComposerPipeline& task_pipeline,
+                           TaskComposerContext& task_context,
+                           TaskComposerExecutor& task_executor,
+                           tf::Taskflow* taskflow)
 {
-  taskflow
+  return taskflow
       ->emplace(
           [&task_pipeline, &task_context, &task_executor] { return task_pipeline.run(task_context, task_executor); })
       .name(task_pipeline.getName());
 }
 
-void convertToTaskflow(const TaskComposerTask& task,
-                       TaskComposerContext& task_context,
-                       TaskComposerExecutor& task_executor,
-                       tf::Taskflow* taskflow)
+tf::Task convertToTaskflow(const TaskComposerTask& task,
+                           TaskComposerContext& task_context,
+                           TaskComposerExecutor& task_executor,
+                           tf::Taskflow* taskflow)
 {
-  taskflow->emplace([&task, &task_context, &task_executor] { return task.run(task_context, task_executor); })
+  return taskflow->emplace([&task, &task_context, &task_executor] { return task.run(task_context, task_executor); })
       .name(task.getName());
 }
 
+namespace
+{
+TaskComposerPriority toPriority(const std::string& name)
+{
+  if (name == "low")
+    return TaskComposerPriority::LOW;
+
+  if (name == "normal")
+    return TaskComposerPriority::NORMAL;
+
+  if (name == "high")
+    return TaskComposerPriority::HIGH;
+
+  throw std::runtime_error("TaskflowTaskComposerExecutor: unknown priority class '" + name + "'");
+}
+
+TaskflowPriorityConfig loadPriorityConfig(const YAML::Node& config)
+{
+  TaskflowPriorityConfig priority_config;
+  if (YAML::Node n = config["threads"])
+    priority_config.threads = n.as<std::size_t>();
+
+  if (YAML::Node n = config["max_running"])
+    priority_config.max_running = n.as<std::size_t>();
+
+  if (YAML::Node n = config["max_deferred"])
+    priority_config.max_deferred = n.as<std::size_t>();
+
+  if (YAML::Node n = config["admission"])
+  {
+    auto admission = n.as<std::string>();
+    if (admission == "defer")
+      priority_config.admission = TaskflowAdmissionPolicy::DEFER;
+    else if (admission == "reject")
+      priority_config.admission = TaskflowAdmissionPolicy::REJECT;
+    else
+      throw std::runtime_error("TaskflowTaskComposerExecutor: entry 'admission' must be 'defer' or 'reject'");
+  }
+
+  return priority_config;
+}
+}  // namespace
+
+bool TaskflowPriorityConfig::operator==(const TaskflowPriorityConfig& rhs) const
+{
+  bool equal = true;
+  equal &= (threads == rhs.threads);
+  equal &= (max_running == rhs.max_running);
+  equal &= (max_deferred == rhs.max_deferred);
+  equal &= (admission == rhs.admission);
+  return equal;
+}
+
+bool TaskflowPriorityConfig::operator!=(const TaskflowPriorityConfig& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void TaskflowPriorityConfig::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_NVP(threads);
+  ar& BOOST_SERIALIZATION_NVP(max_running);
+  ar& BOOST_SERIALIZATION_NVP(max_deferred);
+  ar& BOOST_SERIALIZATION_NVP(admission);
+}
+
 TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(size_t num_threads)
-  : TaskComposerExecutor("TaskflowExecutor")
-  , num_threads_(num_threads)
-  , executor_(std::make_unique<tf::Executor>(num_threads_))
+  : TaskComposerExecutor("TaskflowExecutor"), num_threads_(num_threads)
 {
+  createExecutors();
 }
+
 TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, size_t num_threads)
-  : TaskComposerExecutor(std::move(name))
-  , num_threads_(num_threads)
-  , executor_(std::make_unique<tf::Executor>(num_threads_))
+  : TaskComposerExecutor(std::move(name)), num_threads_(num_threads)
+{
+  createExecutors();
+}
+
+TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(
+    std::string name,
+    size_t num_threads,
+    std::map<TaskComposerPriority, TaskflowPriorityConfig> priorities)
+  : TaskComposerExecutor(std::move(name)), num_threads_(num_threads), priority_configs_(std::move(priorities))
 {
+  createExecutors();
 }
 
 TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, const YAML::Node& config)
@@ -170,7 +249,13 @@ TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, con
         throw std::runtime_error("TaskflowTaskComposerExecutor: entry 'threads' must be greater than zero");
     }
 
-    executor_ = std::make_unique<tf::Executor>(num_threads_);
+    if (YAML::Node n = config["priorities"])
+    {
+      for (auto it = n.begin(); it != n.end(); ++it)
+        priority_configs_[toPriority(it->first.as<std::string>())] = loadPriorityConfig(it->second);
+    }
+
+    createExecutors();
   }
   catch (const std::exception& e)
   {
@@ -179,7 +264,64 @@ TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, con
   }
 }
 
-TaskflowTaskComposerExecutor::~TaskflowTaskComposerExecutor() = default;
+TaskflowTaskComposerExecutor::~TaskflowTaskComposerExecutor()
+{
+  // Completion callbacks access the priority classes and dispatch the deferred requests, so wait until no request is
+  // running or deferred in any class before a worker pool is destroyed
+  for (;;)
+  {
+    for (auto& pair : priority_classes_)
+    {
+      if (pair.second.executor != nullptr)
+        pair.second.executor->wait_for_all();
+    }
+
+    if (executor_ != nullptr)
+      executor_->wait_for_all();
+
+    std::unique_lock<std::mutex> lock(admission_mutex_);
+    if (std::all_of(priority_classes_.begin(), priority_classes_.end(), [](const auto& pair) {
+          return (pair.second.running == 0 && pair.second.deferred.empty());
+        }))
+      break;
+  }
+}
+
+void TaskflowTaskComposerExecutor::createExecutors()
+{
+  executor_ = std::make_unique<tf::Executor>(num_threads_);
+  priority_classes_.clear();
+  for (auto priority : { TaskComposerPriority::LOW, TaskComposerPriority::NORMAL, TaskComposerPriority::HIGH })
+  {
+    PriorityClass& priority_class = priority_classes_[priority];
+    auto it = priority_configs_.find(priority);
+    if (it != priority_configs_.end())
+      priority_class.config = it->second;
+
+    if (priority_class.config.threads > 0)
+      priority_class.executor = std::make_unique<tf::Executor>(priority_class.config.threads);
+  }
+}
+
+tf::Executor& TaskflowTaskComposerExecutor::getExecutor(TaskComposerPriority priority) const
+{
+  const PriorityClass& priority_class = priority_classes_.at(priority);
+  return (priority_class.executor != nullptr) ? *priority_class.executor : *executor_;
+}
+
+bool TaskflowTaskComposerExecutor::isWorkerThread() const
+{
+  if (executor_->this_worker_id() >= 0)
+    return true;
+
+  for (const auto& pair : priority_classes_)
+  {
+    if (pair.second.executor != nullptr && pair.second.executor->this_worker_id() >= 0)
+      return true;
+  }
+
+  return false;
+}
 
 void TaskflowTaskComposerExecutor::removeFuture(const boost::uuids::uuid& uuid)
 {
@@ -187,37 +329,163 @@ void TaskflowTaskComposerExecutor::removeFuture(const boost::uuids::uuid& uuid)
   futures_.erase(uuid);
 }
 
+void TaskflowTaskComposerExecutor::finish(TaskComposerPriority priority,
+                                          std::chrono::steady_clock::time_point submitted,
+                                          std::chrono::steady_clock::time_point started)
+{
+  const auto finished = std::chrono::steady_clock::now();
+  const double queue_wait_time = std::chrono::duration<double>(started - submitted).count();
+  const double execution_time = std::chrono::duration<double>(finished - started).count();
+
+  std::vector<std::function<void()>> dispatch;
+  {
+    std::unique_lock<std::mutex> lock(admission_mutex_);
+    PriorityClass& priority_class = priority_classes_.at(priority);
+    TaskComposerExecutorMetrics& metrics = priority_class.metrics;
+    ++metrics.completed;
+    metrics.queue_wait_time += queue_wait_time;
+    metrics.max_queue_wait_time = std::max(metrics.max_queue_wait_time, queue_wait_time);
+    metrics.execution_time += execution_time;
+    metrics.max_execution_time = std::max(metrics.max_execution_time, execution_time);
+
+    --priority_class.running;
+    const std::size_t max_running = priority_class.config.max_running;
+    while (!priority_class.deferred.empty() && (max_running == 0 || priority_class.running < max_running))
+    {
+      ++priority_class.running;
+      dispatch.push_back(std::move(priority_class.deferred.front()));
+      priority_class.deferred.pop_front();
+    }
+  }
+
+  for (auto& fn : dispatch)
+    fn();
+}
+
 std::unique_ptr<TaskComposerFuture> TaskflowTaskComposerExecutor::run(const TaskComposerNode& node,
                                                                       std::shared_ptr<TaskComposerContext> context)
 {
+  const auto submitted = std::chrono::steady_clock::now();
   auto taskflow = std::make_unique<tf::Taskflow>(node.getName());
+  tf::Task root;
   if (node.getType() == TaskComposerNodeType::TASK)
-    convertToTaskflow(static_cast<const TaskComposerTask&>(node), *context, *this, taskflow.get());
+    root = convertToTaskflow(static_cast<const TaskComposerTask&>(node), *context, *this, taskflow.get());
   else if (node.getType() == TaskComposerNodeType::PIPELINE)
-    convertToTaskflow(static_cast<const TaskComposerPipeline&>(node), *context, *this, taskflow.get());
+    root = convertToTaskflow(static_cast<const TaskComposerPipeline&>(node), *context, *this, taskflow.get());
   else if (node.getType() == TaskComposerNodeType::GRAPH)
-    convertToTaskflow(static_cast<const TaskComposerGraph&>(node), *context, *this, taskflow.get(), nullptr);
+    root = convertToTaskflow(static_cast<const TaskComposerGraph&>(node), *context, *this, taskflow.get(), nullptr);
   else
     throw std::runtime_error("TaskComposerExecutor, unsupported node type!");
 
+  // Record when a worker picks up the request to separate the queue wait from the execution time
+  auto started = std::make_shared<std::chrono::steady_clock::time_point>(submitted);
+  taskflow->emplace([started] { *started = std::chrono::steady_clock::now(); }).name("Start").precede(root);
+
+  // Requests submitted from within a running task are waited on by the caller so they bypass admission
+  const TaskComposerPriority priority = context->priority;
+  const bool admitted = !isWorkerThread();
+  tf::Executor& executor = getExecutor(priority);
+
   // Inorder to better support dynamic tasking within pipelines we store all futures internally
   // and cleanup when finished because the data cannot go out of scope.
-  std::unique_lock<std::mutex> lock(futures_mutex_);
   boost::uuids::uuid uuid = boost::uuids::random_generator()();
-  std::shared_future<void> f = executor_->run(*taskflow, [this, uuid]() { removeFuture(uuid); });
-  auto future = std::make_unique<TaskflowTaskComposerFuture>(f, std::move(taskflow), std::move(context));
-  futures_[uuid] = future->copy();
+  auto completion = std::make_shared<TaskComposerFutureCompletion>();
+  auto promise = std::make_shared<std::promise<void>>();
+  tf::Taskflow* taskflow_ptr = taskflow.get();
+  auto future = std::make_unique<TaskflowTaskComposerFuture>(
+      promise->get_future().share(), std::move(taskflow), context, completion);
+  {
+    std::unique_lock<std::mutex> lock(futures_mutex_);
+    futures_[uuid] = future->copy();
+  }
+
+  auto dispatch = [this, &executor, taskflow_ptr, uuid, completion, context, promise, priority, admitted, submitted,
+                   started]() {
+    executor.run(*taskflow_ptr, [this, uuid, completion, context, promise, priority, admitted, submitted, started]() {
+      completion->complete(context);
+      if (admitted)
+        finish(priority, submitted, *started);
+
+      removeFuture(uuid);
+      promise->set_value();
+    });
+  };
+
+  if (!admitted)
+  {
+    dispatch();
+    return future;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(admission_mutex_);
+    PriorityClass& priority_class = priority_classes_.at(priority);
+    const TaskflowPriorityConfig& config = priority_class.config;
+    if (config.max_running == 0 || priority_class.running < config.max_running)
+    {
+      ++priority_class.metrics.admitted;
+      ++priority_class.running;
+    }
+    else if (config.admission == TaskflowAdmissionPolicy::DEFER &&
+             (config.max_deferred == 0 || priority_class.deferred.size() < config.max_deferred))
+    {
+      ++priority_class.metrics.admitted;
+      ++priority_class.metrics.deferred;
+      priority_class.deferred.push_back(std::move(dispatch));
+      return future;
+    }
+    else
+    {
+      ++priority_class.metrics.rejected;
+      lock.unlock();
+      removeFuture(uuid);
+      throw std::runtime_error("TaskflowTaskComposerExecutor, rejected request '" + node.getName() +
+                               "' because its priority class is at capacity");
+    }
+  }
+
+  dispatch();
   return future;
 }
 
-long TaskflowTaskComposerExecutor::getWorkerCount() const { return static_cast<long>(executor_->num_workers()); }
+long TaskflowTaskComposerExecutor::getWorkerCount() const
+{
+  auto count = static_cast<long>(executor_->num_workers());
+  for (const auto& pair : priority_classes_)
+  {
+    if (pair.second.executor != nullptr)
+      count += static_cast<long>(pair.second.executor->num_workers());
+  }
+  return count;
+}
 
-long TaskflowTaskComposerExecutor::getTaskCount() const { return static_cast<long>(executor_->num_topologies()); }
+long TaskflowTaskComposerExecutor::getTaskCount() const
+{
+  auto count = static_cast<long>(executor_->num_topologies());
+  for (const auto& pair : priority_classes_)
+  {
+    if (pair.second.executor != nullptr)
+      count += static_cast<long>(pair.second.executor->num_topologies());
+  }
+  return count;
+}
+
+TaskComposerExecutorMetrics TaskflowTaskComposerExecutor::getMetrics(TaskComposerPriority priority) const
+{
+  std::unique_lock<std::mutex> lock(admission_mutex_);
+  return priority_classes_.at(priority).metrics;
+}
+
+const std::map<TaskComposerPriority, TaskflowPriorityConfig>& TaskflowTaskComposerExecutor::getPriorityConfigs() const
+{
+  return priority_configs_;
+}
 
 bool TaskflowTaskComposerExecutor::operator==(const TaskflowTaskComposerExecutor& rhs) const
 {
   bool equal = true;
   equal &= (num_threads_ == rhs.num_threads_);
+  equal &= (priority_configs_ == rhs.priority_configs_);
   equal &= TaskComposerExecutor::operator==(rhs);
   return equal;
 }
@@ -231,6 +499,7 @@ template <class Archive>
 void TaskflowTaskComposerExecutor::save(Archive& ar, const unsigned int /*version*/) const
 {
   ar& BOOST_SERIALIZATION_NVP(num_threads_);
+  ar& BOOST_SERIALIZATION_NVP(priority_configs_);
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerExecutor);
 }
 
@@ -238,9 +507,10 @@ template <class Archive>
 void TaskflowTaskComposerExecutor::load(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_NVP(num_threads_);
+  ar& BOOST_SERIALIZATION_NVP(priority_configs_);
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerExecutor);
 
-  executor_ = std::make_unique<tf::Executor>(num_threads_);
+  createExecutors();
 }
 
 template <class Archive>
@@ -251,5 +521,6 @@ void TaskflowTaskComposerExecutor::serialize(Archive& ar, const unsigned int ver
 
 }  // namespace tesseract_planning
 
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::TaskflowPriorityConfig)
 TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::TaskflowTaskComposerExecutor)
 BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::TaskflowTaskComposerExecutor)
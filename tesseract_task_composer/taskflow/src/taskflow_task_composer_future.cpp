@@ -36,8 +36,12 @@ namespace tesseract_planning
 {
 TaskflowTaskComposerFuture::TaskflowTaskComposerFuture(std::shared_future<void> future,
                                                        std::unique_ptr<tf::Taskflow> taskflow,
-                                                       std::shared_ptr<TaskComposerContext> context)
-  : TaskComposerFuture(std::move(context)), future_(std::move(future)), taskflow_(std::move(taskflow))
+                                                       std::shared_ptr<TaskComposerContext> context,
+                                                       std::shared_ptr<TaskComposerFutureCompletion> completion)
+  : TaskComposerFuture(std::move(context))
+  , future_(std::move(future))
+  , taskflow_(std::move(taskflow))
+  , completion_(std::move(completion))
 {
 }
 
@@ -47,6 +51,7 @@ void TaskflowTaskComposerFuture::clear()
 {
   future_ = std::shared_future<void>();
   taskflow_ = nullptr;
+  completion_ = nullptr;
   context = nullptr;
 }
 
@@ -70,6 +75,14 @@ TaskflowTaskComposerFuture::waitUntil(const std::chrono::time_point<std::chrono:
   return future_.wait_until(abs);
 }
 
+void TaskflowTaskComposerFuture::then(TaskComposerFutureCallback callback)
+{
+  if (completion_ == nullptr)
+    throw std::runtime_error("TaskflowTaskComposerFuture, then was called on a future without completion state");
+
+  completion_->addCallback(std::move(callback), context);
+}
+
 TaskComposerFuture::UPtr TaskflowTaskComposerFuture::copy() const
 {
   return std::make_unique<TaskflowTaskComposerFuture>(*this);
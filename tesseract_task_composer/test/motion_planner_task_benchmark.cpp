@@ -0,0 +1,233 @@
+/**
+ * @file motion_planner_task_benchmark.cpp
+ * @brief Benchmark the program copies and allocations made by a motion planner task stage
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#if defined(__GLIBC__)
+#include <cerrno>
+#include <malloc.h>
+#endif
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_task_composer/planning/nodes/motion_planner_task.hpp>
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/profile_dictionary.h>
+
+/** @brief The number of heap allocations, which is only counted with glibc */
+static std::atomic<std::size_t> allocation_count{ 0 };  // NOLINT
+
+#if defined(__GLIBC__)
+/**
+ * @brief The C allocation functions are replaced so every heap allocation is counted
+ * @details Eigen allocates with malloc directly while the standard library allocates with operator new, which calls
+ * malloc, so counting at this level captures both. The live heap, and therefore its peak, is tracked using the usable
+ * size of each block. The replacements forward to the glibc implementations, so this is only supported with glibc.
+ */
+static std::atomic<std::size_t> allocated_bytes{ 0 };  // NOLINT
+static std::atomic<std::size_t> peak_bytes{ 0 };       // NOLINT
+
+extern "C" {
+void* __libc_malloc(std::size_t size);                           // NOLINT
+void* __libc_calloc(std::size_t count, std::size_t size);        // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);               // NOLINT
+void* __libc_memalign(std::size_t alignment, std::size_t size);  // NOLINT
+void* __libc_valloc(std::size_t size);                           // NOLINT
+void* __libc_pvalloc(std::size_t size);                          // NOLINT
+void __libc_free(void* ptr);                                     // NOLINT
+}
+
+static void* trackAllocation(void* ptr)
+{
+  if (ptr == nullptr)
+    return ptr;
+
+  ++allocation_count;
+  std::size_t current = (allocated_bytes += malloc_usable_size(ptr));
+  std::size_t peak = peak_bytes.load();
+  while (current > peak && !peak_bytes.compare_exchange_weak(peak, current))
+  {
+  }
+
+  return ptr;
+}
+
+static void trackFree(void* ptr)
+{
+  if (ptr != nullptr)
+    allocated_bytes -= malloc_usable_size(ptr);
+}
+
+extern "C" {
+void* malloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_malloc(size));
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_calloc(count, size));
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept  // NOLINT
+{
+  const std::size_t old_size = (ptr != nullptr) ? malloc_usable_size(ptr) : 0;
+  void* new_ptr = __libc_realloc(ptr, size);
+  if (new_ptr == nullptr && size != 0)
+    return new_ptr;
+
+  allocated_bytes -= old_size;
+  return trackAllocation(new_ptr);
+}
+
+void* memalign(std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_memalign(alignment, size));
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_memalign(alignment, size));
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+    return EINVAL;
+
+  *ptr = trackAllocation(__libc_memalign(alignment, size));
+  return (*ptr == nullptr && size != 0) ? ENOMEM : 0;
+}
+
+void* valloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_valloc(size));
+}
+
+void* pvalloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_pvalloc(size));
+}
+
+void free(void* ptr) noexcept  // NOLINT
+{
+  trackFree(ptr);
+  __libc_free(ptr);
+}
+}
+#endif
+
+using namespace tesseract_planning;
+
+/** @brief A planner which only does what every planner must do, copy the request instructions into the results */
+class PassThroughMotionPlanner : public MotionPlanner
+{
+public:
+  PassThroughMotionPlanner(std::string name) : MotionPlanner(std::move(name)) {}
+
+  PlannerResponse solve(const PlannerRequest& request) const override
+  {
+    PlannerResponse response;
+    response.results = request.instructions;
+    response.successful = true;
+    return response;
+  }
+
+  bool terminate() override { return false; }
+
+  void clear() override {}
+
+  std::unique_ptr<MotionPlanner> clone() const override { return std::make_unique<PassThroughMotionPlanner>(name_); }
+};
+
+CompositeInstruction getProgram(std::size_t size)
+{
+  CompositeInstruction program("DEFAULT", tesseract_common::ManipulatorInfo("manipulator", "world", "tool0"));
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    StateWaypointPoly wp{ StateWaypoint(joint_names, Eigen::VectorXd::Constant(6, static_cast<double>(i))) };
+    program.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "RASTER"));
+  }
+  return program;
+}
+
+/** @brief The allocations of a single program copy, used as the unit for the stage benchmark */
+static void BM_ProgramCopy(benchmark::State& state)
+{
+  CompositeInstruction program = getProgram(static_cast<std::size_t>(state.range(0)));
+  std::size_t allocations{ 0 };
+  for (auto _ : state)
+  {
+    std::size_t start = allocation_count;
+    CompositeInstruction copy(program);
+    allocations += allocation_count - start;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_ProgramCopy)->Arg(100)->Arg(1000)->Arg(10000);
+
+/** @brief The allocations of running a motion planner task stage, divide by BM_ProgramCopy to get the program copies */
+static void BM_MotionPlannerTaskStage(benchmark::State& state)
+{
+  CompositeInstruction program = getProgram(static_cast<std::size_t>(state.range(0)));
+  MotionPlannerTask<PassThroughMotionPlanner> task(
+      "PassThroughMotionPlannerTask", "input_data", "environment", "profiles", "output_data", false, false);
+
+  std::shared_ptr<const tesseract_environment::Environment> env;
+  auto profiles = std::make_shared<ProfileDictionary>();
+
+  std::size_t allocations{ 0 };
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto data_storage = std::make_shared<TaskComposerDataStorage>();
+    data_storage->setData("input_data", program);
+    data_storage->setData("environment", env);
+    data_storage->setData("profiles", profiles);
+    TaskComposerContext context("MotionPlannerTaskStage", data_storage);
+    state.ResumeTiming();
+
+    std::size_t start = allocation_count;
+    task.run(context);
+    allocations += allocation_count - start;
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_MotionPlannerTaskStage)->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
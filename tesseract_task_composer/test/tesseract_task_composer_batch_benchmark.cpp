@@ -0,0 +1,193 @@
+/**
+ * @file tesseract_task_composer_batch_benchmark.cpp
+ * @brief Throughput of planning many short freespace moves
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <random>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_common/manipulator_info.h>
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_node.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/planning/task_composer_batch_runner.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_environment/environment.h>
+
+using namespace tesseract_planning;
+
+/** @brief The number of programs planned by each benchmark */
+constexpr std::size_t JOB_COUNT{ 1000 };
+
+/** @brief The pipeline used to plan each program */
+const std::string PIPELINE_NAME{ "TrajOptPipeline" };
+
+/** @brief The plugin factory, environment and executor shared by every benchmark so their startup is not measured */
+struct BatchBenchmarkFixture
+{
+  tesseract_common::GeneralResourceLocator::Ptr locator;
+  std::unique_ptr<TaskComposerPluginFactory> factory;
+  std::shared_ptr<TaskComposerExecutor> executor;
+  std::shared_ptr<tesseract_environment::Environment> env;
+  std::vector<TaskComposerBatchJob> jobs;
+
+  BatchBenchmarkFixture()
+  {
+    locator = std::make_shared<tesseract_common::GeneralResourceLocator>();
+    tesseract_common::fs::path config_path(
+        locator->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+    factory = std::make_unique<TaskComposerPluginFactory>(config_path, *locator);
+    executor = factory->createTaskComposerExecutor("TaskflowExecutor");
+
+    env = std::make_shared<tesseract_environment::Environment>();
+    tesseract_common::fs::path urdf_path(
+        locator->locateResource("package://tesseract_support/urdf/abb_irb2400.urdf")->getFilePath());
+    tesseract_common::fs::path srdf_path(
+        locator->locateResource("package://tesseract_support/urdf/abb_irb2400.srdf")->getFilePath());
+    if (!env->init(urdf_path, srdf_path, locator))
+      throw std::runtime_error("Failed to initialize the environment");
+
+    // Short freespace moves from the home position to a random nearby joint target, sharing one profile dictionary
+    auto profiles = std::make_shared<ProfileDictionary>();
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> offset(-0.2, 0.2);
+    const std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+    jobs.reserve(JOB_COUNT);
+    for (std::size_t i = 0; i < JOB_COUNT; ++i)
+    {
+      Eigen::VectorXd target(6);
+      for (Eigen::Index j = 0; j < target.size(); ++j)
+        target(j) = offset(generator);
+
+      CompositeInstruction program(DEFAULT_PROFILE_KEY,
+                                   tesseract_common::ManipulatorInfo("manipulator", "base_link", "tool0"));
+      StateWaypointPoly start{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+      program.appendMoveInstruction(MoveInstruction(start, MoveInstructionType::FREESPACE));
+      program.appendMoveInstruction(
+          MoveInstruction(JointWaypointPoly{ JointWaypoint(joint_names, target) }, MoveInstructionType::FREESPACE));
+      jobs.emplace_back(std::move(program), profiles);
+    }
+  }
+};
+
+BatchBenchmarkFixture& getFixture()
+{
+  static BatchBenchmarkFixture fixture;
+  return fixture;
+}
+
+void setThroughputCounters(benchmark::State& state, double elapsed_seconds, std::size_t successful)
+{
+  const double jobs = static_cast<double>(state.iterations()) * static_cast<double>(JOB_COUNT);
+  state.counters["jobs"] = static_cast<double>(JOB_COUNT);
+  state.counters["successful"] = static_cast<double>(successful);
+  state.counters["jobs_per_second"] = (elapsed_seconds > 0) ? jobs / elapsed_seconds : 0;
+}
+
+/** @brief The baseline, every program is its own request with its own clone of the environment */
+static void BM_IndependentRequests(benchmark::State& state)
+{
+  BatchBenchmarkFixture& fixture = getFixture();
+  TaskComposerNode::UPtr pipeline = fixture.factory->createTaskComposerNode(PIPELINE_NAME);
+  const std::string input_key = pipeline->getInputKeys().get("planning_input");
+  const std::string output_key = pipeline->getOutputKeys().get("program");
+
+  double elapsed_seconds{ 0 };
+  std::size_t successful{ 0 };
+  for (auto _ : state)
+  {
+    successful = 0;
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<TaskComposerFuture::UPtr> futures;
+    futures.reserve(fixture.jobs.size());
+    for (const auto& job : fixture.jobs)
+    {
+      auto data_storage = std::make_shared<TaskComposerDataStorage>();
+      data_storage->setData(input_key, job.program);
+      data_storage->setData("environment",
+                            std::shared_ptr<const tesseract_environment::Environment>(fixture.env->clone()));
+      data_storage->setData("profiles", job.profiles);
+      futures.push_back(fixture.executor->run(*pipeline, std::move(data_storage)));
+    }
+
+    for (auto& future : futures)
+    {
+      future->wait();
+      if (future->context->isSuccessful() && future->context->data_storage->hasKey(output_key))
+        ++successful;
+    }
+    elapsed_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  setThroughputCounters(state, elapsed_seconds, successful);
+}
+
+/** @brief The batch runner sharing one environment snapshot, the argument is the maximum concurrency */
+static void BM_BatchRunner(benchmark::State& state)
+{
+  BatchBenchmarkFixture& fixture = getFixture();
+  TaskComposerBatchRunner runner(
+      *fixture.factory, PIPELINE_NAME, fixture.executor, static_cast<std::size_t>(state.range(0)));
+
+  double elapsed_seconds{ 0 };
+  double total_job_seconds{ 0 };
+  std::size_t successful{ 0 };
+  for (auto _ : state)
+  {
+    TaskComposerBatchStatistics statistics = runner.run(fixture.jobs, fixture.env, [](TaskComposerBatchResult result) {
+      benchmark::DoNotOptimize(result);
+    });
+    elapsed_seconds += statistics.wall_time;
+    total_job_seconds += statistics.total_elapsed_time;
+    successful = statistics.successful;
+  }
+
+  setThroughputCounters(state, elapsed_seconds, successful);
+  const double jobs = static_cast<double>(state.iterations()) * static_cast<double>(JOB_COUNT);
+  state.counters["mean_job_ms"] = (jobs > 0) ? (total_job_seconds * 1e3) / jobs : 0;
+}
+
+BENCHMARK(BM_IndependentRequests)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchRunner)->Arg(0)->Arg(1)->Arg(4)->Arg(16)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_ERROR);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -3,12 +3,17 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 #include <sstream>
+#include <fstream>
+#include <limits>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/joint_state.h>
 #include <tesseract_common/utils.h>
 
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_keys.h>
 #include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_node.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
@@ -17,6 +22,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_server.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 #include <tesseract_task_composer/core/task_composer_log.h>
+#include <tesseract_task_composer/core/task_composer_log_writer.h>
+#include <tesseract_task_composer/core/task_composer_log_reader.h>
+#include <tesseract_task_composer/core/task_composer_trace_writer.h>
+#include <tesseract_task_composer/core/task_composer_output_channel.h>
 
 #include <tesseract_task_composer/core/test_suite/task_composer_node_info_unit.hpp>
 #include <tesseract_task_composer/core/test_suite/task_composer_serialization_utils.hpp>
@@ -100,6 +109,49 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageTests)  // NOLINT
     EXPECT_FALSE(remap_move.hasKey(key));
     EXPECT_TRUE(remap_move.hasKey("remap_" + key));
     EXPECT_EQ(remap_move.getData("remap_" + key).as<tesseract_common::JointState>(), js);
+
+    // Test Remap Alias
+    TaskComposerDataStorage remap_alias;
+    remap_alias.setData(key, js);
+    EXPECT_TRUE(remap_alias.remapData(remap, TaskComposerDataStorage::RemapMode::ALIAS));
+    EXPECT_TRUE(remap_alias.hasKey(key));
+    EXPECT_TRUE(remap_alias.hasKey("remap_" + key));
+    EXPECT_EQ(remap_alias.getSharedData(key), remap_alias.getSharedData("remap_" + key));
+    EXPECT_EQ(remap_alias.getData(key), remap_alias.getData("remap_" + key));
+
+    // Modifying the data of one key does not affect the other
+    auto modified = remap_alias.getData("remap_" + key).as<tesseract_common::JointState>();
+    modified.position(0) = 100;
+    remap_alias.setData("remap_" + key, modified);
+    EXPECT_NE(remap_alias.getSharedData(key), remap_alias.getSharedData("remap_" + key));
+    EXPECT_EQ(remap_alias.getData(key).as<tesseract_common::JointState>(), js);
+    EXPECT_EQ(remap_alias.getData("remap_" + key).as<tesseract_common::JointState>(), modified);
+
+    // A copy of the storage shares the payloads, but writes to the copy do not show through the original
+    TaskComposerDataStorage storage_copy{ remap_alias };
+    EXPECT_EQ(storage_copy.getSharedData(key), remap_alias.getSharedData(key));
+    auto copy_modified = storage_copy.getData(key).as<tesseract_common::JointState>();
+    copy_modified.position(0) = 200;
+    storage_copy.setData(key, copy_modified);
+    storage_copy.removeData("remap_" + key);
+    EXPECT_EQ(storage_copy.getData(key).as<tesseract_common::JointState>(), copy_modified);
+    EXPECT_EQ(remap_alias.getData(key).as<tesseract_common::JointState>(), js);
+    EXPECT_TRUE(remap_alias.hasKey("remap_" + key));
+
+    // Test Remap Copy does not share the data
+    TaskComposerDataStorage remap_copy_mode;
+    remap_copy_mode.setData(key, js);
+    EXPECT_TRUE(remap_copy_mode.remapData(remap, TaskComposerDataStorage::RemapMode::COPY));
+    EXPECT_NE(remap_copy_mode.getSharedData(key), remap_copy_mode.getSharedData("remap_" + key));
+    EXPECT_EQ(remap_copy_mode.getData(key), remap_copy_mode.getData("remap_" + key));
+
+    // Copies of the storage share the data
+    TaskComposerDataStorage remap_alias_copy{ remap_alias };
+    EXPECT_EQ(remap_alias_copy.getSharedData(key), remap_alias.getSharedData(key));
+    remap_alias_copy.removeData(key);
+    EXPECT_FALSE(remap_alias_copy.hasKey(key));
+    EXPECT_TRUE(remap_alias.hasKey(key));
+    EXPECT_EQ(remap_alias.getSharedData("does_not_exist"), nullptr);
   }
 
   {  // Test Remap Failure
@@ -119,6 +171,172 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageTests)  // NOLINT
     EXPECT_FALSE(remap_move.remapData(remap));
     EXPECT_TRUE(remap_move.hasKey(key));
     EXPECT_FALSE(remap_move.hasKey("remap_" + key));
+
+    // Test Remap Alias
+    TaskComposerDataStorage remap_alias;
+    remap_alias.setData(key, js);
+    EXPECT_FALSE(remap_alias.remapData(remap, TaskComposerDataStorage::RemapMode::ALIAS));
+    EXPECT_TRUE(remap_alias.hasKey(key));
+    EXPECT_FALSE(remap_alias.hasKey("remap_" + key));
+  }
+}
+
+TEST(TesseractTaskComposerCoreUnit, TaskComposerKeysInternTests)  // NOLINT
+{
+  const std::size_t slot = TaskComposerKeys::intern("intern_test_key");
+  EXPECT_EQ(TaskComposerKeys::intern("intern_test_key"), slot);
+  ASSERT_TRUE(TaskComposerKeys::findSlot("intern_test_key").has_value());
+  EXPECT_EQ(TaskComposerKeys::findSlot("intern_test_key").value(), slot);
+  EXPECT_EQ(TaskComposerKeys::getKey(slot), "intern_test_key");
+
+  // Finding a key does not intern it
+  EXPECT_FALSE(TaskComposerKeys::findSlot("intern_test_key_not_interned").has_value());
+  EXPECT_FALSE(TaskComposerKeys::findSlot("intern_test_key_not_interned").has_value());
+
+  const std::size_t other = TaskComposerKeys::intern("intern_test_other_key");
+  EXPECT_NE(other, slot);
+  EXPECT_EQ(TaskComposerKeys::getKey(other), "intern_test_other_key");
+  EXPECT_ANY_THROW(TaskComposerKeys::getKey(std::numeric_limits<std::size_t>::max()));  // NOLINT
+
+  {  // The same key interned concurrently maps to a single slot id
+    std::vector<std::size_t> results(8);
+    std::vector<std::thread> threads;
+    threads.reserve(results.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+      threads.emplace_back([&results, i] { results[i] = TaskComposerKeys::intern("intern_test_concurrent_key"); });
+
+    for (auto& thread : threads)
+      thread.join();
+
+    for (std::size_t result : results)
+      EXPECT_EQ(result, results.front());
+  }
+
+  {  // The slot ids of the ports follow the keys
+    TaskComposerKeys keys;
+    keys.add("program", "intern_test_key");
+    keys.add("programs", std::vector<std::string>{ "intern_test_key", "intern_test_other_key" });
+    EXPECT_EQ(std::get<std::size_t>(keys.slots().at("program")), slot);
+    EXPECT_EQ(std::get<std::vector<std::size_t>>(keys.slots().at("programs")),
+              std::vector<std::size_t>({ slot, other }));
+
+    keys.rename({ { "intern_test_key", "intern_test_renamed_key" } });
+    const std::size_t renamed = TaskComposerKeys::intern("intern_test_renamed_key");
+    EXPECT_EQ(std::get<std::size_t>(keys.slots().at("program")), renamed);
+    EXPECT_EQ(std::get<std::vector<std::size_t>>(keys.slots().at("programs")),
+              std::vector<std::size_t>({ renamed, other }));
+  }
+}
+
+TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageSlotTests)  // NOLINT
+{
+  // Intern more keys than the directly indexed chunks hold and more than the previous limit of 32768 keys
+  std::size_t last_slot{ 0 };
+  for (std::size_t i = 0; i < 40000; ++i)
+    last_slot = TaskComposerKeys::intern("slot_test_key_" + std::to_string(i));
+
+  ASSERT_GE(last_slot, 39999U);
+
+  // An empty storage stays small, it is embedded in every node info
+  EXPECT_LT(sizeof(TaskComposerDataStorage), 1024U);
+
+  // The first and last slot of chunks, within the directly indexed chunks and beyond them
+  const std::vector<std::size_t> slots{ 0, 63, 64, 511, 512, 4095, 4096, 32767, 32768, last_slot };
+  TaskComposerDataStorage data;
+  for (std::size_t slot : slots)
+  {
+    EXPECT_FALSE(data.hasKey(slot));
+    EXPECT_TRUE(data.getData(slot).isNull());
+    EXPECT_EQ(data.getSharedData(slot), nullptr);
+    data.setData(slot, static_cast<int>(slot));
+  }
+
+  for (std::size_t slot : slots)
+  {
+    EXPECT_TRUE(data.hasKey(slot));
+    EXPECT_TRUE(data.hasKey(TaskComposerKeys::getKey(slot)));
+    EXPECT_EQ(data.getData(slot).as<int>(), static_cast<int>(slot));
+    EXPECT_EQ(data.getData(TaskComposerKeys::getKey(slot)).as<int>(), static_cast<int>(slot));
+  }
+
+  // The neighbors of the slots have no data
+  EXPECT_FALSE(data.hasKey(std::size_t(1)));
+  EXPECT_FALSE(data.hasKey(std::size_t(65)));
+  EXPECT_FALSE(data.hasKey(std::size_t(513)));
+  EXPECT_FALSE(data.hasKey(std::size_t(32769)));
+  EXPECT_FALSE(data.hasKey(std::size_t(1) << 40U));
+  EXPECT_TRUE(data.getData(std::size_t(1) << 40U).isNull());
+  data.removeData(std::size_t(1) << 40U);
+
+  auto all = data.getData();
+  EXPECT_EQ(all.size(), slots.size());
+  for (std::size_t slot : slots)
+    EXPECT_EQ(all.at(TaskComposerKeys::getKey(slot)).as<int>(), static_cast<int>(slot));
+
+  {  // A copy shares the payloads, removing data from the copy does not affect the original
+    TaskComposerDataStorage copy{ data };
+    EXPECT_TRUE(copy == data);
+    for (std::size_t slot : slots)
+      EXPECT_EQ(copy.getSharedData(slot), data.getSharedData(slot));
+
+    copy.removeData(last_slot);
+    EXPECT_FALSE(copy.hasKey(last_slot));
+    EXPECT_TRUE(data.hasKey(last_slot));
+    EXPECT_FALSE(copy == data);
+  }
+
+  {  // Assignment removes the data the source does not have, including beyond the directly indexed chunks
+    TaskComposerDataStorage assign;
+    assign.setData(std::size_t(100), 1);
+    assign.setData(std::size_t(20000), 1);
+    assign = data;
+    EXPECT_FALSE(assign.hasKey(std::size_t(100)));
+    EXPECT_FALSE(assign.hasKey(std::size_t(20000)));
+    EXPECT_EQ(assign.getData().size(), slots.size());
+    EXPECT_TRUE(assign == data);
+  }
+
+  {  // Move construction and assignment take all chunks
+    TaskComposerDataStorage copy{ data };
+    TaskComposerDataStorage moved{ std::move(copy) };
+    EXPECT_TRUE(moved == data);
+    EXPECT_TRUE(copy.getData().empty());  // NOLINT
+
+    TaskComposerDataStorage move_assign;
+    move_assign.setData(std::size_t(100), 1);
+    move_assign.setData(std::size_t(20000), 1);
+    move_assign = std::move(moved);
+    EXPECT_FALSE(move_assign.hasKey(std::size_t(100)));
+    EXPECT_FALSE(move_assign.hasKey(std::size_t(20000)));
+    EXPECT_TRUE(move_assign == data);
+    EXPECT_TRUE(moved.getData().empty());  // NOLINT
+  }
+
+  {  // Remap between the directly indexed chunks and the chunks beyond them
+    TaskComposerDataStorage remap{ data };
+    const std::string direct_key = TaskComposerKeys::getKey(64);
+    const std::string overflow_key = TaskComposerKeys::getKey(32769);
+    const std::string copy_key = TaskComposerKeys::getKey(100);
+
+    EXPECT_TRUE(remap.remapData({ { direct_key, overflow_key } }, TaskComposerDataStorage::RemapMode::MOVE));
+    EXPECT_FALSE(remap.hasKey(direct_key));
+    EXPECT_EQ(remap.getData(overflow_key).as<int>(), 64);
+
+    EXPECT_TRUE(remap.remapData({ { overflow_key, direct_key } }, TaskComposerDataStorage::RemapMode::ALIAS));
+    EXPECT_TRUE(remap.hasKey(overflow_key));
+    EXPECT_EQ(remap.getSharedData(direct_key), remap.getSharedData(overflow_key));
+
+    EXPECT_TRUE(remap.remapData({ { overflow_key, copy_key } }, TaskComposerDataStorage::RemapMode::COPY));
+    EXPECT_NE(remap.getSharedData(copy_key), remap.getSharedData(overflow_key));
+    EXPECT_EQ(remap.getData(copy_key).as<int>(), 64);
+
+    // Remapping a key to itself keeps the data
+    EXPECT_TRUE(remap.remapData({ { overflow_key, overflow_key } }, TaskComposerDataStorage::RemapMode::MOVE));
+    EXPECT_EQ(remap.getData(overflow_key).as<int>(), 64);
+
+    // The original is not affected
+    EXPECT_EQ(data.getData(direct_key).as<int>(), 64);
+    EXPECT_FALSE(data.hasKey(overflow_key));
   }
 }
 
@@ -143,6 +361,102 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerContextTests)  // NOLINT
   test_suite::runSerializationPointerTest(context, "TaskComposerContextTests");
 }
 
+TEST(TesseractTaskComposerCoreUnit, TaskComposerFutureCompletionTests)  // NOLINT
+{
+  auto context = std::make_shared<TaskComposerContext>("TaskComposerFutureCompletionTests",
+                                                       std::make_unique<TaskComposerDataStorage>());
+  TaskComposerFutureCompletion completion;
+  EXPECT_FALSE(completion.isComplete());
+
+  int count{ 0 };
+  std::shared_ptr<TaskComposerContext> provided;
+  completion.addCallback(
+      [&count, &provided](const std::shared_ptr<TaskComposerContext>& c) {
+        ++count;
+        provided = c;
+      },
+      nullptr);
+  completion.addCallback([](const std::shared_ptr<TaskComposerContext>&) { throw std::runtime_error("failure"); },
+                         nullptr);
+  EXPECT_EQ(count, 0);
+
+  // Exceptions from callbacks do not propagate and every callback is invoked once
+  EXPECT_NO_THROW(completion.complete(context));  // NOLINT
+  EXPECT_TRUE(completion.isComplete());
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(provided, context);
+
+  EXPECT_NO_THROW(completion.complete(context));  // NOLINT
+  EXPECT_EQ(count, 1);
+
+  // Callbacks added after completion are invoked immediately
+  completion.addCallback([&count](const std::shared_ptr<TaskComposerContext>&) { ++count; }, context);
+  EXPECT_EQ(count, 2);
+}
+
+TEST(TesseractTaskComposerCoreUnit, TaskComposerOutputChannelTests)  // NOLINT
+{
+  {  // Queued entries are delivered in order
+    TaskComposerOutputChannel channel;
+    channel.publish(1, tesseract_common::AnyPoly(1));
+    EXPECT_FALSE(channel.tryPop().has_value());
+    EXPECT_FALSE(channel.popFor(std::chrono::milliseconds(1)).has_value());
+    EXPECT_EQ(channel.getDeliveredCount(), 0);
+
+    channel.publish(0, tesseract_common::AnyPoly(0));
+    EXPECT_EQ(channel.getDeliveredCount(), 2);
+
+    // Duplicates are ignored
+    channel.publish(0, tesseract_common::AnyPoly(5));
+    channel.publish(2, tesseract_common::AnyPoly(2));
+    channel.publish(2, tesseract_common::AnyPoly(5));
+    EXPECT_EQ(channel.getDeliveredCount(), 3);
+
+    EXPECT_EQ(channel.pop().value().as<int>(), 0);
+    EXPECT_EQ(channel.tryPop().value().as<int>(), 1);
+    EXPECT_EQ(channel.pop().value().as<int>(), 2);
+
+    // Closing discards entries waiting on a gap and releases consumers
+    channel.publish(4, tesseract_common::AnyPoly(4));
+    EXPECT_FALSE(channel.isClosed());
+    std::thread consumer([&channel]() { EXPECT_FALSE(channel.pop().has_value()); });
+    channel.close();
+    consumer.join();
+    EXPECT_TRUE(channel.isClosed());
+
+    // Entries published after closing are ignored
+    channel.publish(3, tesseract_common::AnyPoly(3));
+    EXPECT_EQ(channel.getDeliveredCount(), 3);
+    EXPECT_FALSE(channel.tryPop().has_value());
+  }
+
+  {  // Callbacks are invoked in order from concurrent publishers
+    std::vector<std::size_t> indices;
+    auto channel = std::make_shared<TaskComposerOutputChannel>(
+        [&indices](std::size_t index, const tesseract_common::AnyPoly& data) {
+          EXPECT_EQ(static_cast<std::size_t>(data.as<int>()), index);
+          indices.push_back(index);
+          if (index == 3)
+            throw std::runtime_error("failure");
+        });
+
+    std::vector<std::thread> publishers;
+    for (int i = 19; i >= 0; --i)
+      publishers.emplace_back(
+          [channel, i]() { channel->publish(static_cast<std::size_t>(i), tesseract_common::AnyPoly(i)); });
+
+    for (auto& publisher : publishers)
+      publisher.join();
+
+    ASSERT_EQ(indices.size(), 20);
+    for (std::size_t i = 0; i < indices.size(); ++i)
+      EXPECT_EQ(indices[i], i);
+
+    channel->close();
+    EXPECT_FALSE(channel->pop().has_value());
+  }
+}
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerLogTests)  // NOLINT
 {
   tesseract_planning::TaskComposerLog log;
@@ -153,6 +467,192 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerLogTests)  // NOLINT
   test_suite::runSerializationTest(log, "TaskComposerLogTests");
 }
 
+TEST(TesseractTaskComposerCoreUnit, TaskComposerLogWriterReaderTests)  // NOLINT
+{
+  std::vector<std::string> joint_names{ "joint_1", "joint_2" };
+  tesseract_common::JointState js1(joint_names, Eigen::Vector2d(5, 10));
+  tesseract_common::JointState js2(joint_names, Eigen::Vector2d(1, 2));
+
+  auto task = std::make_unique<test_suite::TestTask>("TaskComposerLogWriterReaderTests", false);
+  TaskComposerKeys input_keys;
+  input_keys.add(test_suite::TestTask::INOUT_PORT1_PORT, "input_data");
+  input_keys.add(test_suite::TestTask::INOUT_PORT2_PORT, std::vector<std::string>{ "input_data2" });
+  TaskComposerKeys output_keys;
+  output_keys.add(test_suite::TestTask::INOUT_PORT1_PORT, "output_data");
+  output_keys.add(test_suite::TestTask::INOUT_PORT2_PORT, std::vector<std::string>{ "output_data2" });
+  task->setInputKeys(input_keys);
+  task->setOutputKeys(output_keys);
+
+  for (auto compression : { TaskComposerLogCompression::NONE, TaskComposerLogCompression::ZLIB })
+  {
+    const std::string filepath = tesseract_common::getTempPath() + "TaskComposerLogWriterReaderTests.tcls";
+    auto data_storage = std::make_shared<TaskComposerDataStorage>();
+    data_storage->setData("input_data", js1);
+    data_storage->setData("output_data", js2);
+    data_storage->setData("unrelated_data", js2);
+
+    auto writer = std::make_shared<TaskComposerLogWriter>(filepath, "TaskComposerLogWriterReaderTests", compression);
+    EXPECT_TRUE(writer->isOpen());
+    EXPECT_EQ(writer->getFilePath(), filepath);
+    writer->writeInitialData(*data_storage);
+
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerLogWriterReaderTests", data_storage);
+    context->log_writer = writer;
+    EXPECT_EQ(task->run(*context), 0);
+
+    writer->writeContext(*context, true, "digraph {}");
+    writer->close();
+    EXPECT_FALSE(writer->isOpen());
+
+    TaskComposerLogReader reader(filepath);
+    EXPECT_TRUE(reader.isComplete());
+    EXPECT_EQ(reader.getCompression(), compression);
+    EXPECT_EQ(reader.getDescription(), "TaskComposerLogWriterReaderTests");
+    EXPECT_EQ(reader.getDotgraph(), "digraph {}");
+    EXPECT_EQ(reader.getInitialData(), *data_storage);
+    EXPECT_EQ(reader.getFinalData(), *data_storage);
+
+    auto inputs = reader.getNodeInputs(task->getUUID());
+    EXPECT_EQ(inputs.getData().size(), 1);
+    EXPECT_EQ(inputs.getData("input_data").as<tesseract_common::JointState>(), js1);
+
+    auto outputs = reader.getNodeOutputs(task->getUUID());
+    EXPECT_EQ(outputs.getData().size(), 1);
+    EXPECT_EQ(outputs.getData("output_data").as<tesseract_common::JointState>(), js2);
+
+    EXPECT_EQ(reader.getNodeUUIDs().size(), 1);
+    auto info = reader.getNodeInfo(task->getUUID());
+    ASSERT_TRUE(info != nullptr);
+    EXPECT_EQ(*info, *context->task_infos.getInfo(task->getUUID()));
+    EXPECT_EQ(reader.getNodeInfos().getInfoMap().size(), 1);
+    EXPECT_TRUE(reader.getNodeInfo(boost::uuids::uuid{}) == nullptr);
+    EXPECT_TRUE(reader.getNodeInputs(boost::uuids::uuid{}).getData().empty());
+
+    // Truncate the index to verify the chunks are recovered by scanning
+    auto index = reader.getIndex();
+    ASSERT_FALSE(index.empty());
+    const std::string truncated_filepath =
+        tesseract_common::getTempPath() + "TaskComposerLogWriterReaderTests_truncated.tcls";
+    {
+      std::ifstream ifs(filepath, std::ios::binary);
+      std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+      std::ofstream ofs(truncated_filepath, std::ios::binary | std::ios::trunc);
+      const auto& last = index.back();
+      ofs.write(content.data(), static_cast<std::streamsize>(last.offset + last.stored_size));
+    }
+
+    TaskComposerLogReader truncated_reader(truncated_filepath);
+    EXPECT_FALSE(truncated_reader.isComplete());
+    EXPECT_EQ(truncated_reader.getIndex().size(), index.size());
+    EXPECT_EQ(truncated_reader.getNodeOutputs(task->getUUID()), outputs);
+  }
+
+  // Not a streaming log
+  const std::string filepath = tesseract_common::getTempPath() + "TaskComposerLogWriterReaderTests.txt";
+  {
+    std::ofstream ofs(filepath, std::ios::trunc);
+    ofs << "not a streaming log";
+  }
+  EXPECT_ANY_THROW(std::make_unique<TaskComposerLogReader>(filepath));  // NOLINT
+}
+
+TEST(TesseractTaskComposerCoreUnit, TaskComposerTraceWriterTests)  // NOLINT
+{
+  const auto countEvents = [](const YAML::Node& trace, const std::string& phase) {
+    std::size_t count{ 0 };
+    for (const auto& event : trace)
+      count += (event["ph"].as<std::string>() == phase) ? 1 : 0;
+    return count;
+  };
+
+  auto pipeline = std::make_unique<TaskComposerPipeline>("TaskComposerTraceWriterTests");
+  boost::uuids::uuid uuid1 = pipeline->addNode(std::make_unique<test_suite::TestTask>("Task1", false));
+  boost::uuids::uuid uuid2 = pipeline->addNode(std::make_unique<test_suite::TestTask>("Task2", false));
+  pipeline->addEdges(uuid1, { uuid2 });
+  pipeline->setTerminals({ uuid2 });
+
+  {  // Offline
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerTraceWriterTests",
+                                                         std::make_unique<TaskComposerDataStorage>());
+    pipeline->run(*context);
+    EXPECT_TRUE(context->isSuccessful());
+
+    std::stringstream ss;
+    TaskComposerTraceWriter::toTrace(ss, context->task_infos);
+    YAML::Node trace = YAML::Load(ss.str());
+    ASSERT_TRUE(trace.IsSequence());
+    EXPECT_EQ(countEvents(trace, "X"), 3);
+    EXPECT_EQ(countEvents(trace, "M"), 1);
+    EXPECT_EQ(countEvents(trace, "s"), 1);
+    EXPECT_EQ(countEvents(trace, "f"), 1);
+    EXPECT_EQ(countEvents(trace, "C"), 0);
+    for (const auto& event : trace)
+    {
+      if (event["ph"].as<std::string>() == "X")
+        EXPECT_GE(event["ts"].as<double>(), 0);
+    }
+
+    const std::string filepath = tesseract_common::getTempPath() + "TaskComposerTraceWriterTests.json";
+    EXPECT_TRUE(TaskComposerTraceWriter::saveTrace(filepath, context->task_infos));
+  }
+
+  {  // Live
+    std::stringstream ss;
+    auto trace_writer = std::make_shared<TaskComposerTraceWriter>(ss);
+    trace_writer->setFlushInterval(std::chrono::hours(1));
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerTraceWriterTests",
+                                                         std::make_unique<TaskComposerDataStorage>());
+    context->trace_writer = trace_writer;
+    pipeline->run(*context);
+
+    // Events are buffered until flushed and available before the writer is closed
+    EXPECT_EQ(ss.str().find("Task1"), std::string::npos);
+    trace_writer->flush();
+    EXPECT_NE(ss.str().find("Task1"), std::string::npos);
+    trace_writer->close();
+
+    YAML::Node trace = YAML::Load(ss.str());
+    ASSERT_TRUE(trace.IsSequence());
+    EXPECT_EQ(countEvents(trace, "X"), 3);
+    EXPECT_EQ(countEvents(trace, "s"), 1);
+    EXPECT_EQ(countEvents(trace, "f"), 1);
+  }
+
+  {  // Live without buffering
+    std::stringstream ss;
+    auto trace_writer = std::make_shared<TaskComposerTraceWriter>(ss);
+    trace_writer->setFlushInterval(std::chrono::milliseconds(0));
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerTraceWriterTests",
+                                                         std::make_unique<TaskComposerDataStorage>());
+    context->trace_writer = trace_writer;
+    pipeline->run(*context);
+    EXPECT_NE(ss.str().find("Task2"), std::string::npos);
+  }
+
+  {  // Counters
+    TaskComposerNodeInfoContainer container;
+    auto info = std::make_unique<TaskComposerNodeInfo>(*pipeline->getNodeByName("Task1"));
+    info->data_storage.setData("waypoints_in", 10);
+    info->data_storage.setData("waypoints_out", 20.5);
+    info->data_storage.setData("description", std::string("not a counter"));
+    container.addInfo(std::move(info));
+
+    std::stringstream ss;
+    TaskComposerTraceWriter::toTrace(ss, container);
+    YAML::Node trace = YAML::Load(ss.str());
+    ASSERT_EQ(countEvents(trace, "C"), 1);
+    for (const auto& event : trace)
+    {
+      if (event["ph"].as<std::string>() != "C")
+        continue;
+
+      EXPECT_EQ(event["args"].size(), 2);
+      EXPECT_EQ(event["args"]["waypoints_in"].as<double>(), 10);
+      EXPECT_EQ(event["args"]["waypoints_out"].as<double>(), 20.5);
+    }
+  }
+}
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerNodeInfoContainerTests)  // NOLINT
 {
   test_suite::DummyTaskComposerNode node;
@@ -1760,7 +2260,7 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerRemapTaskTests)  // NOLINT
   {  // Serialization
     std::map<std::string, std::string> remap;
     remap["test"] = "test2";
-    auto task = std::make_unique<RemapTask>("abc", remap, false, true);
+    auto task = std::make_unique<RemapTask>("abc", remap, TaskComposerDataStorage::RemapMode::ALIAS, true);
 
     // Serialization
     test_suite::runSerializationPointerTest(task, "TaskComposerRemapTaskTests");
@@ -1850,6 +2350,49 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerRemapTaskTests)  // NOLINT
     EXPECT_TRUE(context->task_infos.getAbortingNode().is_nil());
   }
 
+  {  // Test run method alias with config
+    auto data_storage = std::make_unique<TaskComposerDataStorage>();
+    data_storage->setData(key, js);
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerRemapTaskTests", std::move(data_storage));
+
+    TaskComposerPluginFactory factory;
+    std::string str = R"(config:
+                           conditional: true
+                           alias: true
+                           inputs:
+                             keys: [joint_state]
+                           outputs:
+                             keys: [remap_joint_state])";
+    YAML::Node config = YAML::Load(str);
+
+    RemapTask task("RemapTaskTest", config["config"], factory);
+    EXPECT_EQ(task.run(*context), 1);
+    EXPECT_TRUE(context->data_storage->hasKey(key));
+    EXPECT_TRUE(context->data_storage->hasKey(remap_key));
+    EXPECT_EQ(context->data_storage->getSharedData(key), context->data_storage->getSharedData(remap_key));
+    auto node_info = context->task_infos.getInfo(task.getUUID());
+    EXPECT_EQ(node_info->color, "green");
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(node_info->status_message, "Successful");
+    EXPECT_EQ(context->isSuccessful(), true);
+  }
+
+  {  // Test run method alias
+    auto data_storage = std::make_unique<TaskComposerDataStorage>();
+    data_storage->setData(key, js);
+    auto context = std::make_shared<TaskComposerContext>("TaskComposerRemapTaskTests", std::move(data_storage));
+
+    std::map<std::string, std::string> remap;
+    remap[key] = remap_key;
+
+    RemapTask task("RemapTaskTest", remap, TaskComposerDataStorage::RemapMode::ALIAS, true);
+    EXPECT_EQ(task.run(*context), 1);
+    EXPECT_TRUE(context->data_storage->hasKey(key));
+    EXPECT_TRUE(context->data_storage->hasKey(remap_key));
+    EXPECT_EQ(context->data_storage->getSharedData(key), context->data_storage->getSharedData(remap_key));
+    EXPECT_EQ(context->isSuccessful(), true);
+  }
+
   {  // Test run method move with config
     auto data_storage = std::make_unique<TaskComposerDataStorage>();
     data_storage->setData(key, js);
@@ -1892,6 +2435,17 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerRemapTaskTests)  // NOLINT
     YAML::Node config = YAML::Load(str);
     EXPECT_ANY_THROW(std::make_unique<RemapTask>("abc", config["config"], factory));  // NOLINT
 
+    str = R"(config:
+               conditional: true
+               copy: true
+               alias: true
+               inputs:
+                 keys: [input_data]
+               outputs:
+                 keys: [output_data])";
+    config = YAML::Load(str);
+    EXPECT_ANY_THROW(std::make_unique<RemapTask>("abc", config["config"], factory));  // NOLINT
+
     str = R"(config:
                conditional: true
                inputs:
@@ -2346,6 +2900,18 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerServerTests)  // NOLINT
       EXPECT_TRUE(future->context->task_infos.getAbortingNode().is_nil());
     }
 
+    {  // Run method with a priority class
+      auto data_storage = std::make_unique<TaskComposerDataStorage>();
+      auto future =
+          server.run("TestPipeline", std::move(data_storage), false, "TaskflowExecutor", TaskComposerPriority::HIGH);
+      future->wait();
+
+      EXPECT_EQ(future->context->priority, TaskComposerPriority::HIGH);
+      EXPECT_EQ(future->context->isSuccessful(), true);
+      EXPECT_EQ(server.getMetrics("TaskflowExecutor", TaskComposerPriority::HIGH).completed, 1);
+      EXPECT_ANY_THROW(server.getMetrics("DoesNotExist", TaskComposerPriority::HIGH));  // NOLINT
+    }
+
     {  // Failures, executor does not exist
       auto data_storage = std::make_unique<TaskComposerDataStorage>();
       EXPECT_ANY_THROW(server.run("TestPipeline", std::move(data_storage), false, "DoesNotExist"));  // NOLINT
@@ -0,0 +1,325 @@
+/**
+ * @file tesseract_task_composer_overhead_benchmark.cpp
+ * @brief Benchmark the cost of the task composer framework alone, without any planning work
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/uuid/uuid_generators.hpp>
+#include <chrono>
+#include <cstdint>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/joint_state.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_graph.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_pipeline.h>
+#include <tesseract_task_composer/core/task_composer_server.h>
+#include <tesseract_task_composer/core/test_suite/test_task.h>
+#include <tesseract_task_composer/taskflow/taskflow_task_composer_executor.h>
+
+using namespace tesseract_planning;
+
+/** @brief The executor shared by all graph benchmarks so thread pool startup is not part of the measurement */
+TaskComposerExecutor& getExecutor()
+{
+  static TaskflowTaskComposerExecutor executor("TaskflowExecutor");
+  return executor;
+}
+
+/** @brief Report the nanoseconds spent per node, the time of one iteration divided by the number of nodes run */
+void setNodeOverheadCounter(benchmark::State& state, double elapsed_seconds, std::size_t node_count)
+{
+  double runs = static_cast<double>(state.iterations()) * static_cast<double>(node_count);
+  state.counters["nodes"] = static_cast<double>(node_count);
+  state.counters["ns_per_node"] = (runs > 0) ? (elapsed_seconds * 1e9) / runs : 0;
+}
+
+/** @brief A root task which fans out to width empty tasks which are joined by a single terminal task */
+std::unique_ptr<TaskComposerGraph> createWideGraph(std::size_t width)
+{
+  auto graph = std::make_unique<TaskComposerGraph>("WideGraph");
+  boost::uuids::uuid root = graph->addNode(std::make_unique<test_suite::TestTask>("Root", false));
+  boost::uuids::uuid sink = graph->addNode(std::make_unique<test_suite::TestTask>("Sink", false));
+
+  std::vector<boost::uuids::uuid> branches;
+  branches.reserve(width);
+  for (std::size_t i = 0; i < width; ++i)
+  {
+    branches.push_back(graph->addNode(std::make_unique<test_suite::TestTask>("Branch" + std::to_string(i), false)));
+    graph->addEdges(branches.back(), { sink });
+  }
+
+  graph->addEdges(root, branches);
+  graph->setTerminals({ sink });
+  return graph;
+}
+
+/** @brief A chain of depth empty tasks */
+std::unique_ptr<TaskComposerGraph> createDeepGraph(std::size_t depth)
+{
+  auto graph = std::make_unique<TaskComposerGraph>("DeepGraph");
+  boost::uuids::uuid prev = graph->addNode(std::make_unique<test_suite::TestTask>("Node0", false));
+  for (std::size_t i = 1; i < depth; ++i)
+  {
+    boost::uuids::uuid next =
+        graph->addNode(std::make_unique<test_suite::TestTask>("Node" + std::to_string(i), false));
+    graph->addEdges(prev, { next });
+    prev = next;
+  }
+
+  graph->setTerminals({ prev });
+  return graph;
+}
+
+/** @brief Run a graph through the taskflow executor and report the scheduling overhead per node */
+void runGraphBenchmark(benchmark::State& state, const TaskComposerGraph& graph)
+{
+  // The graph node itself is also scheduled
+  const std::size_t node_count = graph.getNodes().size() + 1;
+  TaskComposerExecutor& executor = getExecutor();
+
+  double elapsed_seconds{ 0 };
+  for (auto _ : state)
+  {
+    auto start = std::chrono::steady_clock::now();
+    TaskComposerFuture::UPtr future = executor.run(graph, std::make_shared<TaskComposerDataStorage>());
+    future->wait();
+    elapsed_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!future->context->isSuccessful())
+    {
+      state.SkipWithError("Graph did not run successfully");
+      return;
+    }
+  }
+
+  setNodeOverheadCounter(state, elapsed_seconds, node_count);
+}
+
+static void BM_TaskflowWideGraph(benchmark::State& state)
+{
+  auto graph = createWideGraph(static_cast<std::size_t>(state.range(0)));
+  runGraphBenchmark(state, *graph);
+}
+
+BENCHMARK(BM_TaskflowWideGraph)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMicrosecond);
+
+static void BM_TaskflowDeepGraph(benchmark::State& state)
+{
+  auto graph = createDeepGraph(static_cast<std::size_t>(state.range(0)));
+  runGraphBenchmark(state, *graph);
+}
+
+BENCHMARK(BM_TaskflowDeepGraph)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief A pipeline of depth conditional tasks, each one continues to the next on success and to an error task on
+ * failure, similar to the check and fix stages of the planning pipelines
+ */
+std::unique_ptr<TaskComposerPipeline> createConditionalPipeline(std::size_t depth)
+{
+  auto pipeline = std::make_unique<TaskComposerPipeline>("ConditionalPipeline");
+  boost::uuids::uuid error = pipeline->addNode(std::make_unique<test_suite::TestTask>("Error", false));
+
+  auto last_task = std::make_unique<test_suite::TestTask>("Done", false);
+  last_task->return_value = 1;
+  boost::uuids::uuid done = pipeline->addNode(std::move(last_task));
+  boost::uuids::uuid next = done;
+  for (std::size_t i = depth; i > 0; --i)
+  {
+    auto task = std::make_unique<test_suite::TestTask>("Check" + std::to_string(i), true);
+    task->return_value = 1;
+    boost::uuids::uuid current = pipeline->addNode(std::move(task));
+    pipeline->addEdges(current, { error, next });
+    next = current;
+  }
+
+  pipeline->setTerminals({ error, done });
+  return pipeline;
+}
+
+static void BM_PipelineConditionalChain(benchmark::State& state)
+{
+  auto pipeline = createConditionalPipeline(static_cast<std::size_t>(state.range(0)));
+
+  // The conditional tasks, the done task and the pipeline itself are run
+  const std::size_t node_count = static_cast<std::size_t>(state.range(0)) + 2;
+  double elapsed_seconds{ 0 };
+  for (auto _ : state)
+  {
+    TaskComposerContext context("ConditionalPipeline", std::make_shared<TaskComposerDataStorage>());
+    auto start = std::chrono::steady_clock::now();
+    pipeline->run(context);
+    elapsed_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  setNodeOverheadCounter(state, elapsed_seconds, node_count);
+}
+
+BENCHMARK(BM_PipelineConditionalChain)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMicrosecond);
+
+/** @brief The number of keys shared between the threads of the data storage benchmarks */
+static constexpr std::size_t DATA_STORAGE_KEY_COUNT{ 16 };
+
+TaskComposerDataStorage& getSharedDataStorage()
+{
+  static TaskComposerDataStorage data_storage = [] {
+    TaskComposerDataStorage storage;
+    tesseract_common::JointState js({ "joint_1", "joint_2" }, Eigen::VectorXd::Zero(2));
+    for (std::size_t i = 0; i < DATA_STORAGE_KEY_COUNT; ++i)
+      storage.setData("key" + std::to_string(i), js);
+    return storage;
+  }();
+  return data_storage;
+}
+
+/** @brief The shared key used by a thread, threads share keys once there are more than DATA_STORAGE_KEY_COUNT */
+std::string getSharedKey(int thread_index)
+{
+  return "key" + std::to_string(static_cast<std::size_t>(thread_index) % DATA_STORAGE_KEY_COUNT);
+}
+
+static void BM_DataStorageGetData(benchmark::State& state)
+{
+  TaskComposerDataStorage& data_storage = getSharedDataStorage();
+  const std::string key = getSharedKey(state.thread_index());
+  for (auto _ : state)
+    benchmark::DoNotOptimize(data_storage.getData(key));
+}
+
+BENCHMARK(BM_DataStorageGetData)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_DataStorageSetData(benchmark::State& state)
+{
+  TaskComposerDataStorage& data_storage = getSharedDataStorage();
+  const std::string key = getSharedKey(state.thread_index());
+  tesseract_common::JointState js({ "joint_1", "joint_2" }, Eigen::VectorXd::Ones(2));
+  for (auto _ : state)
+    data_storage.setData(key, js);
+}
+
+BENCHMARK(BM_DataStorageSetData)->ThreadRange(1, 32)->UseRealTime();
+
+/** @brief Every thread moves its value back and forth between two keys so the remap always succeeds */
+static void BM_DataStorageRemapData(benchmark::State& state)
+{
+  TaskComposerDataStorage& data_storage = getSharedDataStorage();
+  const std::string key = "remap" + std::to_string(state.thread_index());
+  const std::string other_key = key + "_out";
+  data_storage.setData(key, tesseract_common::JointState({ "joint_1", "joint_2" }, Eigen::VectorXd::Ones(2)));
+
+  const std::map<std::string, std::string> forward{ { key, other_key } };
+  const std::map<std::string, std::string> backward{ { other_key, key } };
+  for (auto _ : state)
+  {
+    data_storage.remapData(forward);
+    data_storage.remapData(backward);
+  }
+}
+
+BENCHMARK(BM_DataStorageRemapData)->ThreadRange(1, 32)->UseRealTime();
+
+/** @brief Add infos to a container, the average cost per info shows how adding scales with the container size */
+static void BM_NodeInfoContainerAddInfo(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  boost::uuids::random_generator gen;
+  std::vector<boost::uuids::uuid> uuids(count);
+  for (auto& uuid : uuids)
+    uuid = gen();
+
+  for (auto _ : state)
+  {
+    TaskComposerNodeInfoContainer container;
+    for (const auto& uuid : uuids)
+    {
+      auto info = std::make_unique<TaskComposerNodeInfo>();
+      info->uuid = uuid;
+      container.addInfo(std::move(info));
+    }
+    benchmark::DoNotOptimize(container);
+  }
+
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_NodeInfoContainerAddInfo)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+/** @brief Look up a single info in a container holding range(0) infos */
+static void BM_NodeInfoContainerGetInfo(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  boost::uuids::random_generator gen;
+  TaskComposerNodeInfoContainer container;
+  boost::uuids::uuid key{};
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>();
+    info->uuid = gen();
+    key = info->uuid;
+    container.addInfo(std::move(info));
+  }
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(container.getInfo(key));
+}
+
+BENCHMARK(BM_NodeInfoContainerGetInfo)->RangeMultiplier(10)->Range(10, 100000);
+
+/** @brief Load the shipped plugin config, this is the startup cost paid by every application using the server */
+static void BM_TaskComposerServerLoadConfig(benchmark::State& state)
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto resource = locator.locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml");
+  if (resource == nullptr)
+  {
+    state.SkipWithError("Failed to locate task_composer_plugins.yaml");
+    return;
+  }
+
+  const tesseract_common::fs::path config_path(resource->getFilePath());
+  for (auto _ : state)
+  {
+    TaskComposerServer server;
+    server.loadConfig(config_path, locator);
+    benchmark::DoNotOptimize(server);
+  }
+}
+
+BENCHMARK(BM_TaskComposerServerLoadConfig)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_ERROR);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -2,7 +2,12 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <set>
+#include <thread>
 #include <boost/algorithm/string.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -25,18 +30,25 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/planning/nodes/motion_planner_task.hpp>
 #include <tesseract_task_composer/planning/nodes/raster_motion_task.h>
 #include <tesseract_task_composer/planning/nodes/raster_only_motion_task.h>
+#include <tesseract_task_composer/planning/nodes/race_planner_task.h>
+#include <tesseract_task_composer/planning/nodes/retry_with_escalation_task.h>
 
 #include <tesseract_task_composer/planning/profiles/contact_check_profile.h>
+#include <tesseract_task_composer/planning/environment_snapshot.h>
+#include <tesseract_task_composer/planning/task_composer_batch_runner.h>
 
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
 
 #include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
 #include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_log.h>
+#include <tesseract_task_composer/core/task_composer_output_channel.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 #include <tesseract_task_composer/core/test_suite/task_composer_serialization_utils.hpp>
 #include <tesseract_task_composer/core/test_suite/test_programs.hpp>
+#include <tesseract_task_composer/core/test_suite/test_planner_task.hpp>
 
 #include <tesseract_command_language/profile_dictionary.h>
 #include <tesseract_command_language/composite_instruction.h>
@@ -50,6 +62,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/manipulator_info.h>
 #include <tesseract_common/joint_state.h>
 
+#include <tesseract_collision/core/discrete_contact_manager.h>
+
 #include <tesseract_environment/environment.h>
 
 using namespace tesseract_planning;
@@ -3274,6 +3288,117 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterMotionTaskTests)  //
   }
 }
 
+namespace
+{
+using ConfigurePlannerFn = std::function<void(test_suite::TestPlannerTask&, std::size_t)>;
+
+/** @brief Create a raster task of stand in planners which publishes its segments to the 'segment_channel' */
+std::unique_ptr<RasterMotionTask> createSegmentChannelRasterTask(ConfigurePlannerFn configure_raster = nullptr,
+                                                                 ConfigurePlannerFn configure_transition = nullptr)
+{
+  using TaskFactoryResults = RasterMotionTask::TaskFactoryResults;
+  return std::make_unique<RasterMotionTask>(
+      "RasterMotionTask",
+      "input_data",
+      "environment",
+      "output_data",
+      true,
+      test_suite::createTestPlannerTaskFactory<TaskFactoryResults>(nullptr, "freespace"),
+      test_suite::createTestPlannerTaskFactory<TaskFactoryResults>(std::move(configure_raster), "raster"),
+      test_suite::createTestPlannerTaskFactory<TaskFactoryResults>(std::move(configure_transition), "transition"),
+      "segment_channel");
+}
+}  // namespace
+
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterMotionTaskSegmentChannelTests)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  tesseract_common::fs::path config_path(
+      locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+  TaskComposerPluginFactory factory(config_path, locator);
+  std::shared_ptr<TaskComposerExecutor> executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+
+  const CompositeInstruction program = test_suite::rasterExampleProgram();
+  auto run = [this, &executor, &program](const RasterMotionTask& task,
+                                         const std::shared_ptr<TaskComposerOutputChannel>& channel) {
+    auto data = std::make_unique<TaskComposerDataStorage>();
+    data->setData("input_data", program);
+    data->setData("environment", std::shared_ptr<const tesseract_environment::Environment>(env_));
+    data->setData("segment_channel", channel);
+
+    TaskComposerFuture::UPtr future = executor->run(task, std::move(data));
+    future->wait();
+    return future;
+  };
+
+  {  // Segments are published in program order and match the planned program
+    std::vector<std::size_t> indices;
+    std::vector<CompositeInstruction> segments;
+    auto channel = std::make_shared<TaskComposerOutputChannel>(
+        [&indices, &segments](std::size_t index, const tesseract_common::AnyPoly& data) {
+          indices.push_back(index);
+          segments.push_back(data.as<CompositeInstruction>());
+        });
+
+    // The later rasters finish first so the segments are published out of order
+    auto task = createSegmentChannelRasterTask([](test_suite::TestPlannerTask& planner, std::size_t index) {
+      planner.delay = std::chrono::milliseconds(40 / index);
+    });
+    TaskComposerFuture::UPtr future = run(*task, channel);
+    EXPECT_TRUE(future->context->isSuccessful());
+    EXPECT_FALSE(future->context->isAborted());
+    EXPECT_TRUE(channel->isClosed());
+
+    ASSERT_TRUE(future->context->data_storage->hasKey("output_data"));
+    auto output = future->context->data_storage->getData("output_data").as<CompositeInstruction>();
+    ASSERT_EQ(output.size(), program.size());
+    ASSERT_EQ(indices.size(), output.size());
+    EXPECT_EQ(channel->getDeliveredCount(), output.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+      EXPECT_EQ(indices[i], i);
+      EXPECT_EQ(segments[i], output[i].as<CompositeInstruction>());
+    }
+  }
+
+  {  // A failed segment which aborts the raster closes the channel without publishing past it
+    auto channel = std::make_shared<TaskComposerOutputChannel>();
+    auto task = createSegmentChannelRasterTask(nullptr, [](test_suite::TestPlannerTask& planner, std::size_t index) {
+      planner.abort_on_failure = true;
+      planner.plan = [index](const TaskComposerContext& /*context*/, CompositeInstruction& /*program*/) {
+        return (index != 1);
+      };
+    });
+    TaskComposerFuture::UPtr future = run(*task, channel);
+    EXPECT_TRUE(future->context->isAborted());
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+    EXPECT_TRUE(channel->isClosed());
+
+    // The first transition is the segment at index two of the program
+    EXPECT_LE(channel->getDeliveredCount(), 2);
+    std::size_t popped{ 0 };
+    while (channel->tryPop().has_value())
+      ++popped;
+    EXPECT_EQ(popped, channel->getDeliveredCount());
+    EXPECT_FALSE(channel->pop().has_value());
+  }
+
+  {  // A failed segment which does not abort leaves a gap and the channel is still closed
+    auto channel = std::make_shared<TaskComposerOutputChannel>();
+    auto task = createSegmentChannelRasterTask([](test_suite::TestPlannerTask& planner, std::size_t index) {
+      planner.plan = [index](const TaskComposerContext& /*context*/, CompositeInstruction& /*program*/) {
+        return (index != 2);
+      };
+    });
+    TaskComposerFuture::UPtr future = run(*task, channel);
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+    EXPECT_TRUE(channel->isClosed());
+
+    // The second raster is the segment at index three of the program
+    EXPECT_LE(channel->getDeliveredCount(), 3);
+  }
+}
+
 TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterOnlyMotionTaskTests)  // NOLINT
 {
   tesseract_common::GeneralResourceLocator locator;
@@ -3711,6 +3836,813 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterOnlyMotionTaskTests)
   }
 }
 
+namespace
+{
+/** @brief A race validator which rejects programs with the description 'invalid' */
+class RaceValidatorTask : public TaskComposerTask
+{
+public:
+  explicit RaceValidatorTask(std::string name) : TaskComposerTask(std::move(name), RaceValidatorTask::ports(), true)
+  {
+    input_keys_.add("program", "output_data");
+    validatePorts();
+  }
+
+protected:
+  static TaskComposerNodePorts ports()
+  {
+    TaskComposerNodePorts ports;
+    ports.input_required["program"] = TaskComposerNodePorts::SINGLE;
+    return ports;
+  }
+
+  std::unique_ptr<TaskComposerNodeInfo> runImpl(TaskComposerContext& context,
+                                                OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    const auto& program = getData(*context.data_storage, "program").as<CompositeInstruction>();
+    info->return_value = (program.getDescription() == "invalid") ? 0 : 1;
+    return info;
+  }
+};
+
+/** @brief A race contender which sets the description after a delay, failing if the description is empty */
+RacePlannerTask::TaskFactory createRaceContenderFactory(std::chrono::milliseconds delay,
+                                                        const std::string& description,
+                                                        std::shared_ptr<std::atomic<bool>> observed_abort = nullptr)
+{
+  return test_suite::createTestPlannerTaskFactory<RacePlannerTask::TaskFactoryResults>(
+      [delay, description, observed_abort](test_suite::TestPlannerTask& task, std::size_t /*index*/) {
+        task.delay = delay;
+        task.observed_abort = observed_abort;
+        task.plan = [description](const TaskComposerContext& /*context*/, CompositeInstruction& program) {
+          program.setDescription(description);
+          return !description.empty();
+        };
+      });
+}
+}  // namespace
+
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRacePlannerTaskTests)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  tesseract_common::fs::path config_path(
+      locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+  TaskComposerPluginFactory factory(config_path, locator);
+
+  {  // Construction
+    RacePlannerTask task;
+    EXPECT_EQ(task.getName(), "RacePlannerTask");
+    EXPECT_EQ(task.isConditional(), true);
+  }
+
+  {  // Construction
+    std::string str = R"(config:
+                           conditional: true
+                           inputs:
+                             program: input_data
+                           outputs:
+                             program: output_data
+                           contenders:
+                             - task: OMPLPipeline
+                               config:
+                                 abort_terminal: 0
+                             - task: TrajOptPipeline
+                               name: TrajOpt
+                               config:
+                                 abort_terminal: 0
+                           validator:
+                             class: DiscreteContactCheckTaskFactory
+                             config:
+                               conditional: true
+                               inputs:
+                                 program: output_data
+                                 environment: environment
+                                 profiles: profiles)";
+    YAML::Node config = YAML::Load(str);
+    RacePlannerTask task("abc", config["config"], factory);
+    EXPECT_EQ(task.getName(), "abc");
+    EXPECT_EQ(task.isConditional(), true);
+    EXPECT_EQ(task.getInputKeys().size(), 1);
+    EXPECT_EQ(task.getInputKeys().get(RacePlannerTask::INOUT_PROGRAM_PORT), "input_data");
+    EXPECT_EQ(task.getOutputKeys().size(), 1);
+    EXPECT_EQ(task.getOutputKeys().get(RacePlannerTask::INOUT_PROGRAM_PORT), "output_data");
+    EXPECT_EQ(task.getOutboundEdges().size(), 0);
+    EXPECT_EQ(task.getInboundEdges().size(), 0);
+  }
+
+  {  // Construction failure
+    std::string str = R"(config:
+                           conditional: true
+                           inputs:
+                             program: input_data
+                           outputs:
+                             program: output_data)";
+    YAML::Node config = YAML::Load(str);
+    EXPECT_ANY_THROW(std::make_unique<RacePlannerTask>("abc", config["config"], factory));  // NOLINT
+  }
+
+  {  // Construction failure
+    std::string str = R"(config:
+                           conditional: true
+                           inputs:
+                             program: input_data
+                           outputs:
+                             program: output_data
+                           contenders:
+                             - config:
+                                 abort_terminal: 0)";
+    YAML::Node config = YAML::Load(str);
+    EXPECT_ANY_THROW(std::make_unique<RacePlannerTask>("abc", config["config"], factory));  // NOLINT
+  }
+
+  {  // Construction failure
+    EXPECT_ANY_THROW(std::make_unique<RacePlannerTask>(  // NOLINT
+        "abc", "input_data", "output_data", true, std::vector<RacePlannerTask::TaskFactory>{}));
+  }
+
+  {  // Serialization
+    auto task = std::make_unique<RacePlannerTask>();
+
+    // Serialization
+    test_suite::runSerializationPointerTest(task, "TaskComposerRacePlannerTaskTests");
+  }
+
+  auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+
+  {  // The fastest valid contender wins and the slow contender is aborted
+    auto observed_abort = std::make_shared<std::atomic<bool>>(false);
+    std::vector<RacePlannerTask::TaskFactory> contenders;
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(10000), "slow", observed_abort));
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(1), "invalid"));
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(50), "valid"));
+    RacePlannerTask task("abc",
+                         "input_data",
+                         "output_data",
+                         true,
+                         contenders,
+                         [](const std::string& name, std::size_t /*index*/) {
+                           RacePlannerTask::TaskFactoryResults tf_results;
+                           tf_results.node = std::make_unique<RaceValidatorTask>(name);
+                           tf_results.input_key = "output_data";
+                           return tf_results;
+                         });
+
+    auto data = std::make_unique<TaskComposerDataStorage>();
+    data->setData("input_data", CompositeInstruction());
+
+    const auto start = std::chrono::steady_clock::now();
+    TaskComposerFuture::UPtr future = executor->run(task, std::move(data));
+    future->wait();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // The tail latency is bound by the fastest valid contender, not the slow one
+    EXPECT_LT(elapsed, std::chrono::milliseconds(5000));
+    EXPECT_TRUE(future->context->isSuccessful());
+    auto output = future->context->data_storage->getData("output_data");
+    ASSERT_FALSE(output.isNull());
+    EXPECT_EQ(output.as<CompositeInstruction>().getDescription(), "valid");
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(node_info->data_storage.getData("winner").as<std::string>(), "Contender2");
+    EXPECT_EQ(node_info->data_storage.getData("winner_index").as<int>(), 2);
+    EXPECT_EQ(node_info->data_storage.getData("contenders").as<int>(), 3);
+
+    // The slow contender stops once it observes the abort
+    for (int i = 0; i < 5000 && !(*observed_abort); ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_TRUE(*observed_abort);
+  }
+
+  {  // Every contender fails
+    std::vector<RacePlannerTask::TaskFactory> contenders;
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(1), ""));
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(10), ""));
+    RacePlannerTask task("abc", "input_data", "output_data", true, contenders);
+
+    auto data = std::make_unique<TaskComposerDataStorage>();
+    data->setData("input_data", CompositeInstruction());
+
+    TaskComposerFuture::UPtr future = executor->run(task, std::move(data));
+    future->wait();
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_FALSE(node_info->data_storage.hasKey("winner"));
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+  }
+
+  {  // Input is not a composite instruction
+    std::vector<RacePlannerTask::TaskFactory> contenders;
+    contenders.push_back(createRaceContenderFactory(std::chrono::milliseconds(1), "valid"));
+    RacePlannerTask task("abc", "input_data", "output_data", true, contenders);
+
+    auto data = std::make_unique<TaskComposerDataStorage>();
+    data->setData("input_data", 1.0);
+
+    TaskComposerFuture::UPtr future = executor->run(task, std::move(data));
+    future->wait();
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_FALSE(node_info->status_message.empty());
+  }
+}
+
+namespace
+{
+/** @brief The profile namespace of the stand in planner */
+const std::string ESCALATION_STUB_NAMESPACE = "EscalationStubPlanner";
+
+/**
+ * @brief A stand in planner which deterministically fails unless the program uses an accepted profile
+ * @details The 'SLOW' profile never finishes on its own, it runs until aborted. The 'STUBBORN' profile ignores the
+ * abort, it succeeds after 200 ms and then sets stubborn_finished.
+ */
+RetryWithEscalationTask::TaskFactory
+createEscalationStubFactory(const std::set<std::string>& accepted,
+                            std::shared_ptr<std::atomic<bool>> observed_abort = nullptr,
+                            std::shared_ptr<std::atomic<bool>> stubborn_finished = nullptr)
+{
+  return test_suite::createTestPlannerTaskFactory<RetryWithEscalationTask::TaskFactoryResults>(
+      [accepted, observed_abort, stubborn_finished](test_suite::TestPlannerTask& task, std::size_t /*index*/) {
+        task.plan = [accepted, observed_abort, stubborn_finished](const TaskComposerContext& context,
+                                                                  CompositeInstruction& program) {
+          const std::string profile = program.getProfile(ESCALATION_STUB_NAMESPACE);
+          if (profile == "SLOW")
+          {
+            const bool aborted = test_suite::TestPlannerTask::waitForAbort(context, std::chrono::seconds(10));
+            if (observed_abort != nullptr)
+              *observed_abort = aborted;
+
+            return false;
+          }
+
+          if (profile == "STUBBORN")
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            program.setDescription(profile);
+            if (stubborn_finished != nullptr)
+              *stubborn_finished = true;
+
+            return true;
+          }
+
+          // The override must be applied to the move instructions as well
+          const auto* mi = program.getFirstMoveInstruction();
+          if (mi == nullptr || mi->getProfile(ESCALATION_STUB_NAMESPACE) != profile ||
+              mi->getPathProfile(ESCALATION_STUB_NAMESPACE) != profile || accepted.count(profile) == 0)
+            return false;
+
+          program.setDescription(profile);
+          return true;
+        };
+      });
+}
+
+/** @brief Run the task on the freespace example program */
+TaskComposerFuture::UPtr runEscalationTask(TaskComposerExecutor& executor, const RetryWithEscalationTask& task)
+{
+  auto data = std::make_unique<TaskComposerDataStorage>();
+  data->setData("input_data", test_suite::freespaceExampleProgramABB());
+  TaskComposerFuture::UPtr future = executor.run(task, std::move(data));
+  future->wait();
+  return future;
+}
+}  // namespace
+
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRetryWithEscalationTaskTests)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  tesseract_common::fs::path config_path(
+      locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+  TaskComposerPluginFactory factory(config_path, locator);
+  RetryWithEscalationTask::clearProfileStatistics();
+
+  const std::vector<std::string> namespaces{ ESCALATION_STUB_NAMESPACE };
+  const std::vector<std::string> profiles{ "DEFAULT", "MEDIUM", "HIGH" };
+
+  {  // Construction
+    RetryWithEscalationTask task;
+    EXPECT_EQ(task.getName(), "RetryWithEscalationTask");
+    EXPECT_EQ(task.isConditional(), true);
+  }
+
+  {  // Construction
+    std::string str = R"(config:
+                           conditional: true
+                           inputs:
+                             program: input_data
+                           outputs:
+                             program: output_data
+                           task: TrajOptPipeline
+                           config:
+                             abort_terminal: 0
+                           namespaces: [TrajOptMotionPlannerTask]
+                           profiles: [DEFAULT, TRAJOPT_MORE_ITERATIONS]
+                           attempt_timeout: 10.0
+                           budget: 30.0
+                           adaptive: false)";
+    YAML::Node config = YAML::Load(str);
+    RetryWithEscalationTask task("abc", config["config"], factory);
+    EXPECT_EQ(task.getName(), "abc");
+    EXPECT_EQ(task.isConditional(), true);
+    EXPECT_EQ(task.getInputKeys().size(), 1);
+    EXPECT_EQ(task.getInputKeys().get(RetryWithEscalationTask::INOUT_PROGRAM_PORT), "input_data");
+    EXPECT_EQ(task.getOutputKeys().size(), 1);
+    EXPECT_EQ(task.getOutputKeys().get(RetryWithEscalationTask::INOUT_PROGRAM_PORT), "output_data");
+    EXPECT_EQ(task.getAttemptOrder(), std::vector<std::string>({ "DEFAULT", "TRAJOPT_MORE_ITERATIONS" }));
+  }
+
+  {  // Construction failure
+    const std::string base = R"(config:
+                                  conditional: true
+                                  inputs:
+                                    program: input_data
+                                  outputs:
+                                    program: output_data
+)";
+    const std::vector<std::string> entries{
+      // Missing task
+      R"(                                  namespaces: [TrajOptMotionPlannerTask]
+                                  profiles: [DEFAULT])",
+      // Missing namespaces
+      R"(                                  task: TrajOptPipeline
+                                  profiles: [DEFAULT])",
+      // Missing profiles
+      R"(                                  task: TrajOptPipeline
+                                  namespaces: [TrajOptMotionPlannerTask])",
+      // Empty profiles
+      R"(                                  task: TrajOptPipeline
+                                  namespaces: [TrajOptMotionPlannerTask]
+                                  profiles: [])",
+      // Negative budget
+      R"(                                  task: TrajOptPipeline
+                                  namespaces: [TrajOptMotionPlannerTask]
+                                  profiles: [DEFAULT]
+                                  budget: -1.0)",
+    };
+    for (const auto& entry : entries)
+    {
+      YAML::Node config = YAML::Load(base + entry);
+      EXPECT_ANY_THROW(std::make_unique<RetryWithEscalationTask>("abc", config["config"], factory));  // NOLINT
+    }
+  }
+
+  {  // Construction failure
+    const std::vector<std::string> empty;
+    auto task_factory = createEscalationStubFactory({});
+    EXPECT_ANY_THROW(std::make_unique<RetryWithEscalationTask>(  // NOLINT
+        "abc", "input_data", "output_data", true, nullptr, namespaces, profiles));
+    EXPECT_ANY_THROW(std::make_unique<RetryWithEscalationTask>(  // NOLINT
+        "abc", "input_data", "output_data", true, task_factory, empty, profiles));
+    EXPECT_ANY_THROW(std::make_unique<RetryWithEscalationTask>(  // NOLINT
+        "abc", "input_data", "output_data", true, task_factory, namespaces, empty));
+    EXPECT_ANY_THROW(std::make_unique<RetryWithEscalationTask>(  // NOLINT
+        "abc", "input_data", "output_data", true, task_factory, namespaces, profiles, -1.0));
+  }
+
+  {  // Serialization
+    auto task = std::make_unique<RetryWithEscalationTask>();
+
+    // Serialization
+    test_suite::runSerializationPointerTest(task, "TaskComposerRetryWithEscalationTaskTests");
+  }
+
+  auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+
+  {  // Escalate until a profile succeeds, then start with it on later runs
+    RetryWithEscalationTask task(
+        "Escalation", "input_data", "output_data", true, createEscalationStubFactory({ "HIGH" }), namespaces, profiles);
+    EXPECT_EQ(task.getAttemptOrder(), profiles);
+
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    EXPECT_TRUE(future->context->isSuccessful());
+    auto output = future->context->data_storage->getData("output_data");
+    ASSERT_FALSE(output.isNull());
+    EXPECT_EQ(output.as<CompositeInstruction>().getDescription(), "HIGH");
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(node_info->data_storage.getData("attempts").as<int>(), 3);
+    EXPECT_EQ(node_info->data_storage.getData("profile").as<std::string>(), "HIGH");
+
+    auto statistics = task.getProfileStatistics();
+    ASSERT_EQ(statistics.size(), 3U);
+    EXPECT_EQ(statistics["DEFAULT"].attempts, 1U);
+    EXPECT_EQ(statistics["DEFAULT"].successes, 0U);
+    EXPECT_EQ(statistics["MEDIUM"].attempts, 1U);
+    EXPECT_EQ(statistics["MEDIUM"].successes, 0U);
+    EXPECT_EQ(statistics["HIGH"].attempts, 1U);
+    EXPECT_EQ(statistics["HIGH"].successes, 1U);
+
+    // A new task of the same name attempts the historically best profile first
+    RetryWithEscalationTask later_task(
+        "Escalation", "input_data", "output_data", true, createEscalationStubFactory({ "HIGH" }), namespaces, profiles);
+    EXPECT_EQ(later_task.getAttemptOrder(), std::vector<std::string>({ "HIGH", "DEFAULT", "MEDIUM" }));
+
+    future = runEscalationTask(*executor, later_task);
+    node_info = future->context->task_infos.getInfo(later_task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(node_info->data_storage.getData("attempts").as<int>(), 1);
+    EXPECT_EQ(later_task.getProfileStatistics()["HIGH"].successes, 2U);
+
+    // Without adaptive the escalation order is kept
+    RetryWithEscalationTask fixed_task("Escalation",
+                                       "input_data",
+                                       "output_data",
+                                       true,
+                                       createEscalationStubFactory({ "HIGH" }),
+                                       namespaces,
+                                       profiles,
+                                       0,
+                                       0,
+                                       false);
+    EXPECT_EQ(fixed_task.getAttemptOrder(), profiles);
+  }
+
+  {  // An attempt past its deadline is aborted and the next profile is attempted
+    auto observed_abort = std::make_shared<std::atomic<bool>>(false);
+    RetryWithEscalationTask task("EscalationTimeout",
+                                 "input_data",
+                                 "output_data",
+                                 true,
+                                 createEscalationStubFactory({ "HIGH" }, observed_abort),
+                                 namespaces,
+                                 { "SLOW", "HIGH" },
+                                 0.05);
+
+    const auto start = std::chrono::steady_clock::now();
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5000));
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(node_info->data_storage.getData("attempts").as<int>(), 2);
+    EXPECT_EQ(node_info->data_storage.getData("profile").as<std::string>(), "HIGH");
+    EXPECT_EQ(task.getProfileStatistics()["SLOW"].successes, 0U);
+
+    // The slow attempt stops once it observes the abort
+    for (int i = 0; i < 5000 && !(*observed_abort); ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_TRUE(*observed_abort);
+  }
+
+  {  // The output of an attempt which ignores the abort never reaches the data storage of the task
+    auto stubborn_finished = std::make_shared<std::atomic<bool>>(false);
+    RetryWithEscalationTask task("EscalationAbandoned",
+                                 "input_data",
+                                 "output_data",
+                                 true,
+                                 createEscalationStubFactory({ "HIGH" }, nullptr, stubborn_finished),
+                                 namespaces,
+                                 { "STUBBORN" },
+                                 0.05);
+
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_FALSE(*stubborn_finished);
+
+    // Wait for the abandoned attempt to write its output to its own data storage
+    for (int i = 0; i < 5000 && !(*stubborn_finished); ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_TRUE(*stubborn_finished);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+    EXPECT_NE(future->context->data_storage->getData("input_data").as<CompositeInstruction>().getDescription(),
+              "STUBBORN");
+    EXPECT_EQ(task.getProfileStatistics()["STUBBORN"].successes, 0U);
+  }
+
+  {  // The budget is exhausted before a profile succeeds
+    RetryWithEscalationTask task("EscalationBudget",
+                                 "input_data",
+                                 "output_data",
+                                 true,
+                                 createEscalationStubFactory({ "HIGH" }),
+                                 namespaces,
+                                 { "SLOW", "HIGH" },
+                                 0,
+                                 0.05);
+
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_EQ(node_info->data_storage.getData("attempts").as<int>(), 1);
+    EXPECT_FALSE(node_info->data_storage.hasKey("profile"));
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+  }
+
+  {  // Every profile fails
+    RetryWithEscalationTask task(
+        "EscalationFailure", "input_data", "output_data", true, createEscalationStubFactory({}), namespaces, profiles);
+
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_EQ(node_info->data_storage.getData("attempts").as<int>(), 3);
+    EXPECT_FALSE(future->context->data_storage->hasKey("output_data"));
+    EXPECT_EQ(task.getProfileStatistics().size(), 3U);
+  }
+
+  {  // Input is not a composite instruction
+    RetryWithEscalationTask task(
+        "abc", "input_data", "output_data", true, createEscalationStubFactory({ "HIGH" }), namespaces, profiles);
+
+    auto data = std::make_unique<TaskComposerDataStorage>();
+    data->setData("input_data", 1.0);
+
+    TaskComposerFuture::UPtr future = executor->run(task, std::move(data));
+    future->wait();
+
+    auto node_info = future->context->task_infos.getInfo(task.getUUID());
+    ASSERT_NE(node_info, nullptr);
+    EXPECT_EQ(node_info->return_value, 0);
+    EXPECT_FALSE(node_info->status_message.empty());
+  }
+
+  {  // Tasks of the same name wrapping another task or escalating other namespaces do not share statistics
+    RetryWithEscalationTask task(
+        "Escalation", "input_data", "output_data", true, createEscalationStubFactory({ "HIGH" }), namespaces, profiles);
+    EXPECT_FALSE(task.getProfileStatistics().empty());
+
+    RetryWithEscalationTask other_namespaces_task("Escalation",
+                                                  "input_data",
+                                                  "output_data",
+                                                  true,
+                                                  createEscalationStubFactory({ "HIGH" }),
+                                                  { "OtherPlanner" },
+                                                  profiles);
+    EXPECT_NE(other_namespaces_task.getStatisticsKey(), task.getStatisticsKey());
+    EXPECT_TRUE(other_namespaces_task.getProfileStatistics().empty());
+    EXPECT_EQ(other_namespaces_task.getAttemptOrder(), profiles);
+
+    std::string str = R"(config:
+                           inputs:
+                             program: input_data
+                           outputs:
+                             program: output_data
+                           task: TrajOptPipeline
+                           namespaces: [EscalationStubPlanner]
+                           profiles: [DEFAULT, MEDIUM, HIGH])";
+    YAML::Node config = YAML::Load(str);
+    RetryWithEscalationTask other_task("Escalation", config["config"], factory);
+    EXPECT_NE(other_task.getStatisticsKey(), task.getStatisticsKey());
+    EXPECT_TRUE(other_task.getProfileStatistics().empty());
+    EXPECT_EQ(other_task.getAttemptOrder(), profiles);
+  }
+
+  {  // The profile statistics are recorded in the table provided by the caller
+    auto table = std::make_shared<RetryWithEscalationTask::ProfileStatisticsTable>();
+    RetryWithEscalationTask task("EscalationTable",
+                                 "input_data",
+                                 "output_data",
+                                 true,
+                                 createEscalationStubFactory({ "HIGH" }),
+                                 namespaces,
+                                 profiles,
+                                 0,
+                                 0,
+                                 true,
+                                 table);
+
+    TaskComposerFuture::UPtr future = runEscalationTask(*executor, task);
+    EXPECT_TRUE(future->context->isSuccessful());
+    EXPECT_EQ(table->get().size(), 3U);
+    EXPECT_EQ(table->get()["HIGH"].successes, 1U);
+    EXPECT_EQ(task.getProfileStatistics()["HIGH"].successes, 1U);
+
+    // The shared table of the same statistics key is left untouched
+    RetryWithEscalationTask shared_task("EscalationTable",
+                                        "input_data",
+                                        "output_data",
+                                        true,
+                                        createEscalationStubFactory({ "HIGH" }),
+                                        namespaces,
+                                        profiles);
+    EXPECT_EQ(shared_task.getStatisticsKey(), task.getStatisticsKey());
+    EXPECT_TRUE(shared_task.getProfileStatistics().empty());
+
+    // Clearing the shared tables does not clear the table provided by the caller
+    RetryWithEscalationTask::clearProfileStatistics();
+    EXPECT_EQ(table->get().size(), 3U);
+
+    table->clear();
+    EXPECT_TRUE(task.getProfileStatistics().empty());
+  }
+
+  RetryWithEscalationTask::clearProfileStatistics();
+  RetryWithEscalationTask task(
+      "Escalation", "input_data", "output_data", true, createEscalationStubFactory({ "HIGH" }), namespaces, profiles);
+  EXPECT_TRUE(task.getProfileStatistics().empty());
+}
+
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerBatchRunnerTests)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  tesseract_common::fs::path config_path(
+      locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+  TaskComposerPluginFactory factory(config_path, locator);
+  std::shared_ptr<TaskComposerExecutor> executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+
+  auto running = std::make_shared<std::atomic<int>>(0);
+  auto peak_running = std::make_shared<std::atomic<int>>(0);
+  // A stand in planner which fails programs with the description 'fail' and tracks its peak concurrency
+  auto pipeline = std::make_shared<test_suite::TestPlannerTask>("BatchPlannerTask", "input_data", "output_data");
+  pipeline->delay = std::chrono::milliseconds(5);
+  pipeline->running = running;
+  pipeline->peak_running = peak_running;
+  pipeline->abort_on_failure = true;
+  pipeline->plan = [](const TaskComposerContext& /*context*/, CompositeInstruction& program) {
+    return program.getDescription() != "fail";
+  };
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  std::vector<TaskComposerBatchJob> jobs;
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    CompositeInstruction program = test_suite::freespaceExampleProgramABB();
+    program.setDescription((i % 5 == 0) ? "fail" : std::to_string(i));
+    jobs.emplace_back(program, profiles);
+  }
+
+  {  // Construction
+    TaskComposerBatchRunner runner(pipeline, executor);
+    EXPECT_EQ(runner.getMaxConcurrency(), static_cast<std::size_t>(executor->getWorkerCount()));
+
+    TaskComposerBatchRunner factory_runner(factory, "TrajOptPipeline", executor, 3);
+    EXPECT_EQ(factory_runner.getMaxConcurrency(), 3U);
+  }
+
+  {  // Construction failure
+    EXPECT_ANY_THROW(TaskComposerBatchRunner(nullptr, executor));   // NOLINT
+    EXPECT_ANY_THROW(TaskComposerBatchRunner(pipeline, nullptr));   // NOLINT
+    EXPECT_ANY_THROW(TaskComposerBatchRunner(factory, "DoesNotExist", executor));  // NOLINT
+  }
+
+  {  // Results in job order
+    TaskComposerBatchRunner runner(pipeline, executor, 2);
+    TaskComposerBatchResults batch_results = runner.run(jobs, env_);
+    ASSERT_EQ(batch_results.results.size(), jobs.size());
+    EXPECT_LE(peak_running->load(), 2);
+
+    std::shared_ptr<const tesseract_environment::Environment> shared_env;
+    for (std::size_t i = 0; i < jobs.size(); ++i)
+    {
+      const TaskComposerBatchResult& result = batch_results.results[i];
+      EXPECT_EQ(result.index, i);
+      EXPECT_EQ(result.successful, (i % 5 != 0));
+      ASSERT_NE(result.context, nullptr);
+      if (result.successful)
+        EXPECT_EQ(result.program.getDescription(), std::to_string(i));
+
+      // Every job shares the same environment snapshot
+      auto env = result.context->data_storage->getData("environment")
+                     .as<std::shared_ptr<const tesseract_environment::Environment>>();
+      if (shared_env == nullptr)
+        shared_env = env;
+      EXPECT_EQ(env, shared_env);
+    }
+    EXPECT_NE(shared_env, env_);
+
+    const TaskComposerBatchStatistics& statistics = batch_results.statistics;
+    EXPECT_EQ(statistics.jobs, 20U);
+    EXPECT_EQ(statistics.successful, 16U);
+    EXPECT_EQ(statistics.failed, 4U);
+    EXPECT_GT(statistics.wall_time, 0);
+    EXPECT_GT(statistics.getThroughput(), 0);
+    ASSERT_EQ(statistics.nodes.count("BatchPlannerTask"), 1U);
+    EXPECT_EQ(statistics.nodes.at("BatchPlannerTask").count, 20U);
+    EXPECT_GT(statistics.nodes.at("BatchPlannerTask").getAverageTime(), 0);
+  }
+
+  {  // Results as they complete
+    peak_running->store(0);
+    TaskComposerBatchRunner runner(pipeline, executor, 4);
+    std::vector<std::size_t> completed;
+    TaskComposerBatchStatistics statistics =
+        runner.run(jobs, env_, [&completed](TaskComposerBatchResult result) { completed.push_back(result.index); });
+    EXPECT_LE(peak_running->load(), 4);
+    EXPECT_EQ(statistics.jobs, 20U);
+    EXPECT_EQ(statistics.successful, 16U);
+
+    std::sort(completed.begin(), completed.end());
+    ASSERT_EQ(completed.size(), jobs.size());
+    for (std::size_t i = 0; i < completed.size(); ++i)
+      EXPECT_EQ(completed[i], i);
+  }
+
+  {  // Empty batch
+    TaskComposerBatchRunner runner(pipeline, executor);
+    TaskComposerBatchResults batch_results = runner.run({}, env_);
+    EXPECT_TRUE(batch_results.results.empty());
+    EXPECT_EQ(batch_results.statistics.jobs, 0U);
+  }
+}
+
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerEnvironmentSnapshotTests)  // NOLINT
+{
+  EXPECT_ANY_THROW(EnvironmentSnapshot::create(nullptr));  // NOLINT
+
+  // An unchanged environment shares the same snapshot
+  auto snapshot = EnvironmentSnapshot::create(env_);
+  EXPECT_NE(snapshot->getEnvironment(), env_);
+  EXPECT_EQ(snapshot->getRevision(), env_->getRevision());
+  EXPECT_EQ(EnvironmentSnapshot::create(env_), snapshot);
+
+  // The snapshot environment maps back to the snapshot
+  EXPECT_EQ(EnvironmentSnapshot::create(snapshot->getEnvironment()), snapshot);
+
+  // Changing the state of the source creates a new snapshot
+  std::vector<std::string> joint_names = env_->getActiveJointNames();
+  env_->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1));
+  auto new_snapshot = EnvironmentSnapshot::create(env_);
+  EXPECT_NE(new_snapshot, snapshot);
+  EXPECT_TRUE(new_snapshot->getEnvironment()->getCurrentJointValues().isApprox(env_->getCurrentJointValues()));
+
+  // Finding a snapshot never clones the environment
+  EXPECT_EQ(EnvironmentSnapshot::find(env_), new_snapshot);
+  EXPECT_EQ(EnvironmentSnapshot::find(new_snapshot->getEnvironment()), new_snapshot);
+  EXPECT_TRUE(EnvironmentSnapshot::find(env_->clone()) == nullptr);
+  EXPECT_TRUE(EnvironmentSnapshot::find(nullptr) == nullptr);
+
+  // The snapshot is kept alive by its environment
+  std::shared_ptr<const tesseract_environment::Environment> snapshot_env = snapshot->getEnvironment();
+  std::weak_ptr<const EnvironmentSnapshot> weak_snapshot = snapshot;
+  snapshot.reset();
+  EXPECT_FALSE(weak_snapshot.expired());
+  snapshot_env.reset();
+  EXPECT_TRUE(weak_snapshot.expired());
+
+  // The contact manager of a thread is reused and restored to its initial configuration
+  auto& manager = new_snapshot->getDiscreteContactManager();
+  std::vector<std::string> active_objects = manager.getActiveCollisionObjects();
+  double margin = manager.getCollisionMarginData().getMaxCollisionMargin();
+  manager.setActiveCollisionObjects({ "link_6" });
+  manager.setDefaultCollisionMarginData(margin + 0.5);
+  manager.disableCollisionObject("link_6");
+
+  auto& same_manager = new_snapshot->getDiscreteContactManager();
+  EXPECT_EQ(&same_manager, &manager);
+  EXPECT_EQ(same_manager.getActiveCollisionObjects(), active_objects);
+  EXPECT_NEAR(same_manager.getCollisionMarginData().getMaxCollisionMargin(), margin, 1e-6);
+  EXPECT_TRUE(same_manager.isCollisionObjectEnabled("link_6"));
+
+  {  // A link moved while checking one active set must not be left there for a check of another active set
+    auto snapshot_env = new_snapshot->getEnvironment();
+    auto& first_manager = new_snapshot->getDiscreteContactManager();
+    first_manager.setActiveCollisionObjects({ "link_6" });
+    first_manager.setCollisionObjectsTransform("link_6", snapshot_env->getLinkTransform("link_2"));
+
+    std::vector<std::string> other_links = first_manager.getCollisionObjects();
+    other_links.erase(std::remove(other_links.begin(), other_links.end(), "link_6"), other_links.end());
+
+    auto& second_manager = new_snapshot->getDiscreteContactManager();
+    EXPECT_EQ(&second_manager, &first_manager);
+    // The allowed collisions are ignored so a link left behind is always in contact with the link it was moved onto
+    second_manager.setActiveCollisionObjects(other_links);
+    second_manager.setContactAllowedValidator(nullptr);
+    tesseract_collision::ContactResultMap reused_results;
+    second_manager.contactTest(reused_results,
+                               tesseract_collision::ContactRequest(tesseract_collision::ContactTestType::ALL));
+
+    auto fresh_manager = snapshot_env->getDiscreteContactManager();
+    fresh_manager->setActiveCollisionObjects(other_links);
+    fresh_manager->setContactAllowedValidator(nullptr);
+    tesseract_collision::ContactResultMap fresh_results;
+    fresh_manager->contactTest(fresh_results,
+                               tesseract_collision::ContactRequest(tesseract_collision::ContactTestType::ALL));
+
+    EXPECT_EQ(reused_results.size(), fresh_results.size());
+  }
+
+  // Other threads get their own contact manager
+  const tesseract_collision::DiscreteContactManager* thread_manager{ nullptr };
+  std::thread thread(
+      [&new_snapshot, &thread_manager]() { thread_manager = &new_snapshot->getDiscreteContactManager(); });
+  thread.join();
+  EXPECT_NE(thread_manager, &manager);
+
+  // The state solver of a thread is restored to the state of the snapshot
+  auto& state_solver = new_snapshot->getStateSolver();
+  state_solver.setState(joint_names, Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size())));
+  auto& same_state_solver = new_snapshot->getStateSolver();
+  EXPECT_EQ(&same_state_solver, &state_solver);
+  EXPECT_TRUE(same_state_solver.getJointValues(joint_names).isApprox(env_->getCurrentJointValues(joint_names)));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,221 @@
+/**
+ * @file tesseract_task_composer_remap_benchmark.cpp
+ * @brief The cost of handing large raster programs between keys of the data storage
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/manipulator_info.h>
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/nodes/remap_task.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+
+using namespace tesseract_planning;
+
+/** @brief The number of rasters of the benchmark program */
+constexpr std::size_t RASTER_COUNT{ 50 };
+
+/** @brief The number of waypoints of each raster, giving a program of about 50k waypoints */
+constexpr std::size_t RASTER_WAYPOINT_COUNT{ 1000 };
+
+/**
+ * @brief A raster program with the layout expected by the raster pipelines
+ * @details A from start freespace, the rasters separated by transitions and a to end freespace
+ */
+CompositeInstruction createRasterProgram()
+{
+  CompositeInstruction program(DEFAULT_PROFILE_KEY,
+                               tesseract_common::ManipulatorInfo("manipulator", "base_link", "tool0"));
+  const std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  StateWaypointPoly start{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+
+  const auto pose = [](double x, double y) {
+    return CartesianWaypointPoly{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(x, y, 0.8) *
+                                                    Eigen::Quaterniond(0, 0, -1.0, 0)) };
+  };
+
+  CompositeInstruction from_start(DEFAULT_PROFILE_KEY);
+  from_start.setDescription("from_start");
+  from_start.appendMoveInstruction(MoveInstruction(start, MoveInstructionType::FREESPACE));
+  from_start.appendMoveInstruction(MoveInstruction(pose(0.8, -0.3), MoveInstructionType::FREESPACE));
+  program.push_back(from_start);
+
+  for (std::size_t i = 0; i < RASTER_COUNT; ++i)
+  {
+    const double x = 0.8 + (static_cast<double>(i) * 0.01);
+    CompositeInstruction raster("PROCESS");
+    raster.setDescription("Raster #" + std::to_string(i + 1));
+    for (std::size_t j = 0; j < RASTER_WAYPOINT_COUNT; ++j)
+    {
+      const double y = -0.3 + ((0.6 * static_cast<double>(j)) / static_cast<double>(RASTER_WAYPOINT_COUNT - 1));
+      raster.appendMoveInstruction(MoveInstruction(pose(x, y), MoveInstructionType::LINEAR, "PROCESS"));
+    }
+    program.push_back(raster);
+
+    if (i + 1 < RASTER_COUNT)
+    {
+      CompositeInstruction transition(DEFAULT_PROFILE_KEY);
+      transition.setDescription("Transition #" + std::to_string(i + 1));
+      transition.appendMoveInstruction(MoveInstruction(pose(x + 0.01, -0.3), MoveInstructionType::FREESPACE));
+      program.push_back(transition);
+    }
+  }
+
+  CompositeInstruction to_end(DEFAULT_PROFILE_KEY);
+  to_end.setDescription("to_end");
+  to_end.appendMoveInstruction(MoveInstruction(start, MoveInstructionType::FREESPACE));
+  program.push_back(to_end);
+  return program;
+}
+
+const CompositeInstruction& getRasterProgram()
+{
+  static const CompositeInstruction program = createRasterProgram();
+  return program;
+}
+
+TaskComposerDataStorage::RemapMode getRemapMode(benchmark::State& state)
+{
+  const auto mode = static_cast<TaskComposerDataStorage::RemapMode>(state.range(0));
+  switch (mode)
+  {
+    case TaskComposerDataStorage::RemapMode::MOVE:
+      state.SetLabel("move");
+      break;
+    case TaskComposerDataStorage::RemapMode::COPY:
+      state.SetLabel("copy");
+      break;
+    case TaskComposerDataStorage::RemapMode::ALIAS:
+      state.SetLabel("alias");
+      break;
+  }
+  return mode;
+}
+
+/** @brief A RemapTask hands the program to the input key of a pipeline and a second one hands the result back */
+static void BM_RemapTaskRasterProgram(benchmark::State& state)
+{
+  const TaskComposerDataStorage::RemapMode mode = getRemapMode(state);
+  auto data_storage = std::make_unique<TaskComposerDataStorage>();
+  data_storage->setData("program", getRasterProgram());
+  TaskComposerContext context("RemapBenchmark", std::move(data_storage));
+
+  RemapTask forward("RemapForward", { { "program", "planning_input" } }, mode);
+  RemapTask backward("RemapBackward", { { "planning_input", "program" } }, mode);
+  for (auto _ : state)
+  {
+    forward.run(context);
+    backward.run(context);
+  }
+
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+BENCHMARK(BM_RemapTaskRasterProgram)
+    ->Arg(static_cast<int>(TaskComposerDataStorage::RemapMode::MOVE))
+    ->Arg(static_cast<int>(TaskComposerDataStorage::RemapMode::COPY))
+    ->Arg(static_cast<int>(TaskComposerDataStorage::RemapMode::ALIAS))
+    ->Unit(benchmark::kMicrosecond);
+
+/** @brief Hand the program to a key per raster, as a raster pipeline shares the program with each raster task */
+static void BM_RemapRasterFanOut(benchmark::State& state)
+{
+  const TaskComposerDataStorage::RemapMode mode = getRemapMode(state);
+  TaskComposerDataStorage data_storage;
+  data_storage.setData("program", getRasterProgram());
+
+  std::vector<std::map<std::string, std::string>> remappings;
+  remappings.reserve(RASTER_COUNT);
+  for (std::size_t i = 0; i < RASTER_COUNT; ++i)
+    remappings.push_back({ { "program", "raster_input" + std::to_string(i) } });
+
+  for (auto _ : state)
+  {
+    for (const auto& remapping : remappings)
+      data_storage.remapData(remapping, mode);
+
+    state.PauseTiming();
+    for (const auto& remapping : remappings)
+      data_storage.removeData(remapping.begin()->second);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(RASTER_COUNT));
+}
+
+BENCHMARK(BM_RemapRasterFanOut)
+    ->Arg(static_cast<int>(TaskComposerDataStorage::RemapMode::COPY))
+    ->Arg(static_cast<int>(TaskComposerDataStorage::RemapMode::ALIAS))
+    ->Unit(benchmark::kMillisecond);
+
+/** @brief Alias the program and then modify it, the copy is deferred to the first mutable access */
+static void BM_RemapAliasThenModify(benchmark::State& state)
+{
+  TaskComposerDataStorage data_storage;
+  data_storage.setData("program", getRasterProgram());
+  const std::map<std::string, std::string> remapping{ { "program", "planning_input" } };
+
+  for (auto _ : state)
+  {
+    data_storage.remapData(remapping, TaskComposerDataStorage::RemapMode::ALIAS);
+    auto program = data_storage.getData("planning_input").as<CompositeInstruction>();
+    program.setDescription("modified");
+    data_storage.setData("planning_input", std::move(program));
+  }
+}
+
+BENCHMARK(BM_RemapAliasThenModify)->Unit(benchmark::kMicrosecond);
+
+/** @brief Copy a data storage holding the program, as done for each contender or child context */
+static void BM_DataStorageCopyRasterProgram(benchmark::State& state)
+{
+  TaskComposerDataStorage data_storage;
+  data_storage.setData("program", getRasterProgram());
+  for (auto _ : state)
+  {
+    TaskComposerDataStorage copy{ data_storage };
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+BENCHMARK(BM_DataStorageCopyRasterProgram)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_ERROR);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
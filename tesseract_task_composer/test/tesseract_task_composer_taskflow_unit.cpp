@@ -3,6 +3,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 #include <memory>
+#include <future>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/taskflow/taskflow_task_composer_executor.h>
@@ -10,6 +11,30 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 using namespace tesseract_planning;
 
+/** @brief A task which blocks until the gate is opened */
+class GateTask : public TaskComposerTask
+{
+public:
+  GateTask(std::string name, std::shared_future<void> gate)
+    : TaskComposerTask(std::move(name), TaskComposerNodePorts{}, false), gate_(std::move(gate))
+  {
+  }
+
+protected:
+  std::unique_ptr<TaskComposerNodeInfo> runImpl(TaskComposerContext& /*context*/,
+                                                OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    gate_.wait();
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->color = "green";
+    info->return_value = 1;
+    info->status_code = 1;
+    return info;
+  }
+
+  std::shared_future<void> gate_;
+};
+
 TEST(TesseractTaskComposerTaskflowUnit, TaskComposerExecutorTests)  // NOLINT
 {
   test_suite::runTaskComposerExecutorTest<TaskflowTaskComposerExecutor>();
@@ -31,6 +56,125 @@ TEST(TesseractTaskComposerTaskflowUnit, TaskComposerExecutorTests)  // NOLINT
     // NOLINTNEXTLINE
     EXPECT_ANY_THROW(std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", config["config"]));
   }
+
+  {  // Priority classes
+    std::string str = R"(config:
+                           threads: 3
+                           priorities:
+                             high:
+                               threads: 2
+                             low:
+                               max_running: 2
+                               max_deferred: 10
+                               admission: reject)";
+    YAML::Node config = YAML::Load(str);
+    TaskflowTaskComposerExecutor executor("TaskComposerExecutorTests", config["config"]);
+    EXPECT_EQ(executor.getWorkerCount(), 5);
+    const auto& priorities = executor.getPriorityConfigs();
+    EXPECT_EQ(priorities.size(), 2);
+    EXPECT_EQ(priorities.at(TaskComposerPriority::HIGH).threads, 2);
+    EXPECT_EQ(priorities.at(TaskComposerPriority::LOW).max_running, 2);
+    EXPECT_EQ(priorities.at(TaskComposerPriority::LOW).max_deferred, 10);
+    EXPECT_EQ(priorities.at(TaskComposerPriority::LOW).admission, TaskflowAdmissionPolicy::REJECT);
+  }
+
+  {  // Priority classes failure
+    std::string str = R"(config:
+                           priorities:
+                             urgent:
+                               threads: 2)";
+    YAML::Node config = YAML::Load(str);
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", config["config"]));
+  }
+}
+
+TEST(TesseractTaskComposerTaskflowUnit, TaskComposerExecutorAdmissionTests)  // NOLINT
+{
+  {  // Reject
+    TaskflowPriorityConfig low;
+    low.max_running = 1;
+    low.admission = TaskflowAdmissionPolicy::REJECT;
+    std::map<TaskComposerPriority, TaskflowPriorityConfig> priorities{ { TaskComposerPriority::LOW, low } };
+    TaskComposerExecutor::UPtr executor =
+        std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", 2, priorities);
+
+    std::promise<void> gate;
+    GateTask task("GateTask", gate.get_future().share());
+    auto future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW));
+
+    // Other classes are not affected
+    auto other_future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::HIGH);
+
+    gate.set_value();
+    future->wait();
+    other_future->wait();
+    EXPECT_TRUE(future->context->isSuccessful());
+
+    TaskComposerExecutorMetrics metrics = executor->getMetrics(TaskComposerPriority::LOW);
+    EXPECT_EQ(metrics.admitted, 1);
+    EXPECT_EQ(metrics.rejected, 1);
+    EXPECT_EQ(metrics.completed, 1);
+    EXPECT_EQ(executor->getMetrics(TaskComposerPriority::HIGH).completed, 1);
+  }
+
+  {  // Defer
+    TaskflowPriorityConfig low;
+    low.max_running = 1;
+    low.max_deferred = 1;
+    low.admission = TaskflowAdmissionPolicy::DEFER;
+    std::map<TaskComposerPriority, TaskflowPriorityConfig> priorities{ { TaskComposerPriority::LOW, low } };
+    TaskComposerExecutor::UPtr executor =
+        std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", 2, priorities);
+
+    std::promise<void> gate;
+    GateTask task("GateTask", gate.get_future().share());
+    auto future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    auto deferred_future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    EXPECT_FALSE(deferred_future->ready());
+
+    // The deferred queue is full
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW));
+
+    gate.set_value();
+    future->wait();
+    deferred_future->wait();
+    EXPECT_TRUE(deferred_future->context->isSuccessful());
+
+    TaskComposerExecutorMetrics metrics = executor->getMetrics(TaskComposerPriority::LOW);
+    EXPECT_EQ(metrics.admitted, 2);
+    EXPECT_EQ(metrics.deferred, 1);
+    EXPECT_EQ(metrics.rejected, 1);
+    EXPECT_EQ(metrics.completed, 2);
+    EXPECT_GE(metrics.max_queue_wait_time, 0);
+  }
+
+  {  // Destroying the executor waits for the deferred requests
+    TaskflowPriorityConfig low;
+    low.threads = 1;
+    low.max_running = 1;
+    low.admission = TaskflowAdmissionPolicy::DEFER;
+    std::map<TaskComposerPriority, TaskflowPriorityConfig> priorities{ { TaskComposerPriority::LOW, low } };
+    TaskComposerExecutor::UPtr executor =
+        std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", 2, priorities);
+
+    std::promise<void> gate;
+    GateTask task("GateTask", gate.get_future().share());
+    auto future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    auto deferred_future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    auto last_future = executor->run(task, std::make_shared<TaskComposerDataStorage>(), TaskComposerPriority::LOW);
+    EXPECT_FALSE(deferred_future->ready());
+
+    gate.set_value();
+    executor = nullptr;
+    EXPECT_TRUE(future->ready());
+    EXPECT_TRUE(deferred_future->ready());
+    EXPECT_TRUE(last_future->ready());
+    EXPECT_TRUE(last_future->context->isSuccessful());
+  }
 }
 
 int main(int argc, char** argv)
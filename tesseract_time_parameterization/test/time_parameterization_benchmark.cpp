@@ -0,0 +1,379 @@
+/**
+ * @file time_parameterization_benchmark.cpp
+ * @brief Benchmark the runtime, allocations and limit accuracy of every time parameterization on a shared corpus
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#if defined(__GLIBC__)
+#include <cerrno>
+#include <malloc.h>
+#endif
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/joint_state.h>
+#include <tesseract_time_parameterization/core/tesseract_common_trajectory.h>
+#include <tesseract_time_parameterization/totg/time_optimal_trajectory_generation.h>
+#include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
+#include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
+#include "benchmark_utils.hpp"
+
+#if defined(__GLIBC__)
+/**
+ * @brief The C allocation functions are replaced so every heap allocation is counted
+ * @details Eigen allocates with malloc directly while the standard library allocates with operator new, which calls
+ * malloc, so counting at this level captures both. The live heap, and therefore its peak, is tracked using the usable
+ * size of each block. The replacements forward to the glibc implementations, so this is only supported with glibc.
+ */
+static std::atomic<std::size_t> allocation_count{ 0 };  // NOLINT
+static std::atomic<std::size_t> allocated_bytes{ 0 };   // NOLINT
+static std::atomic<std::size_t> peak_bytes{ 0 };        // NOLINT
+
+extern "C" {
+void* __libc_malloc(std::size_t size);                           // NOLINT
+void* __libc_calloc(std::size_t count, std::size_t size);        // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);               // NOLINT
+void* __libc_memalign(std::size_t alignment, std::size_t size);  // NOLINT
+void* __libc_valloc(std::size_t size);                           // NOLINT
+void* __libc_pvalloc(std::size_t size);                          // NOLINT
+void __libc_free(void* ptr);                                     // NOLINT
+}
+
+static void* trackAllocation(void* ptr)
+{
+  if (ptr == nullptr)
+    return ptr;
+
+  ++allocation_count;
+  std::size_t current = (allocated_bytes += malloc_usable_size(ptr));
+  std::size_t peak = peak_bytes.load();
+  while (current > peak && !peak_bytes.compare_exchange_weak(peak, current))
+  {
+  }
+
+  return ptr;
+}
+
+static void trackFree(void* ptr)
+{
+  if (ptr != nullptr)
+    allocated_bytes -= malloc_usable_size(ptr);
+}
+
+extern "C" {
+void* malloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_malloc(size));
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_calloc(count, size));
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept  // NOLINT
+{
+  const std::size_t old_size = (ptr != nullptr) ? malloc_usable_size(ptr) : 0;
+  void* new_ptr = __libc_realloc(ptr, size);
+  if (new_ptr == nullptr && size != 0)
+    return new_ptr;
+
+  allocated_bytes -= old_size;
+  return trackAllocation(new_ptr);
+}
+
+void* memalign(std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_memalign(alignment, size));
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_memalign(alignment, size));
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept  // NOLINT
+{
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+    return EINVAL;
+
+  *ptr = trackAllocation(__libc_memalign(alignment, size));
+  return (*ptr == nullptr && size != 0) ? ENOMEM : 0;
+}
+
+void* valloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_valloc(size));
+}
+
+void* pvalloc(std::size_t size) noexcept  // NOLINT
+{
+  return trackAllocation(__libc_pvalloc(size));
+}
+
+void free(void* ptr) noexcept  // NOLINT
+{
+  trackFree(ptr);
+  __libc_free(ptr);
+}
+}
+#endif
+
+using namespace tesseract_planning;
+
+/** @brief A single trajectory of the corpus along with the limits it should be parameterized with */
+struct CorpusEntry
+{
+  std::string name;
+  tesseract_common::JointTrajectory trajectory;
+  Eigen::MatrixX2d velocity_limits;
+  Eigen::MatrixX2d acceleration_limits;
+  Eigen::MatrixX2d jerk_limits;
+};
+
+/**
+ * @brief Generate a synthetic joint trajectory
+ * @details The path is a sequence of straight segments between random targets, so every target is a sharp corner.
+ * Every seventh point is followed by a near duplicate offset by less than the TOTG minimum angle change.
+ * @param dof The number of joints
+ * @param size The number of waypoints
+ * @param seed The seed for the random number generator so the corpus is the same between runs
+ */
+CorpusEntry createCorpusEntry(Eigen::Index dof, std::size_t size, unsigned seed)
+{
+  CorpusEntry entry;
+  entry.name = std::to_string(dof) + "dof/" + std::to_string(size);
+
+  std::vector<std::string> joint_names;
+  for (Eigen::Index j = 0; j < dof; ++j)
+    joint_names.push_back("joint_" + std::to_string(j + 1));
+
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> target_dist(-2.5, 2.5);
+  std::uniform_int_distribution<int> segment_dist(3, 25);
+
+  Eigen::VectorXd current = Eigen::VectorXd::Zero(dof);
+  Eigen::VectorXd target = current;
+  int remaining{ 0 };
+
+  entry.trajectory.reserve(size);
+  while (entry.trajectory.size() < size)
+  {
+    if (remaining == 0)
+    {
+      for (Eigen::Index j = 0; j < dof; ++j)
+        target(j) = target_dist(generator);
+      remaining = segment_dist(generator);
+    }
+
+    current += (target - current) / remaining--;
+    entry.trajectory.push_back(tesseract_common::JointState(joint_names, current));
+
+    if (entry.trajectory.size() % 7 == 0 && entry.trajectory.size() < size)
+      entry.trajectory.push_back(tesseract_common::JointState(joint_names, current.array() + 1e-6));
+  }
+
+  entry.velocity_limits.resize(dof, 2);
+  entry.acceleration_limits.resize(dof, 2);
+  entry.jerk_limits.resize(dof, 2);
+  for (Eigen::Index j = 0; j < dof; ++j)
+  {
+    // Give the wrist joints higher limits like a typical industrial robot
+    double scale = (j < 3) ? 1.0 : 1.5;
+    entry.velocity_limits.row(j) << -2.0 * scale, 2.0 * scale;
+    entry.acceleration_limits.row(j) << -5.0 * scale, 5.0 * scale;
+    entry.jerk_limits.row(j) << -50.0 * scale, 50.0 * scale;
+  }
+
+  return entry;
+}
+
+/** @brief The worst violation of the limits as a fraction of the limit, zero if the trajectory is within its limits */
+struct LimitViolation
+{
+  double velocity{ 0 };
+  double acceleration{ 0 };
+  double jerk{ 0 };
+};
+
+double violation(double value, double min, double max)
+{
+  if (value > max)
+    return (value - max) / std::abs(max);
+
+  if (value < min)
+    return (min - value) / std::abs(min);
+
+  return 0;
+}
+
+/** @brief Measure the limit violations, jerk is taken from the finite difference of the acceleration */
+LimitViolation computeLimitViolation(const TrajectoryContainer& trajectory, const CorpusEntry& entry)
+{
+  LimitViolation result;
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    const Eigen::VectorXd& vel = trajectory.getVelocity(i);
+    const Eigen::VectorXd& acc = trajectory.getAcceleration(i);
+    double dt = (i > 0) ? trajectory.getTimeFromStart(i) - trajectory.getTimeFromStart(i - 1) : 0;
+    for (Eigen::Index j = 0; j < trajectory.dof(); ++j)
+    {
+      result.velocity = std::max(
+          result.velocity, violation(vel(j), entry.velocity_limits(j, 0), entry.velocity_limits(j, 1)));
+      result.acceleration = std::max(
+          result.acceleration, violation(acc(j), entry.acceleration_limits(j, 0), entry.acceleration_limits(j, 1)));
+
+      if (dt > 0)
+      {
+        double jerk = (acc(j) - trajectory.getAcceleration(i - 1)(j)) / dt;
+        result.jerk = std::max(result.jerk, violation(jerk, entry.jerk_limits(j, 0), entry.jerk_limits(j, 1)));
+      }
+    }
+  }
+  return result;
+}
+
+/** @brief An algorithm under test along with anything which must be done to the trajectory before it is run */
+struct AlgorithmSetup
+{
+  std::string name;
+  std::shared_ptr<const TimeParameterization> algorithm;
+  /** @brief Prepares the input outside of the timed region, for example Ruckig requires an existing parameterization */
+  std::shared_ptr<const TimeParameterization> seed;
+};
+
+/**
+ * @brief Run an algorithm on a corpus entry
+ * @details Only the call to compute is timed. The allocation counters and the accuracy metrics are reported from the
+ * last iteration, they are the same for every iteration since the algorithms are deterministic. The allocation
+ * counters are only reported with glibc.
+ */
+void BM_TimeParameterization(benchmark::State& state,
+                             const std::shared_ptr<const CorpusEntry>& entry,
+                             const AlgorithmSetup& setup)
+{
+  bool successful{ true };
+#if defined(__GLIBC__)
+  std::size_t allocations{ 0 };
+  std::size_t peak{ 0 };
+#endif
+  double duration{ 0 };
+  LimitViolation limit_violation;
+
+  const Eigen::VectorXd scaling = Eigen::VectorXd::Ones(1);
+  for (auto _ : state)
+  {
+    tesseract_common::JointTrajectory trajectory = entry->trajectory;
+    TesseractCommonTrajectory container(trajectory);
+    if (setup.seed != nullptr && !setup.seed->compute(container,
+                                                      entry->velocity_limits,
+                                                      entry->acceleration_limits,
+                                                      entry->jerk_limits,
+                                                      scaling,
+                                                      scaling,
+                                                      scaling))
+    {
+      state.SkipWithError("Failed to seed the trajectory");
+      return;
+    }
+
+#if defined(__GLIBC__)
+    const std::size_t start_count = allocation_count.load();
+    const std::size_t start_bytes = allocated_bytes.load();
+    peak_bytes = start_bytes;
+#endif
+
+    auto start = std::chrono::high_resolution_clock::now();
+    successful = setup.algorithm->compute(container,
+                                          entry->velocity_limits,
+                                          entry->acceleration_limits,
+                                          entry->jerk_limits,
+                                          scaling,
+                                          scaling,
+                                          scaling);
+    auto end = std::chrono::high_resolution_clock::now();
+    state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+
+#if defined(__GLIBC__)
+    allocations = allocation_count.load() - start_count;
+    peak = peak_bytes.load() - start_bytes;
+#endif
+    duration = container.getTimeFromStart(container.size() - 1);
+    limit_violation = computeLimitViolation(container, *entry);
+  }
+
+  state.counters["successful"] = successful ? 1 : 0;
+  state.counters["waypoints"] = static_cast<double>(entry->trajectory.size());
+#if defined(__GLIBC__)
+  state.counters["allocations"] = static_cast<double>(allocations);
+  state.counters["peak_bytes"] = benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults,
+                                                    benchmark::Counter::OneK::kIs1024);
+#endif
+  state.counters["duration"] = duration;
+  state.counters["max_vel_violation"] = limit_violation.velocity;
+  state.counters["max_acc_violation"] = limit_violation.acceleration;
+  state.counters["max_jerk_violation"] = limit_violation.jerk;
+}
+
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_ERROR);
+
+  std::vector<std::shared_ptr<const CorpusEntry>> corpus;
+  unsigned seed{ 0 };
+  for (Eigen::Index dof : { 6, 7 })
+  {
+    for (std::size_t size : { 10, 100, 1000, 10000, 100000 })
+      corpus.push_back(std::make_shared<const CorpusEntry>(createCorpusEntry(dof, size, seed++)));
+  }
+
+  std::vector<AlgorithmSetup> setups;
+  setups.push_back({ "TimeOptimalTrajectoryGeneration", std::make_shared<TimeOptimalTrajectoryGeneration>(), nullptr });
+  setups.push_back({ "IterativeSplineParameterization", std::make_shared<IterativeSplineParameterization>(), nullptr });
+  setups.push_back({ "RuckigTrajectorySmoothing",
+                     std::make_shared<RuckigTrajectorySmoothing>(),
+                     std::make_shared<IterativeSplineParameterization>(false) });
+
+  for (const auto& setup : setups)
+  {
+    for (const auto& entry : corpus)
+    {
+      benchmark::RegisterBenchmark(
+          ("BM_TimeParameterization/" + setup.name + "/" + entry->name).c_str(),
+          [entry, setup](benchmark::State& state) { BM_TimeParameterization(state, entry, setup); })
+          ->UseManualTime()
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+
+  return tesseract_planning::test_suite::runBenchmarks(argc, argv, "time_parameterization_benchmark.json");
+}